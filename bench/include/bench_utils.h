@@ -0,0 +1,49 @@
+#ifndef BENCH_UTILS_DOT_H
+#define BENCH_UTILS_DOT_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+/*!
+ * \brief	Keeps the optimizer from discarding or hoisting work on the given value.
+ */
+template<typename T>
+inline void DoNotOptimize(T& value)
+{
+#if defined(__GNUC__)
+	asm volatile("" : "+m"(value) : : "memory");
+#else
+	volatile char sink = *reinterpret_cast<volatile char*>(&value);
+	(void)sink;
+#endif
+}
+
+/*!
+ * \brief	Runs the given kernel \p reps times and prints the average time per element.
+ *
+ * \param	name		The label to print.
+ * \param	reps		The number of timed repetitions.
+ * \param	elements	The number of elements processed per repetition.
+ * \param	kernel		The kernel to time.
+ *
+ * \return	The average nanoseconds per element.
+ */
+template<typename Kernel>
+inline double RunBenchmark(const char* name, size_t reps, size_t elements, Kernel kernel)
+{
+	kernel();
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t r = 0; r < reps; r++)
+	{
+		kernel();
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	double ns = std::chrono::duration<double, std::nano>(end - start).count() / (double(reps) * elements);
+	std::printf("%-48s %8.3f ns/element\n", name, ns);
+	return ns;
+}
+
+#endif
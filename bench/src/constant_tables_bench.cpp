@@ -0,0 +1,105 @@
+#include "bench_utils.h"
+#include "ssevec.h"
+
+using namespace gofxmath;
+
+namespace
+{
+	// The pre-SseVecConst forms: guarded function-local statics built with _mm_set_ps.
+	template<bool aX = true, bool aY = true, bool aZ = true, bool aW = true>
+	SSE_VEC_CALL GuardedVec4Abs(const SseVec& vec)
+	{
+		static const SseVec NEGATE_MASK = SetSseVecMask(~(aX << 31), ~(aY << 31), ~(aZ << 31), ~(aW << 31));
+		return VecAnd(vec, NEGATE_MASK);
+	}
+
+	SSE_VEC_CALL GuardedFastCosSseVec(const SseVec& angles)
+	{
+		static const SseVec F_PI_2_1111 = SetSseVec4(F_PI_2);
+		static const SseVec F_4_PI_1111 = SetSseVec4(F_4_PI);
+		static const SseVec F_NEG4_PI2_1111 = SetSseVec4(F_NEG4_PI2);
+		static const SseVec F_9_40_1111 = SetSseVec4(0.225f);
+		SseVec tmp0, tmp1;
+		tmp0 = VecAdd(angles, F_PI_2_1111);
+		tmp0 = NormalizeAngles(tmp0);
+
+		tmp1 = GuardedVec4Abs(tmp0);
+		tmp1 = VecMul(tmp1, tmp0);
+		tmp0 = VecMul(tmp0, F_4_PI_1111);
+		tmp1 = VecMul(tmp1, F_NEG4_PI2_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		tmp1 = GuardedVec4Abs(tmp0);
+		tmp1 = VecMul(tmp1, tmp0);
+		tmp1 = VecSub(tmp1, tmp0);
+		tmp1 = VecMul(tmp1, F_9_40_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		return tmp0;
+	}
+
+	template<PrecisionPolicy policy>
+	SSE_VEC_CALL GuardedVec3Normalize(const SseVec& vec)
+	{
+		static const SseVec UNIT_0001 = SetSseVec4(0.0f, 0.0f, 0.0f, 1.0f);
+		static const SseVec EPSILON_SQR_1111 = SetSseVec4(Epsilon() * Epsilon());
+		SseVec tmp0 = Vec3Dot(vec, vec);
+		SseVec lengthMask = _mm_cmpnle_ps(tmp0, EPSILON_SQR_1111);
+		tmp0 = VecAnd(lengthMask, VecMul(vec, VecRSqrt<policy>(tmp0)));
+
+		return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(tmp0, UNIT_0001);
+	}
+}
+
+int main()
+{
+	const size_t COUNT = 4096;
+	const size_t REPS = 20000;
+	ALIGNED_TYPE(static float, 16) inputs[COUNT * 4];
+	ALIGNED_TYPE(static float, 16) outputs[COUNT * 4];
+
+	for (size_t i = 0; i < COUNT * 4; i++)
+	{
+		inputs[i] = -3.0f + (i % 97) * 0.0625f;
+	}
+
+	std::printf("SseVec constants: guarded statics vs. statically initialized tables (%zu SseVecs x %zu reps)\n", COUNT, REPS);
+
+	RunBenchmark("FastCosSseVec, guarded statics", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			_mm_store_ps(outputs + i * 4, GuardedFastCosSseVec(_mm_load_ps(inputs + i * 4)));
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("FastCosSseVec, SseVecConst tables", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			_mm_store_ps(outputs + i * 4, FastCosSseVec(_mm_load_ps(inputs + i * 4)));
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("Vec3Normalize<REFINED>, guarded statics", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			_mm_store_ps(outputs + i * 4, GuardedVec3Normalize<PrecisionPolicy::REFINED>(_mm_load_ps(inputs + i * 4)));
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("Vec3Normalize<REFINED>, SseVecConst tables", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			_mm_store_ps(outputs + i * 4, Vec3Normalize<PrecisionPolicy::REFINED>(_mm_load_ps(inputs + i * 4)));
+		}
+		DoNotOptimize(outputs);
+	});
+
+	return 0;
+}
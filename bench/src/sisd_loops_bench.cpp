@@ -0,0 +1,118 @@
+#include "bench_utils.h"
+#include "vecmath.h"
+
+using namespace gofxmath;
+
+// Loops over plain Vec3 arrays, calling the SISD functions directly and through a function pointer the
+// optimizer cannot see through (which is what every call into the static library looks like without LTO).
+// Build with -fopt-info-vec-optimized (g++) or /Qvec-report:2 (MSVC) to see which loops were vectorized.
+// Vec3Normalize is only inlined when GOFXMATH_INLINE_SISD is defined; the other functions always are.
+namespace
+{
+	typedef Vec3 (*Vec3BinaryFn)(const Vec3&, const Vec3&);
+	typedef Vec3 (*Vec3ScalarFn)(const Vec3&, float);
+	typedef float (*Vec3DotFn)(const Vec3&, const Vec3&);
+	typedef Vec3 (*Vec3UnaryFn)(const Vec3&);
+
+	Vec3BinaryFn volatile OPAQUE_VEC3_ADD = Vec3Add;
+	Vec3ScalarFn volatile OPAQUE_VEC3_MUL_SCALAR = Vec3MulScalar;
+	Vec3DotFn volatile OPAQUE_VEC3_DOT = Vec3Dot;
+	Vec3BinaryFn volatile OPAQUE_VEC3_CROSS = Vec3Cross;
+	Vec3UnaryFn volatile OPAQUE_VEC3_NORMALIZE = Vec3Normalize;
+}
+
+int main()
+{
+	const size_t COUNT = 4096;
+	const size_t REPS = 20000;
+	static Vec3 first[COUNT];
+	static Vec3 second[COUNT];
+	static Vec3 outputs[COUNT];
+	static float dots[COUNT];
+
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		first[i] = Vec3(-3.0f + (i % 97) * 0.0625f, 1.0f + (i % 13) * 0.25f, 0.5f - (i % 7) * 0.125f);
+		second[i] = Vec3(0.25f + (i % 5) * 0.5f, -2.0f + (i % 11) * 0.375f, 1.5f + (i % 3) * 0.75f);
+	}
+
+#if defined(GOFXMATH_INLINE_SISD)
+	std::printf("SISD Vec3 array loops, GOFXMATH_INLINE_SISD on (%zu Vec3s x %zu reps)\n", COUNT, REPS);
+#else
+	std::printf("SISD Vec3 array loops, GOFXMATH_INLINE_SISD off (%zu Vec3s x %zu reps)\n", COUNT, REPS);
+#endif
+
+	RunBenchmark("Vec3Add(a, Vec3MulScalar(b, s)), inline", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			outputs[i] = Vec3Add(first[i], Vec3MulScalar(second[i], 0.5f));
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("Vec3Add(a, Vec3MulScalar(b, s)), opaque call", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			outputs[i] = OPAQUE_VEC3_ADD(first[i], OPAQUE_VEC3_MUL_SCALAR(second[i], 0.5f));
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("Vec3Dot, inline", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			dots[i] = Vec3Dot(first[i], second[i]);
+		}
+		DoNotOptimize(dots);
+	});
+
+	RunBenchmark("Vec3Dot, opaque call", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			dots[i] = OPAQUE_VEC3_DOT(first[i], second[i]);
+		}
+		DoNotOptimize(dots);
+	});
+
+	RunBenchmark("Vec3Cross, inline", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			outputs[i] = Vec3Cross(first[i], second[i]);
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("Vec3Cross, opaque call", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			outputs[i] = OPAQUE_VEC3_CROSS(first[i], second[i]);
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("Vec3Normalize, direct", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			outputs[i] = Vec3Normalize(first[i]);
+		}
+		DoNotOptimize(outputs);
+	});
+
+	RunBenchmark("Vec3Normalize, opaque call", REPS, COUNT, [&]()
+	{
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			outputs[i] = OPAQUE_VEC3_NORMALIZE(first[i]);
+		}
+		DoNotOptimize(outputs);
+	});
+
+	return 0;
+}
@@ -0,0 +1,67 @@
+#include "bench_utils.h"
+#include "ssemat44.h"
+#include "aligned_allocator.h"
+
+using namespace gofxmath;
+
+// TransformVec3Batch with cached and streaming stores (and with input prefetching) over growing arrays.  While the
+// input and output fit in the cache, cached stores win; once they are several times larger than the last-level
+// cache, streaming stores skip the read-for-ownership of every output line and pull ahead.  The size where the
+// STREAMING column drops below the CACHED one is the crossover for this machine.
+namespace
+{
+	const size_t MIN_COUNT = size_t(1) << 12;// 64 KB of output
+	const size_t MAX_COUNT = size_t(1) << 23;// 128 MB of output
+	const size_t ELEMENTS_PER_SIZE = size_t(1) << 26;// each size processes about this many elements in total
+}
+
+int main()
+{
+	// Stored as floats, since __m128 loses its alignment attribute as a template argument
+	HugePageVector<float> inputStorage(MAX_COUNT * 4);
+	HugePageVector<float> outputStorage(MAX_COUNT * 4);
+	SseVec* inputs = reinterpret_cast<SseVec*>(inputStorage.data());
+	SseVec* outputs = reinterpret_cast<SseVec*>(outputStorage.data());
+
+	for (size_t i = 0; i < MAX_COUNT; i++)
+	{
+		inputs[i] = SetSseVec4(-3.0f + (i % 97) * 0.0625f, 1.0f + (i % 13) * 0.25f, 0.5f - (i % 7) * 0.125f, 1.0f);
+		outputs[i] = SetVecZero();
+	}
+
+	const SseMat44 mat = MatrixMultiply(TranslationMatrixFromVec3(SetSseVec4(1.0f, -2.0f, 3.0f, 1.0f)),
+		RotationMatrixFromQuaternion(SetSseVec4(0.5f, -0.5f, 0.5f, 0.5f)));
+
+	std::printf("TransformVec3Batch, cached vs. streaming stores (16-byte SseVecs in and out)\n");
+
+	for (size_t count = MIN_COUNT; count <= MAX_COUNT; count *= 2)
+	{
+		size_t reps = ELEMENTS_PER_SIZE / count;
+		char name[64];
+
+		std::printf("-- %zu KB of output\n", count * sizeof(SseVec) / 1024);
+
+		std::snprintf(name, sizeof(name), "  CACHED");
+		RunBenchmark(name, reps, count, [&]()
+		{
+			TransformVec3Batch(mat, inputs, outputs, count);
+			DoNotOptimize(outputs[0]);
+		});
+
+		std::snprintf(name, sizeof(name), "  STREAMING");
+		RunBenchmark(name, reps, count, [&]()
+		{
+			TransformVec3Batch<StorePolicy::STREAMING>(mat, inputs, outputs, count);
+			DoNotOptimize(outputs[0]);
+		});
+
+		std::snprintf(name, sizeof(name), "  STREAMING, prefetch distance 16");
+		RunBenchmark(name, reps, count, [&]()
+		{
+			TransformVec3Batch<StorePolicy::STREAMING, 16>(mat, inputs, outputs, count);
+			DoNotOptimize(outputs[0]);
+		});
+	}
+
+	return 0;
+}
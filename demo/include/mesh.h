@@ -2,6 +2,7 @@
 #define MESH_DOT_H
 #include "vec2.h"
 #include "vec3.h"
+#include "vec3p.h"
 namespace gofxengine
 {
 #define BUFFER_OFFSET(i) ((void*)(i))
@@ -9,31 +10,31 @@ namespace gofxengine
 	class ColorVertex
 	{
 	public:
-		gofxmath::Vec3 pos;
-		gofxmath::Vec3 color;
+		gofxmath::Vec3P pos;
+		gofxmath::Vec3P color;
 	};
 
 	class ColorVertexNorm
 	{
 	public:
-		gofxmath::Vec3 pos;
-		gofxmath::Vec3 color;
-		gofxmath::Vec3 norm;
+		gofxmath::Vec3P pos;
+		gofxmath::Vec3P color;
+		gofxmath::Vec3P norm;
 	};
 
 	class TexturedVertex
 	{
 	public:
-		gofxmath::Vec3 pos;
+		gofxmath::Vec3P pos;
 		gofxmath::Vec2 uv;
 	};
 
 	class TexturedVertexNorm
 	{
 	public:
-		gofxmath::Vec3 pos;
+		gofxmath::Vec3P pos;
 		gofxmath::Vec2 uv;
-		gofxmath::Vec3 norm;
+		gofxmath::Vec3P norm;
 	};
 }
 
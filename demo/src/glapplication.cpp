@@ -13,6 +13,7 @@
 #include "string_convert.h"
 
 #include "ssemat44.h"
+#include "aligned_allocator.h"
 
 using namespace std;
 using namespace gofxmath;
@@ -45,8 +46,7 @@ namespace gofxengine
 		yaw = yaw > 0 ? (fmodf(yaw + F_PI, F_2PI) - F_PI) : (fmodf(yaw - F_PI, F_2PI) + F_PI);
 
 		// Generate the rotation matrix for the view, and update the camera's relative forward, right, and up directions
-		SseMat44 rotationMat = RotationMatrixFromQuaternion(SseQuaternionFromEuler(pitch, yaw, 0.0f));//RotationMatrixFromEuler(SetSseVec3(pitch, yaw, 0.0f));
-		camFwd = TransformVec3(rotationMat, SetSseVec3(0.0f, 0.0f, 1.0f));
+		camFwd = QuaternionRotateVec3(SseQuaternionFromEuler(pitch, yaw, 0.0f), SetSseVec3(0.0f, 0.0f, 1.0f));
 		camFwd = Vec3Normalize(camFwd);
 		camRt = Vec3Cross(worldUp, camFwd);
 		camUp = Vec3Cross(camFwd, camRt);
@@ -242,7 +242,7 @@ namespace gofxengine
 
 		const int MODEL_COUNT = 6000;
 
-		SseMat44 models[MODEL_COUNT];
+		AlignedVector<SseMat44> models(MODEL_COUNT);
 
 		SseMat44 translation;
 
@@ -339,7 +339,7 @@ namespace gofxengine
 
 		const int MODEL_COUNT = 6000;
 
-		SseMat44 models[MODEL_COUNT];
+		AlignedVector<SseMat44> models(MODEL_COUNT);
 
 		SseMat44 translation;
 
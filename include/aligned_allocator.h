@@ -0,0 +1,297 @@
+#ifndef ALIGNED_ALLOCATOR_DOT_H
+#define ALIGNED_ALLOCATOR_DOT_H
+
+#include "sisd_defns.h"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <malloc.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/*!
+ * \file
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*! \defgroup AlignedMemory Aligned Memory */
+
+	/*!
+	 * \ingroup AlignedMemory
+	 * @{
+	 */
+
+	/*!
+	 * \enum	PagePolicy
+	 *
+	 * \brief	How an AlignedAllocator backs large allocations.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	A 4KB page covers only 256 SseVecs, so walking a large array of transforms or points touches
+	 *			a new page (and may take a TLB miss) every few hundred elements.  A 2MB huge page covers
+	 *			512 times as much.  HUGE_PAGES aligns allocations of at least HUGE_PAGE_SIZE to a huge page
+	 *			boundary, rounds their size up to a whole number of huge pages, and on Linux asks the
+	 *			kernel to back them with transparent huge pages (madvise with MADV_HUGEPAGE).  Elsewhere,
+	 *			or when transparent huge pages are disabled, it only costs the rounding.
+	 */
+	enum PagePolicy
+	{
+		DEFAULT_PAGES = 0,	/*!< Ordinary pages for every allocation. */
+		HUGE_PAGES = 1		/*!< Huge pages for allocations of at least HUGE_PAGE_SIZE bytes. */
+	};
+
+	/*!
+	 * \brief	The size of a huge page on x86-64, and the smallest allocation that PagePolicy::HUGE_PAGES
+	 *			backs with one.
+	 */
+	const size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+	/*!
+	 * \brief	Allocates the given number of bytes at the given alignment.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	bytes	 	The number of bytes to allocate.
+	 * \param	alignment	The alignment of the allocation; a power of two, and at least sizeof(void*).
+	 *
+	 * \return	The allocated memory, which must be released with AlignedFree, or nullptr if it could not be
+	 *			allocated.
+	 */
+	inline void* AlignedMalloc(size_t bytes, size_t alignment)
+	{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+		return _aligned_malloc(bytes, alignment);
+#else
+		void* result = nullptr;
+
+		if (posix_memalign(&result, alignment, bytes) != 0)
+		{
+			return nullptr;
+		}
+
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Releases memory allocated with AlignedMalloc.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	ptr	The memory to release.  May be nullptr.
+	 */
+	inline void AlignedFree(void* ptr)
+	{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+		_aligned_free(ptr);
+#else
+		free(ptr);
+#endif
+	}
+
+	/*!
+	 * \class AlignedAllocator
+	 *
+	 * \brief	A standard allocator that aligns its allocations to at least the given alignment.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	T	  	The type of element being allocated.
+	 * \tparam	align 	The alignment of every allocation, in bytes; a power of two.  It is raised to
+	 *					alignof(T) if that is larger.
+	 * \tparam	pages 	Whether large allocations are backed by huge pages (see PagePolicy).
+	 *
+	 * \remarks	Before C++17, neither new nor std::allocator honor alignments beyond that of max_align_t,
+	 *			so a std::vector of ALIGNED_CLASS(16) types such as SseMat44 or Vec4 is not guaranteed to be
+	 *			aligned (and 32-bit allocators only give 8 bytes).  Use AlignedVector, or HugePageVector for
+	 *			big arrays, instead.
+	 *
+	 *			The default alignment of 16 also lets element types without an alignment of their own,
+	 *			such as float or Vec3P, be loaded with aligned loads and written with streaming stores.
+	 *
+	 *			SseVec is a typedef of __m128, whose alignment attribute GCC drops when it is used as a
+	 *			template argument (with a -Wignored-attributes warning), so it cannot be the element type.
+	 *			Store arrays of SseVecs as four times as many floats and cast the data pointer instead;
+	 *			the allocation is still 16-byte aligned.  The SIMD classes (SseMat44, SseTransform, ...)
+	 *			are unaffected.
+	 */
+	template<typename T, size_t align = 16, PagePolicy pages = DEFAULT_PAGES>
+	class AlignedAllocator
+	{
+		static_assert(align != 0 && (align & (align - 1)) == 0, "the alignment must be a power of two");
+
+	public:
+
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+		/*!
+		 * \brief	The alignment of every allocation: the larger of align, alignof(T) and sizeof(void*).
+		 */
+		static const size_t ALIGNMENT = align > alignof(T) ?
+			(align > sizeof(void*) ? align : sizeof(void*)) :
+			(alignof(T) > sizeof(void*) ? alignof(T) : sizeof(void*));
+
+		/*!
+		 * \brief	Gets the same allocator for another element type.
+		 *
+		 * \remarks	Needed explicitly, since std::allocator_traits can only rebind allocators whose template
+		 *			parameters are all types.
+		 */
+		template<typename U>
+		struct rebind
+		{
+			typedef AlignedAllocator<U, align, pages> other;
+		};
+
+		/*!
+		 * \brief	Constructs an AlignedAllocator.
+		 *
+		 * \date	10/18/2026
+		 */
+		AlignedAllocator() {}
+
+		/*!
+		 * \brief	Constructs an AlignedAllocator from one for another element type.
+		 *
+		 * \date	10/18/2026
+		 */
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U, align, pages>&) {}
+
+		/*!
+		 * \brief	Allocates uninitialized storage for the given number of elements.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	count	The number of elements to allocate.
+		 *
+		 * \return	The allocated storage, aligned to ALIGNMENT (or to HUGE_PAGE_SIZE for large allocations
+		 *			under PagePolicy::HUGE_PAGES).
+		 *
+		 * \exception	std::bad_alloc	Thrown if the storage could not be allocated.
+		 */
+		T* allocate(size_t count)
+		{
+			if (count > max_size())
+			{
+				throw std::bad_alloc();
+			}
+
+			size_t bytes = count * sizeof(T);
+			size_t alignment = ALIGNMENT;
+
+			if (pages == HUGE_PAGES && bytes >= HUGE_PAGE_SIZE)
+			{
+				alignment = HUGE_PAGE_SIZE > ALIGNMENT ? HUGE_PAGE_SIZE : ALIGNMENT;
+				bytes = (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+			}
+
+			void* result = AlignedMalloc(bytes, alignment);
+
+			if (result == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+			if (pages == HUGE_PAGES && bytes >= HUGE_PAGE_SIZE)
+			{
+				madvise(result, bytes, MADV_HUGEPAGE);// only a hint; the memory is usable either way
+			}
+#endif
+
+			return static_cast<T*>(result);
+		}
+
+		/*!
+		 * \brief	Releases storage allocated by allocate.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	ptr	The storage to release.
+		 */
+		void deallocate(T* ptr, size_t)
+		{
+			AlignedFree(ptr);
+		}
+
+		/*!
+		 * \brief	Gets the largest number of elements that can be allocated at once.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \return	The largest number of elements that allocate accepts.
+		 */
+		size_t max_size() const
+		{
+			return (size_t(-1) - HUGE_PAGE_SIZE) / sizeof(T);
+		}
+	};
+
+	template<typename T, size_t align, PagePolicy pages>
+	const size_t AlignedAllocator<T, align, pages>::ALIGNMENT;
+
+	/*!
+	 * \brief	Equality operator; all AlignedAllocators with the same alignment and page policy are
+	 *			interchangeable.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	true.
+	 */
+	template<typename T, typename U, size_t align, PagePolicy pages>
+	inline bool operator==(const AlignedAllocator<T, align, pages>&, const AlignedAllocator<U, align, pages>&)
+	{
+		return true;
+	}
+
+	/*!
+	 * \brief	Inequality operator.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	false.
+	 */
+	template<typename T, typename U, size_t align, PagePolicy pages>
+	inline bool operator!=(const AlignedAllocator<T, align, pages>&, const AlignedAllocator<U, align, pages>&)
+	{
+		return false;
+	}
+
+	/*!
+	 * \brief	A std::vector whose storage is aligned to at least 16 bytes (see AlignedAllocator).  Use a
+	 *			vector of floats, not of SseVecs, for SseVec arrays.
+	 */
+	template<typename T, size_t align = 16>
+	using AlignedVector = std::vector<T, AlignedAllocator<T, align, DEFAULT_PAGES>>;
+
+	/*!
+	 * \brief	A std::vector whose storage is aligned to at least 16 bytes, and backed by huge pages once it
+	 *			reaches HUGE_PAGE_SIZE bytes (see PagePolicy).  Meant for large transform, point and vertex
+	 *			arrays.
+	 */
+	template<typename T, size_t align = 16>
+	using HugePageVector = std::vector<T, AlignedAllocator<T, align, HUGE_PAGES>>;
+
+	/*! @} */
+}
+#endif // ALIGNED_ALLOCATOR_DOT_H
@@ -0,0 +1,274 @@
+#ifndef MAT33_DOT_H
+#define MAT33_DOT_H
+
+
+#include "vec3.h"
+#include "mat44.h"
+#include "sisd_defns.h"
+#include <string>
+#include <sstream>
+
+/*!
+ * \file
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SISDMatMath
+	 * @{
+	 */
+
+	ALIGNED_CLASS(16) SseMat33;
+
+	/*!
+	 * \class	Mat33
+	 *
+	 * \brief 3x3 Column Matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	Meant for rotations, normal matrices, and symmetric tensors (covariance, inertia), which
+	 *			have no translation or projection and so do not need the 16 floats of a Mat44.  There is
+	 *			no matrixTypeVal; functions that can fail document how they report it.
+	 */
+	ALIGNED_CLASS(16) Mat33
+	{
+	public:
+
+		/*!
+		 * \brief Constructs a Mat33 with all three column vectors being initialized to 0 vectors.
+		 *
+		 * \date	10/18/2026
+		 */
+		constexpr Mat33() : col0(Vec3()),
+							 col1(Vec3()),
+							 col2(Vec3()) {}
+
+		/*!
+		 * \brief	Constructs a Mat33 with all three column vectors being initialized to the given 3D
+		 * 			vectors.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	c0	The first column.
+		 * \param	c1	The second column.
+		 * \param	c2	The third column.
+		 */
+		constexpr Mat33(const Vec3& c0, const Vec3& c1, const Vec3& c2) :
+			col0(c0),
+			col1(c1),
+			col2(c2) {}
+
+		/*!
+		 * \brief	Constructs a Mat33 with all 3 column vectors being initialized to the given scalar
+		 * 			values.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	m00	Row 0 Col 0 Value.
+		 * \param	m01	Row 0 Col 1 Value.
+		 * \param	m02	Row 0 Col 2 Value.
+		 *
+		 * \param	m10	Row 1 Col 0 Value.
+		 * \param	m11	Row 1 Col 1 Value.
+		 * \param	m12	Row 1 Col 2 Value.
+		 *
+		 * \param	m20	Row 2 Col 0 Value.
+		 * \param	m21	Row 2 Col 1 Value.
+		 * \param	m22	Row 2 Col 2 Value.
+		 */
+		constexpr Mat33(float m00, float m01, float m02,
+			float m10, float m11, float m12,
+			float m20, float m21, float m22) :
+			col0(Vec3(m00, m10, m20)),
+			col1(Vec3(m01, m11, m21)),
+			col2(Vec3(m02, m12, m22)) {}
+
+		/*!
+		 * \brief	Constructs a Mat33 from the upper 3x3 of the given 4x4 matrix.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The matrix to take the rotation/scale part of.
+		 */
+		constexpr explicit Mat33(const Mat44& mat) :
+			col0(Vec3(mat.col0.x, mat.col0.y, mat.col0.z)),
+			col1(Vec3(mat.col1.x, mat.col1.y, mat.col1.z)),
+			col2(Vec3(mat.col2.x, mat.col2.y, mat.col2.z)) {}
+
+		/*!
+		 * \brief Copies the values from the given matrix's columns into the respective columns of this matrix.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The matrix to convert.
+		 */
+		Mat33(const SseMat33& mat);
+
+		/*!
+		 * \brief Stream insertion operator.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param [in,out]	stream	The stream.
+		 * \param	mat			  	The matrix.
+		 *
+		 * \return	The shifted result.
+		 */
+		friend std::ostream &operator << (std::ostream& stream, const Mat33& mat);
+
+		/*!
+		 * \brief Stream extraction operator.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param [in,out]	stream	The stream.
+		 * \param [in,out]	mat   	The matrix.
+		 *
+		 * \return	The shifted result.
+		 */
+		friend std::istream &operator >> (std::istream& stream, Mat33& mat);
+
+		/*!
+		 * \brief Equality operator.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	left 	The first instance to compare.
+		 * \param	right	The second instance to compare.
+		 *
+		 * \return	true if the parameters are considered equivalent.
+		 */
+		friend bool operator==(const Mat33& left, const Mat33& right);
+
+		/*!
+		 * \brief Inequality operator.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	left 	The first instance to compare.
+		 * \param	right	The second instance to compare.
+		 *
+		 * \return	true if the parameters are not considered equivalent.
+		 */
+		friend bool operator!=(const Mat33& left, const Mat33& right);
+
+		/*!
+		 * \brief Prints the given matrix.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The matrix.
+		 */
+		friend void Print(const Mat33& mat);
+
+		/*!
+		 * \brief Converts a mat to a console debug string.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The matrix.
+		 *
+		 * \return	mat as a std::string.
+		 */
+		friend std::string ToConsoleDebugString(const Mat33& mat);
+
+		/*!
+		 * \brief Gets the column associated with the given index.
+		 *
+		 * \param	arg	The given index.
+		 *
+		 * \return The column associated with the given index (0 for col0, 1 for col1, etc.).
+		 */
+		inline const Vec3& operator[](int arg) const
+		{
+			switch (arg)
+			{
+			case 0:
+				return col0;
+			case 1:
+				return col1;
+			case 2:
+				return col2;
+			}
+
+			std::ostringstream msgStream;
+			msgStream << "Value " << arg << " is not valid.  Use an int value between 0 and 2 (inclusive).";
+			throw std::invalid_argument(msgStream.str().c_str());
+		}
+
+		/*!
+		 * \brief	Gets/Sets the column associated with the given index.
+		 *
+		 * \param	arg	The given index.
+		 *
+		 * \return The column associated with the given index (0 for col0, 1 for col1, etc.).
+		 */
+		inline Vec3& operator[](int arg)
+		{
+			switch (arg)
+			{
+			case 0:
+				return col0;
+			case 1:
+				return col1;
+			case 2:
+				return col2;
+			}
+
+			std::ostringstream msgStream;
+			msgStream << "Value " << arg << " is not valid.  Use an int value between 0 and 2 (inclusive).";
+			throw std::invalid_argument(msgStream.str().c_str());
+		}
+
+		/*!
+		 * \brief	Gets a column of this matrix, without the range check of operator[].
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	arg	The index of the column to get, between 0 and 2 (inclusive); not checked.
+		 *
+		 * \return The column associated with the given index (0 for col0, 1 for col1, etc.).
+		 *
+		 * \remarks	The switch and throw in operator[] keep the compiler from unrolling and vectorizing the
+		 *			loops that use it, so the matrix functions index through this instead.  The columns are
+		 *			separate members rather than an array, so this looks them up in a table of member
+		 *			pointers (which folds away for a constant index) instead of offsetting from col0.
+		 */
+		inline const Vec3& Col(int arg) const
+		{
+			static constexpr Vec3 Mat33::* const COLUMNS[3] = { &Mat33::col0, &Mat33::col1, &Mat33::col2 };
+			return this->*COLUMNS[arg];
+		}
+
+		/*!
+		 * \brief	Gets/Sets a column of this matrix, without the range check of operator[].
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	arg	The index of the column to get, between 0 and 2 (inclusive); not checked.
+		 *
+		 * \return The column associated with the given index (0 for col0, 1 for col1, etc.).
+		 */
+		inline Vec3& Col(int arg)
+		{
+			static constexpr Vec3 Mat33::* const COLUMNS[3] = { &Mat33::col0, &Mat33::col1, &Mat33::col2 };
+			return this->*COLUMNS[arg];
+		}
+
+		Vec3 col0;/*!< The first column of this matrix */
+		Vec3 col1;/*!< The second column of this matrix */
+		Vec3 col2;/*!< The third column of this matrix */
+
+		static constexpr Mat33 Identity() { return Mat33(Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f)); }	/*!< The 3x3 identity matrix. */
+	};
+	/*!@}*/
+}
+
+#endif // MAT33_DOT_H
@@ -26,14 +26,79 @@ namespace gofxmath
 	/*!
 	 * \brief The type of matrix being used.
 	 * \enum	MatrixType
+	 *
+	 * \remarks	Each class is a set of structure bits (translation 0x2, rotation 0x4, uniform scale 0x8,
+	 *			general linear 0x10, projective 0x20) on top of the IDENTITY bit, so that a more general
+	 *			class always contains the bits of the classes it generalizes. Use CombineMatrixTypes to
+	 *			find the class of a product.
+	 *
+	 *			The matrix functions use the class to pick cheaper paths (for instance a transpose-based
+	 *			MatrixInverse for RIGID matrices), so a matrix whose values are edited by hand should have
+	 *			its matrixTypeVal set to the most specific class that still holds (MISC when unsure).
 	 */
 	enum MatrixType
 	{
-		IDENTITY = 0x1,
-		MISC = 0x3,
-		INVALID = -1
+		IDENTITY = 0x1,			/*!< The identity matrix. */
+		TRANSLATION = 0x3,		/*!< A pure translation (identity upper 3x3). */
+		ROTATION = 0x5,			/*!< A pure rotation (orthonormal upper 3x3, no translation). */
+		RIGID = 0x7,			/*!< A rotation followed by a translation. */
+		UNIFORM_SCALE = 0x9,	/*!< A pure scale by the same factor along every axis. */
+		AFFINE = 0x1F,			/*!< Any matrix with a bottom row of <0 0 0 1>. */
+		PROJECTIVE = 0x3F,		/*!< Any matrix (the bottom row may be arbitrary). */
+		MISC = PROJECTIVE,		/*!< A matrix with no known structure; treated as PROJECTIVE. */
+		INVALID = -1			/*!< The result of a failed operation, such as inverting a singular matrix. */
 	};
 
+	/*!
+	 * \brief	Finds the MatrixType of the product of two matrices of the given types.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	first 	The type of one factor.
+	 * \param	second	The type of the other factor.
+	 *
+	 * \return	The most specific MatrixType that is guaranteed to hold for the product (in either order).
+	 *
+	 * \remarks	Translations and rotations compose into RIGID; a uniform scale combined with either
+	 *			becomes AFFINE; anything combined with PROJECTIVE stays PROJECTIVE, and INVALID is
+	 *			contagious.
+	 */
+	constexpr MatrixType CombineMatrixTypes(MatrixType first, MatrixType second)
+	{
+		return (first == MatrixType::INVALID || second == MatrixType::INVALID) ? MatrixType::INVALID
+			: (((first | second) & 0x8) != 0 && ((first | second) & 0x6) != 0) ? static_cast<MatrixType>(first | second | MatrixType::AFFINE)
+			: static_cast<MatrixType>(first | second);
+	}
+
+	/*!
+	 * \brief	Checks whether matrices of the given type are known to have a bottom row of <0 0 0 1>.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	type	The matrix type.
+	 *
+	 * \return	true if the type is IDENTITY, TRANSLATION, ROTATION, RIGID, UNIFORM_SCALE or AFFINE.
+	 */
+	constexpr bool MatrixTypeIsAffine(MatrixType type)
+	{
+		return type != MatrixType::INVALID && (type & 0x20) == 0;
+	}
+
+	/*!
+	 * \brief	Checks whether matrices of the given type are known to be rigid (an orthonormal upper
+	 *			3x3 and a translation).
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	type	The matrix type.
+	 *
+	 * \return	true if the type is IDENTITY, TRANSLATION, ROTATION or RIGID.
+	 */
+	constexpr bool MatrixTypeIsRigid(MatrixType type)
+	{
+		return type != MatrixType::INVALID && (type & ~MatrixType::RIGID) == 0;
+	}
+
 	ALIGNED_CLASS(16) SseMat44;
 
 	/*!
@@ -52,7 +117,10 @@ namespace gofxmath
 		 *
 		 * \date	2/21/2015
 		 */
-		Mat44();
+		constexpr Mat44() : col0(Vec4()),
+							 col1(Vec4()),
+							 col2(Vec4()),
+							 col3(Vec4()), matrixTypeVal(MatrixType::MISC) {}
 
 		/*!
 		 * \brief	Constructs a Mat44 with all four column vectors being initialized to the given 4D
@@ -66,7 +134,12 @@ namespace gofxmath
 		 * \param	c3			 	The fourth column.
 		 * \param	matrixTypeVal	The matrix type value.
 		 */
-		Mat44(const Vec4& c0, const Vec4& c1, const Vec4& c2, const Vec4& c3, MatrixType matrixTypeVal = MatrixType::MISC);
+		constexpr Mat44(const Vec4& c0, const Vec4& c1, const Vec4& c2, const Vec4& c3, MatrixType matrixTypeVal = MatrixType::MISC) :
+			col0(c0),
+			col1(c1),
+			col2(c2),
+			col3(c3),
+			matrixTypeVal(matrixTypeVal) {}
 
 		/*!
 		 * \brief	Constructs a Mat44 with all 4 column vectors being initialized to the given scalar
@@ -96,11 +169,16 @@ namespace gofxmath
 		 *
 		 * \param	matrixTypeVal	The matrix type value.
 		 */
-		Mat44(float m00, float m10, float m20, float m30,
-			float m01, float m11, float m21, float m31,
-			float m02, float m12, float m22, float m32,
-			float m03, float m13, float m23, float m33,
-			MatrixType matrixTypeVal = MatrixType::MISC);
+		constexpr Mat44(float m00, float m01, float m02, float m03,
+			float m10, float m11, float m12, float m13,
+			float m20, float m21, float m22, float m23,
+			float m30, float m31, float m32, float m33,
+			MatrixType matrixTypeVal = MatrixType::MISC) :
+			col0(Vec4(m00, m10, m20, m30)),
+			col1(Vec4(m01, m11, m21, m31)),
+			col2(Vec4(m02, m12, m22, m32)),
+			col3(Vec4(m03, m13, m23, m33)),
+			matrixTypeVal(matrixTypeVal) {}
 
 		/*!
 		 * \brief Copies the values from the given matrix's columns into the respective columns of this matrix,
@@ -119,7 +197,11 @@ namespace gofxmath
 		 *
 		 * \param	mat	The matrix.
 		 */
-		Mat44(const Mat44& mat);
+		constexpr Mat44(const Mat44& mat) : col0(mat.col0),
+										col1(mat.col1),
+										col2(mat.col2),
+										col3(mat.col3),
+										matrixTypeVal(mat.matrixTypeVal) {}
 
 		/*!
 		 * \brief Stream insertion operator.
@@ -241,6 +323,41 @@ namespace gofxmath
 			throw std::invalid_argument(msgStream.str().c_str());
 		}
 
+		/*!
+		 * \brief	Gets a column of this matrix, without the range check of operator[].
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	arg	The index of the column to get, between 0 and 3 (inclusive); not checked.
+		 *
+		 * \return The column associated with the given index (0 for col0, 1 for col1, etc.).
+		 *
+		 * \remarks	The switch and throw in operator[] keep the compiler from unrolling and vectorizing the
+		 *			loops that use it, so the matrix functions index through this instead.  The columns are
+		 *			separate members rather than an array, so this looks them up in a table of member
+		 *			pointers (which folds away for a constant index) instead of offsetting from col0.
+		 */
+		inline const Vec4& Col(int arg) const
+		{
+			static constexpr Vec4 Mat44::* const COLUMNS[4] = { &Mat44::col0, &Mat44::col1, &Mat44::col2, &Mat44::col3 };
+			return this->*COLUMNS[arg];
+		}
+
+		/*!
+		 * \brief	Gets/Sets a column of this matrix, without the range check of operator[].
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	arg	The index of the column to get, between 0 and 3 (inclusive); not checked.
+		 *
+		 * \return The column associated with the given index (0 for col0, 1 for col1, etc.).
+		 */
+		inline Vec4& Col(int arg)
+		{
+			static constexpr Vec4 Mat44::* const COLUMNS[4] = { &Mat44::col0, &Mat44::col1, &Mat44::col2, &Mat44::col3 };
+			return this->*COLUMNS[arg];
+		}
+
 		Vec4 col0;/*!< The first column of this matrix */
 		Vec4 col1;/*!< The second column of this matrix */
 		Vec4 col2;/*!< The third column of this matrix */
@@ -248,7 +365,7 @@ namespace gofxmath
 
 		MatrixType matrixTypeVal;   /*!< The matrix type value */
 
-		static Mat44 Identity();	/*!< The 4x4 identity matrix. */
+		static constexpr Mat44 Identity() { return Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4::E3(), MatrixType::IDENTITY); }	/*!< The 4x4 identity matrix. */
 	};
 	/*!@}*/
 }
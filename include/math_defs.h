@@ -1,6 +1,9 @@
 #ifndef MATH_DEFS_DOT_H
 #define MATH_DEFS_DOT_H
 #include <array>
+#include <cstddef>
+#include <limits>
+#include "sisd_defns.h"
 
 /*! \file */
 
@@ -23,42 +26,60 @@ namespace gofxmath
 	 */
 	typedef unsigned int MaskVal;
 
-	const float DEG_TO_RAD = 0.01745329251994329576923690768489f;   /*!<  Degrees to radians conversion factor (%%\\frac{\\pi}{180}%%) */
-	const float F_PI_4 = 0.78539816339744830961566084581988f;		/*!<  %%\\frac{\\pi}{4}%% */
-	const float F_PI_3 = 1.0471975511965977461542144610932f;		/*!<  %%\\frac{\\pi}{3}%% */
-	const float F_PI_2 = 1.5707963267948966192313216916398f;		/*!<  %%\\frac{\\pi}{2}%% */
-	const float F_2PI_3 = 2.0943951023931954923084289221863f;		/*!<  %%\\frac{2\\pi}{3}%% */
-	const float F_3PI_4 = 2.3561944901923449288469825374596f;		/*!<  %%\\frac{3\\pi}{4}%% */
-	const float F_PI = 3.1415926535897932384626433832795f;			/*!<  %%\\pi%% */
-	const float F_PI2 = 9.8696044010893586188344909998762f;			/*!<  %%\\pi^2%% */
-	const float F_4PI_3 = 4.1887902047863909846168578443727f;		/*!<  %%\\frac{4\\pi}{3}%% */
-	const float F_3PI_2 = 4.7123889803846898576939650749193f;		/*!<  %%\\frac{3\\pi}{2}%% */
-	const float F_2PI = 6.283185307179586476925286766559f;			/*!<  %%2\\pi%% */
-	const float F_1_2PI = 0.15915494309189533576888376337251f;		/*!<  %%\\frac{1}{2\\pi}%% */
-	const float F_2_PI = 0.63661977236758134307553505349006f;		/*!<  %%\\frac{2}{\\pi}%% */
-	const float F_4_PI = 1.2732395447351626861510701069801f;		/*!<  %%\\frac{4}{\\pi}%% */
-	const float F_4_PI2 = 0.40528473456935108577551785283891f;		/*!<  %%\\frac{4}{\\pi^2}%% */
-	const float F_NEG4_PI2 = -0.40528473456935108577551785283891f;  /*!<  %%\\frac{-4}{\\pi^2}%% */
-	const float F_SQRT2 = 1.4142135623730950488016887242097f;		/*!<  %%\\sqrt{2}%% */
-	const float F_1_SQRT2 = 0.70710678118654752440084436210485f;	/*!<  %%\\frac{1}{\\sqrt{2}}%% */
-	const float F_1_SQRT3 = 0.57735026918962576450914878050196f;	/*!<  %%\\frac{1}{\\sqrt{3}}%% */
-	const float F_SQRT3_2 = 0.86602540378443864676372317075294f;	/*!<  %%\\frac{\\sqrt{3}}{2}%% */
-	const float F_SQRT3 = 1.7320508075688772935274463415059f;		/*!<  %%\\sqrt{3}%% */
+	constexpr float DEG_TO_RAD = 0.01745329251994329576923690768489f;   /*!<  Degrees to radians conversion factor (%%\\frac{\\pi}{180}%%) */
+	constexpr float F_PI_4 = 0.78539816339744830961566084581988f;		/*!<  %%\\frac{\\pi}{4}%% */
+	constexpr float F_PI_3 = 1.0471975511965977461542144610932f;		/*!<  %%\\frac{\\pi}{3}%% */
+	constexpr float F_PI_2 = 1.5707963267948966192313216916398f;		/*!<  %%\\frac{\\pi}{2}%% */
+	constexpr float F_2PI_3 = 2.0943951023931954923084289221863f;		/*!<  %%\\frac{2\\pi}{3}%% */
+	constexpr float F_3PI_4 = 2.3561944901923449288469825374596f;		/*!<  %%\\frac{3\\pi}{4}%% */
+	constexpr float F_PI = 3.1415926535897932384626433832795f;			/*!<  %%\\pi%% */
+	constexpr float F_PI2 = 9.8696044010893586188344909998762f;			/*!<  %%\\pi^2%% */
+	constexpr float F_4PI_3 = 4.1887902047863909846168578443727f;		/*!<  %%\\frac{4\\pi}{3}%% */
+	constexpr float F_3PI_2 = 4.7123889803846898576939650749193f;		/*!<  %%\\frac{3\\pi}{2}%% */
+	constexpr float F_2PI = 6.283185307179586476925286766559f;			/*!<  %%2\\pi%% */
+	constexpr float F_1_2PI = 0.15915494309189533576888376337251f;		/*!<  %%\\frac{1}{2\\pi}%% */
+	constexpr float F_2_PI = 0.63661977236758134307553505349006f;		/*!<  %%\\frac{2}{\\pi}%% */
+	constexpr float F_4_PI = 1.2732395447351626861510701069801f;		/*!<  %%\\frac{4}{\\pi}%% */
+	constexpr float F_4_PI2 = 0.40528473456935108577551785283891f;		/*!<  %%\\frac{4}{\\pi^2}%% */
+	constexpr float F_NEG4_PI2 = -0.40528473456935108577551785283891f;  /*!<  %%\\frac{-4}{\\pi^2}%% */
+	constexpr float F_SQRT2 = 1.4142135623730950488016887242097f;		/*!<  %%\\sqrt{2}%% */
+	constexpr float F_1_SQRT2 = 0.70710678118654752440084436210485f;	/*!<  %%\\frac{1}{\\sqrt{2}}%% */
+	constexpr float F_1_SQRT3 = 0.57735026918962576450914878050196f;	/*!<  %%\\frac{1}{\\sqrt{3}}%% */
+	constexpr float F_SQRT3_2 = 0.86602540378443864676372317075294f;	/*!<  %%\\frac{\\sqrt{3}}{2}%% */
+	constexpr float F_SQRT3 = 1.7320508075688772935274463415059f;		/*!<  %%\\sqrt{3}%% */
+	constexpr float F_TAN_PI_8 = 0.41421356237309504880168872420970f;	/*!<  %%\\tan(\\frac{\\pi}{8}) = \\sqrt{2} - 1%% */
+	constexpr float F_TAN_3PI_8 = 2.4142135623730950488016887242097f;	/*!<  %%\\tan(\\frac{3\\pi}{8}) = \\sqrt{2} + 1%% */
+	constexpr float F_LN2 = 0.69314718055994530941723212145818f;		/*!<  %%\\ln(2)%% */
+	constexpr float F_LN2_HI = 0.693359375f;							/*!<  The leading bits of %%\\ln(2)%%, exact in single precision so that %%n\\ln(2)%% can be subtracted without rounding */
+	constexpr float F_LN2_LO = -2.12194440054690582767e-4f;			/*!<  %%\\ln(2)%% - F_LN2_HI */
+	constexpr float F_LOG2E = 1.4426950408889634073599246810019f;		/*!<  %%\\log_2(e) = \\frac{1}{\\ln(2)}%% */
+	constexpr float F_PI_2_HI = 1.5703125f;							/*!<  The leading 8 bits of %%\\frac{\\pi}{2}%%, so that %%k\\frac{\\pi}{2}%% can be subtracted without rounding for %%|k| < 2^{16}%% */
+	constexpr float F_PI_2_MID = 4.84466552734375e-4f;				/*!<  The next 8 bits of %%\\frac{\\pi}{2}%% after F_PI_2_HI */
+	constexpr float F_PI_2_LO = -6.397578431e-7f;					/*!<  %%\\frac{\\pi}{2}%% - F_PI_2_HI - F_PI_2_MID */
 
 	/*!
 	 * \brief %%\\epsilon%% (epsilon) is the smallest single-precision floating point value such that %%1.0%%f%% + \\epsilon \\not= 1.0%%f 
 	 */
-	float Epsilon();
+	constexpr float Epsilon()
+	{
+		return std::numeric_limits<float>::epsilon();
+	}
 
 	/*!
 	 * \brief Single-precision floating point representation of %%\\infty%%
 	 */
-	float Infinity();
+	constexpr float Infinity()
+	{
+		return std::numeric_limits<float>::infinity();
+	}
 
 	/*!
 	 * \brief Maximum possible value for a single-precision floating point number such that the number is not %%\\infty%%.
 	 */
-	float FloatMax();
+	constexpr float FloatMax()
+	{
+		return std::numeric_limits<float>::max();
+	}
 
 	const MaskVal F_SIGN_BIT = 0x80000000;	/*!< Mask for the sign bit for standard floating point numbers. */
 
@@ -84,6 +105,20 @@ namespace gofxmath
 		LOW = 4				/*!< The low precision option */
 	};
 
+	/*!
+	 * \enum	AngleReduction
+	 *
+	 * \brief	Values that represent the range reductions available to the trig approximations.
+	 *
+	 * \remarks Used as template arguments for the sine, cosine, tangent and cotangent
+	 *			approximations.
+	 */
+	enum AngleReduction
+	{
+		SINGLE_STEP = 0,	/*!< Subtracts the nearest multiple of %%2\\pi%% in a single step (NormalizeAngle).  Cheapest, but loses accuracy as the angles grow. */
+		CODY_WAITE = 1		/*!< Subtracts the nearest multiple of %%\\frac{\\pi}{2}%% in three exact steps and keeps the quadrant.  Accurate for %%|x| < 10^5%%. */
+	};
+
 	const size_t NUM_TRIG_COEFS = 16;   /*!< Maximum number of trig coefficients supported by IEEE 754 single-precision floating point numbers - assuming a taylor approximation. */
 	const size_t NUM_PRECISION_VALS = 5;	/*!< Number of precision values */
 
@@ -143,6 +178,364 @@ namespace gofxmath
 		return COS_COEFS[i];
 	}
 
+	const size_t NUM_MINIMAX_TRIG_COEFS = 7;	/*!< Maximum number of coefficients in any of the minimax trig polynomials. */
+
+	/*! \brief The number of coefficients used by the sine minimax polynomial, indexed by FloatPrecision.  \sa SinMinimaxTerms */
+	constexpr std::array<int, NUM_PRECISION_VALS> SIN_MINIMAX_TERMS{ { 5, 4, 3, 2, 2 } };
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the sine minimax polynomial at the given precision level.
+	 *
+	 * \sa SinMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR int SinMinimaxTerms()
+	{
+		return SIN_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*! \brief The sine minimax polynomial coefficients, indexed by FloatPrecision.  \sa SinMinimaxCoef */
+	constexpr std::array<std::array<float, NUM_MINIMAX_TRIG_COEFS>, NUM_PRECISION_VALS> SIN_MINIMAX_COEFS
+	{ {
+		{ {  1.000000000e+00f, -1.666665673e-01f,  8.333025500e-03f, -1.980741945e-04f,  2.601903134e-06f,  0.0f,  0.0f } },//HIGH
+		{ {  9.999990463e-01f, -1.666555405e-01f,  8.311899379e-03f, -1.848813990e-04f,  0.0f,  0.0f,  0.0f } },//MEDIUM_HIGH
+		{ {  9.998918176e-01f, -1.659601182e-01f,  7.602903526e-03f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM
+		{ {  9.927877188e-01f, -1.462102830e-01f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM_LOW
+		{ {  9.927877188e-01f, -1.462102830e-01f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f } },//LOW
+	} };
+
+	/*!
+	 * \brief	Returns the ith coefficient of the sine minimax polynomial for the given precision level.
+	 *
+	 * \remarks	The polynomial approximates %%\\sin(x) \\approx x \\sum_{i} c_i x^{2i}%% on the reduced
+	 *			range %%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%, minimizing the maximum relative error.
+	 *			Measured errors of SinApprox / SinSseVec in single precision, over inputs in %%[-\\pi,\\pi)%%:
+	 *				+ gofxmath::FloatPrecision::HIGH (5 terms): max abs error %%1.7*10^{-7}%%, max 3 ULP on the reduced range
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (4 terms): max abs error %%1.1*10^{-6}%%, max 18 ULP on the reduced range
+	 *				+ gofxmath::FloatPrecision::MEDIUM (3 terms): max abs error %%1.1*10^{-4}%%, max 1814 ULP on the reduced range
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (2 terms): max abs error %%7.2*10^{-3}%%
+	 *				+ gofxmath::FloatPrecision::LOW (2 terms): max abs error %%7.2*10^{-3}%%
+	 *
+	 *			These replace the truncated Taylor series from SinCoef, which needed up to nine terms.
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR float SinMinimaxCoef(int i)
+	{
+		return SIN_MINIMAX_COEFS[precisionVal][i];
+	}
+
+	/*! \brief The number of coefficients used by the cosine minimax polynomial, indexed by FloatPrecision.  \sa CosMinimaxTerms */
+	constexpr std::array<int, NUM_PRECISION_VALS> COS_MINIMAX_TERMS{ { 5, 4, 3, 3, 2 } };
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the cosine minimax polynomial at the given precision level.
+	 *
+	 * \sa CosMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR int CosMinimaxTerms()
+	{
+		return COS_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*! \brief The cosine minimax polynomial coefficients, indexed by FloatPrecision.  \sa CosMinimaxCoef */
+	constexpr std::array<std::array<float, NUM_MINIMAX_TRIG_COEFS>, NUM_PRECISION_VALS> COS_MINIMAX_COEFS
+	{ {
+		{ {  9.999999404e-01f, -4.999990463e-01f,  4.166358337e-02f, -1.385370386e-03f,  2.315393249e-05f,  0.0f,  0.0f } },//HIGH
+		{ {  9.999933243e-01f, -4.999124408e-01f,  4.148774967e-02f, -1.271209447e-03f,  0.0f,  0.0f,  0.0f } },//MEDIUM_HIGH
+		{ {  9.994032383e-01f, -4.955808520e-01f,  3.679168224e-02f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM
+		{ {  9.994032383e-01f, -4.955808520e-01f,  3.679168224e-02f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM_LOW
+		{ {  9.719951749e-01f, -4.052847326e-01f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f } },//LOW
+	} };
+
+	/*!
+	 * \brief	Returns the ith coefficient of the cosine minimax polynomial for the given precision level.
+	 *
+	 * \remarks	The polynomial approximates %%\\cos(x) \\approx \\sum_{i} c_i x^{2i}%% on the reduced
+	 *			range %%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%, minimizing the maximum absolute error.
+	 *			Measured errors of CosApprox / CosSseVec in single precision, over inputs in %%[-\\pi,\\pi)%%
+	 *			(ULP errors are measured where %%|\\cos(x)| \\geq \\frac{1}{2}%%, as the absolute error dominates near the roots):
+	 *				+ gofxmath::FloatPrecision::HIGH (5 terms): max abs error %%2.5*10^{-7}%%, max 3 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (4 terms): max abs error %%6.8*10^{-6}%%, max 192 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM (3 terms): max abs error %%6.0*10^{-4}%%
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (3 terms): max abs error %%6.0*10^{-4}%%
+	 *				+ gofxmath::FloatPrecision::LOW (2 terms): max abs error %%2.8*10^{-2}%%
+	 *
+	 *			These replace the truncated Taylor series from CosCoef, which needed up to nine terms.
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR float CosMinimaxCoef(int i)
+	{
+		return COS_MINIMAX_COEFS[precisionVal][i];
+	}
+
+	/*! \brief The number of coefficients used by the tangent minimax polynomial, indexed by FloatPrecision.  \sa TanMinimaxTerms */
+	constexpr std::array<int, NUM_PRECISION_VALS> TAN_MINIMAX_TERMS{ { 7, 5, 4, 3, 2 } };
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the tangent minimax polynomial at the given precision level.
+	 *
+	 * \sa TanMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR int TanMinimaxTerms()
+	{
+		return TAN_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*! \brief The tangent minimax polynomial coefficients, indexed by FloatPrecision.  \sa TanMinimaxCoef */
+	constexpr std::array<std::array<float, NUM_MINIMAX_TRIG_COEFS>, NUM_PRECISION_VALS> TAN_MINIMAX_COEFS
+	{ {
+		{ {  1.000000000e+00f,  3.333307505e-01f,  1.333989054e-01f,  5.334912986e-02f,  2.460087277e-02f,  2.895755460e-03f,  9.498288855e-03f } },//HIGH
+		{ {  1.000003219e+00f,  3.330798149e-01f,  1.365172416e-01f,  4.039837420e-02f,  4.382067174e-02f,  0.0f,  0.0f } },//MEDIUM_HIGH
+		{ {  9.999558330e-01f,  3.355828822e-01f,  1.159758642e-01f,  9.413058311e-02f,  0.0f,  0.0f,  0.0f } },//MEDIUM
+		{ {  1.000614882e+00f,  3.158642948e-01f,  2.023649514e-01f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM_LOW
+		{ {  9.914278984e-01f,  4.391621649e-01f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f } },//LOW
+	} };
+
+	/*!
+	 * \brief	Returns the ith coefficient of the tangent minimax polynomial for the given precision level.
+	 *
+	 * \remarks	The polynomial approximates %%\\tan(x) \\approx x \\sum_{i} c_i x^{2i}%% on the reduced
+	 *			range %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%%, minimizing the maximum relative error.  The rest
+	 *			of the period is covered with %%\\tan(x) = \\frac{1}{\\tan(\\pm\\frac{\\pi}{2} - x)}%%, which keeps
+	 *			the relative error.  Measured errors of TanApprox in single precision, over the reduced range:
+	 *				+ gofxmath::FloatPrecision::HIGH (7 terms): max relative error %%1.6*10^{-8}%%, max 2 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (5 terms): max relative error %%3.2*10^{-6}%%, max 55 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM (4 terms): max relative error %%4.4*10^{-5}%%
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (3 terms): max relative error %%6.2*10^{-4}%%
+	 *				+ gofxmath::FloatPrecision::LOW (2 terms): max relative error %%8.6*10^{-3}%%
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR float TanMinimaxCoef(int i)
+	{
+		return TAN_MINIMAX_COEFS[precisionVal][i];
+	}
+
+	const size_t NUM_MINIMAX_QUADRANT_COEFS = 4;	/*!< Maximum number of coefficients in the quadrant-reduced sine and cosine minimax polynomials. */
+
+	/*! \brief The number of coefficients used by the quadrant-reduced sine minimax polynomial, indexed by FloatPrecision.  \sa SinQuadrantMinimaxTerms */
+	constexpr std::array<int, NUM_PRECISION_VALS> SIN_QUADRANT_MINIMAX_TERMS{ { 4, 3, 2, 2, 2 } };
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the quadrant-reduced sine minimax polynomial at the given precision level.
+	 *
+	 * \sa SinQuadrantMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR int SinQuadrantMinimaxTerms()
+	{
+		return SIN_QUADRANT_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*! \brief The quadrant-reduced sine minimax polynomial coefficients, indexed by FloatPrecision.  \sa SinQuadrantMinimaxCoef */
+	constexpr std::array<std::array<float, NUM_MINIMAX_QUADRANT_COEFS>, NUM_PRECISION_VALS> SIN_QUADRANT_MINIMAX_COEFS
+	{ {
+		{ {  1.000000000e+00f, -1.666665077e-01f,  8.332016878e-03f, -1.950182195e-04f } },//HIGH
+		{ {  9.999985099e-01f, -1.666238159e-01f,  8.150056936e-03f,  0.0f } },//MEDIUM_HIGH
+		{ {  9.995915890e-01f, -1.615350991e-01f,  0.0f,  0.0f } },//MEDIUM
+		{ {  9.995915890e-01f, -1.615350991e-01f,  0.0f,  0.0f } },//MEDIUM_LOW
+		{ {  9.995915890e-01f, -1.615350991e-01f,  0.0f,  0.0f } },//LOW
+	} };
+
+	/*!
+	 * \brief	Returns the ith coefficient of the quadrant-reduced sine minimax polynomial for the given precision level.
+	 *
+	 * \remarks	The polynomial approximates %%\\sin(x) \\approx x \\sum_{i} c_i x^{2i}%% on the reduced
+	 *			range %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%% left by gofxmath::AngleReduction::CODY_WAITE,
+	 *			minimizing the maximum relative error.  The halved range needs one term fewer than
+	 *			SinMinimaxCoef for the same precision level.
+	 *			Measured errors of SinApprox / SinSseVec in single precision, over inputs in %%[-\\pi,\\pi)%% with gofxmath::AngleReduction::CODY_WAITE:
+	 *				+ gofxmath::FloatPrecision::HIGH (4 terms): max abs error %%1.1*10^{-7}%%, max 2 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (3 terms): max abs error %%1.1*10^{-6}%%, max 26 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM (2 terms): max abs error %%2.9*10^{-4}%%
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (2 terms): max abs error %%2.8*10^{-3}%%
+	 *				+ gofxmath::FloatPrecision::LOW (2 terms): max abs error %%2.8*10^{-3}%%
+	 *
+	 *			Odd quadrants take their sines from the cosine polynomial and vice versa, so the errors
+	 *			are shared with CosQuadrantMinimaxCoef.  The bounds hold up to %%|x| = 10^5%%, where the single-step
+	 *			reduction is already off by %%6.7*10^{-3}%%.
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR float SinQuadrantMinimaxCoef(int i)
+	{
+		return SIN_QUADRANT_MINIMAX_COEFS[precisionVal][i];
+	}
+
+	/*! \brief The number of coefficients used by the quadrant-reduced cosine minimax polynomial, indexed by FloatPrecision.  \sa CosQuadrantMinimaxTerms */
+	constexpr std::array<int, NUM_PRECISION_VALS> COS_QUADRANT_MINIMAX_TERMS{ { 4, 4, 3, 2, 2 } };
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the quadrant-reduced cosine minimax polynomial at the given precision level.
+	 *
+	 * \sa CosQuadrantMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR int CosQuadrantMinimaxTerms()
+	{
+		return COS_QUADRANT_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*! \brief The quadrant-reduced cosine minimax polynomial coefficients, indexed by FloatPrecision.  \sa CosQuadrantMinimaxCoef */
+	constexpr std::array<std::array<float, NUM_MINIMAX_QUADRANT_COEFS>, NUM_PRECISION_VALS> COS_QUADRANT_MINIMAX_COEFS
+	{ {
+		{ {  1.000000000e+00f, -4.999988377e-01f,  4.165577888e-02f, -1.359185320e-03f } },//HIGH
+		{ {  1.000000000e+00f, -4.999988377e-01f,  4.165577888e-02f, -1.359185320e-03f } },//MEDIUM_HIGH
+		{ {  1.000000000e+00f, -4.997605681e-01f,  4.045845196e-02f,  0.0f } },//MEDIUM
+		{ {  1.000000000e+00f, -4.785124958e-01f,  0.0f,  0.0f } },//MEDIUM_LOW
+		{ {  1.000000000e+00f, -4.785124958e-01f,  0.0f,  0.0f } },//LOW
+	} };
+
+	/*!
+	 * \brief	Returns the ith coefficient of the quadrant-reduced cosine minimax polynomial for the given precision level.
+	 *
+	 * \remarks	The polynomial approximates %%\\cos(x) \\approx \\sum_{i} c_i x^{2i}%% on the reduced
+	 *			range %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%% left by gofxmath::AngleReduction::CODY_WAITE,
+	 *			minimizing the maximum relative error with %%c_0 = 1%% so that %%\\cos(0)%% is exact.
+	 *			Measured errors of CosApprox / CosSseVec in single precision, over inputs in %%[-\\pi,\\pi)%% with gofxmath::AngleReduction::CODY_WAITE:
+	 *				+ gofxmath::FloatPrecision::HIGH (4 terms): max abs error %%1.1*10^{-7}%%, max 2 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (4 terms): max abs error %%1.1*10^{-6}%%, max 26 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM (3 terms): max abs error %%2.9*10^{-4}%%
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (2 terms): max abs error %%2.8*10^{-3}%%
+	 *				+ gofxmath::FloatPrecision::LOW (2 terms): max abs error %%2.8*10^{-3}%%
+	 *
+	 *			The errors are shared with SinQuadrantMinimaxCoef.
+	 */
+	template<FloatPrecision precisionVal>
+	GOFX_CONSTEXPR float CosQuadrantMinimaxCoef(int i)
+	{
+		return COS_QUADRANT_MINIMAX_COEFS[precisionVal][i];
+	}
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the arctangent minimax polynomial at the given precision level.
+	 *
+	 * \sa AtanMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	inline int AtanMinimaxTerms()
+	{
+		static const std::array<int, NUM_PRECISION_VALS> ATAN_MINIMAX_TERMS{ { 5, 4, 3, 2, 1 } };
+
+		return ATAN_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*!
+	 * \brief	Returns the ith coefficient of the arctangent minimax polynomial for the given precision level.
+	 *
+	 * \remarks	The polynomial approximates %%\\arctan(x) \\approx x \\sum_{i} c_i x^{2i}%% on the reduced
+	 *			range %%[-\\tan(\\frac{\\pi}{8}),\\tan(\\frac{\\pi}{8})]%%, minimizing the maximum relative error.
+	 *			The rest of the real line is covered with %%\\arctan(x) = \\frac{\\pi}{2} - \\arctan(\\frac{1}{x})%%
+	 *			and %%\\arctan(x) = \\frac{\\pi}{4} + \\arctan(\\frac{x - 1}{x + 1})%%.
+	 *			Measured errors of AtanApprox / AtanSseVec in single precision, over all finite inputs:
+	 *				+ gofxmath::FloatPrecision::HIGH (5 terms): max abs error %%1.4*10^{-7}%%, max 3 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (4 terms): max abs error %%3.4*10^{-7}%%, max 10 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM (3 terms): max abs error %%7.2*10^{-6}%%
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (2 terms): max abs error %%2.5*10^{-4}%%
+	 *				+ gofxmath::FloatPrecision::LOW (1 term): max abs error %%1.1*10^{-2}%%
+	 *
+	 *			The same polynomial backs the two-argument, arcsine and arccosine approximations.
+	 */
+	template<FloatPrecision precisionVal>
+	inline float AtanMinimaxCoef(int i)
+	{
+		static const std::array<std::array<float, NUM_MINIMAX_TRIG_COEFS>, NUM_PRECISION_VALS> ATAN_MINIMAX_COEFS
+		{ {
+			{ {  1.000000000e+00f, -3.333279788e-01f,  1.997447014e-01f, -1.385208815e-01f,  7.986737043e-02f,  0.0f,  0.0f } },//HIGH
+			{ {  9.999994636e-01f, -3.332274854e-01f,  1.968109459e-01f, -1.111344323e-01f,  0.0f,  0.0f,  0.0f } },//MEDIUM_HIGH
+			{ {  9.999819994e-01f, -3.313906789e-01f,  1.682293117e-01f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM
+			{ {  9.993640184e-01f, -3.025391698e-01f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM_LOW
+			{ {  9.733372927e-01f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f } },//LOW
+		} };
+
+		return ATAN_MINIMAX_COEFS[precisionVal][i];
+	}
+
+	const size_t NUM_MINIMAX_EXP_COEFS = 7;	/*!< Maximum number of coefficients in the exponential minimax polynomials. */
+	const size_t NUM_MINIMAX_LOG_COEFS = 4;	/*!< Maximum number of coefficients in the logarithm minimax polynomials. */
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the exponential minimax polynomial at the given precision level.
+	 *
+	 * \sa ExpMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	inline int ExpMinimaxTerms()
+	{
+		static const std::array<int, NUM_PRECISION_VALS> EXP_MINIMAX_TERMS{ { 7, 5, 4, 3, 2 } };
+
+		return EXP_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*!
+	 * \brief	Returns the ith coefficient of the exponential minimax polynomial for the given precision level.
+	 *
+	 * \remarks	The polynomial approximates %%e^r \\approx \\sum_{i} c_i r^i%% on the reduced range
+	 *			%%[-\\frac{\\ln(2)}{2},\\frac{\\ln(2)}{2}]%%, minimizing the maximum relative error.
+	 *			The integral power of two is applied separately through the exponent bits.
+	 *			Measured relative errors of ExpSseVec / Exp2SseVec in single precision, over %%[-80,80]%%:
+	 *				+ gofxmath::FloatPrecision::HIGH (7 terms): max relative error %%1.1*10^{-7}%%, max 1 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (5 terms): max relative error %%2.7*10^{-6}%%, max 40 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM (4 terms): max relative error %%7.5*10^{-5}%%
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (3 terms): max relative error %%1.7*10^{-3}%%
+	 *				+ gofxmath::FloatPrecision::LOW (2 terms): max relative error %%3.0*10^{-2}%%
+	 */
+	template<FloatPrecision precisionVal>
+	inline float ExpMinimaxCoef(int i)
+	{
+		static const std::array<std::array<float, NUM_MINIMAX_EXP_COEFS>, NUM_PRECISION_VALS> EXP_MINIMAX_COEFS
+		{ {
+			{ {  1.000000000e+00f,  1.000000000e+00f,  4.999999106e-01f,  1.666641980e-01f,  4.166822508e-02f,  8.374815807e-03f,  1.383684576e-03f } },//HIGH
+			{ {  9.999992847e-01f,  9.999634027e-01f,  5.000435710e-01f,  1.679090708e-01f,  4.145861045e-02f,  0.0f,  0.0f } },//MEDIUM_HIGH
+			{ {  9.999280572e-01f,  1.000164151e+00f,  5.049632788e-01f,  1.656684279e-01f,  0.0f,  0.0f,  0.0f } },//MEDIUM
+			{ {  1.000443101e+00f,  1.014860988e+00f,  4.962585866e-01f,  0.0f,  0.0f,  0.0f,  0.0f } },//MEDIUM_LOW
+			{ {  1.029029965e+00f,  9.897176623e-01f,  0.0f,  0.0f,  0.0f,  0.0f,  0.0f } },//LOW
+		} };
+
+		return EXP_MINIMAX_COEFS[precisionVal][i];
+	}
+
+	/*!
+	 * \brief	Returns the number of coefficients used by the logarithm minimax polynomial at the given precision level.
+	 *
+	 * \sa LogMinimaxCoef
+	 */
+	template<FloatPrecision precisionVal>
+	inline int LogMinimaxTerms()
+	{
+		static const std::array<int, NUM_PRECISION_VALS> LOG_MINIMAX_TERMS{ { 4, 3, 2, 1, 1 } };
+
+		return LOG_MINIMAX_TERMS[precisionVal];
+	}
+
+	/*!
+	 * \brief	Returns the ith coefficient of the logarithm minimax polynomial for the given precision level.
+	 *
+	 * \remarks	With the mantissa %%m%% of the argument reduced to %%[\\frac{\\sqrt{2}}{2},\\sqrt{2})%% and
+	 *			%%s = \\frac{m - 1}{m + 1}%%, the polynomial approximates %%\\ln(m) \\approx 2s \\sum_{i} c_i s^{2i}%%,
+	 *			minimizing the maximum relative error.  The exponent is added back separately.
+	 *			Measured errors of LogSseVec / Log2SseVec in single precision, over all positive finite inputs:
+	 *				+ gofxmath::FloatPrecision::HIGH (4 terms): max 3 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_HIGH (3 terms): max 5 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM (2 terms): max 374 ULP
+	 *				+ gofxmath::FloatPrecision::MEDIUM_LOW (1 term): max abs error %%2.5*10^{-3}%%
+	 *				+ gofxmath::FloatPrecision::LOW (1 term): max abs error %%2.5*10^{-3}%%
+	 */
+	template<FloatPrecision precisionVal>
+	inline float LogMinimaxCoef(int i)
+	{
+		static const std::array<std::array<float, NUM_MINIMAX_LOG_COEFS>, NUM_PRECISION_VALS> LOG_MINIMAX_COEFS
+		{ {
+			{ {  1.000000000e+00f,  3.333340883e-01f,  1.998739690e-01f,  1.496282518e-01f } },//HIGH
+			{ {  1.000000119e+00f,  3.332611322e-01f,  2.064818591e-01f,  0.0f } },//MEDIUM_HIGH
+			{ {  9.999777675e-01f,  3.393399417e-01f,  0.0f,  0.0f } },//MEDIUM
+			{ {  1.004969954e+00f,  0.0f,  0.0f,  0.0f } },//MEDIUM_LOW
+			{ {  1.004969954e+00f,  0.0f,  0.0f,  0.0f } },//LOW
+		} };
+
+		return LOG_MINIMAX_COEFS[precisionVal][i];
+	}
+
 	/*! 
 	 * \brief	Returns the ith single-precision floating point precision limit used for checking approximate
 	 *			equality of two single-precision floating point values.
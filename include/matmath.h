@@ -3,7 +3,9 @@
 
 
 #include <array>
+#include "mat33.h"
 #include "mat44.h"
+#include "vecmath.h"
 
 /*!
  * \file 
@@ -36,9 +38,61 @@ namespace gofxmath
 	 *
 	 * \return	The post-multiplied product of the two matrices.
 	 * 
+	 * \remarks	An IDENTITY factor returns the other factor unchanged, and when both factors are
+	 *			affine (see MatrixTypeIsAffine) the known <0 0 0 1> bottom row is not computed.
+	 *			The result's type is CombineMatrixTypes of the two factors' types.
+	 *
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 MatrixMultiply(const Mat44& first, const Mat44& second);
+	GOFX_CONSTEXPR Mat44 MatrixMultiply(const Mat44& first, const Mat44& second)
+	{
+		if (first.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return second;
+		}
+
+		if (second.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return first;
+		}
+
+		const Vec4 firstCols[4] = { first.col0, first.col1, first.col2, first.col3 };
+		const MatrixType resultType = CombineMatrixTypes(first.matrixTypeVal, second.matrixTypeVal);
+		Vec4 resultCols[4];
+
+		if (MatrixTypeIsAffine(resultType))
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				const Vec4& col = firstCols[j];
+
+				resultCols[j] = Vec4(
+					second.col0.x * col.x + second.col1.x * col.y + second.col2.x * col.z,
+					second.col0.y * col.x + second.col1.y * col.y + second.col2.y * col.z,
+					second.col0.z * col.x + second.col1.z * col.y + second.col2.z * col.z,
+					0.0f);
+			}
+
+			resultCols[3] = Vec4(
+				resultCols[3].x + second.col3.x,
+				resultCols[3].y + second.col3.y,
+				resultCols[3].z + second.col3.z,
+				1.0f);
+
+			return Mat44(resultCols[0], resultCols[1], resultCols[2], resultCols[3], resultType);
+		}
+
+		for (int j = 0; j < 4; j++)
+		{
+			resultCols[j] = Vec4Add(Vec4Add(Vec4Add(
+				Vec4MulScalar(second.col0, firstCols[j].x),
+				Vec4MulScalar(second.col1, firstCols[j].y)),
+				Vec4MulScalar(second.col2, firstCols[j].z)),
+				Vec4MulScalar(second.col3, firstCols[j].w));
+		}
+
+		return Mat44(resultCols[0], resultCols[1], resultCols[2], resultCols[3], resultType);
+	}
 
 	/*!
 	 * \brief Calculates the determinant of the given 4x4 matrix.
@@ -51,7 +105,7 @@ namespace gofxmath
 	 * 
 	 * \relatedalso gofxmath::Mat44
 	 */
-	float MatrixDeterminant(const Mat44& mat);
+	GOFX_SISD_INLINE float MatrixDeterminant(const Mat44& mat);
 
 	/*!
 	 * \brief Calculates the inverse of the given 4x4 matrix.
@@ -62,9 +116,50 @@ namespace gofxmath
 	 *
 	 * \return	The inverse of the given matrix.
 	 * 
+	 * \remarks	Dispatches on the matrix type: IDENTITY is returned as is, rigid types use
+	 *			RigidMatrixInverse, other affine types use AffineMatrixInverse, and only PROJECTIVE
+	 *			(MISC) matrices pay for the full cofactor inverse.
+	 *
+	 * \relatedalso gofxmath::Mat44
+	 */
+	GOFX_SISD_INLINE Mat44 MatrixInverse(const Mat44& mat);
+
+	/*!
+	 * \brief Calculates the inverse of the given rigid (rotation and translation) 4x4 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The rigid matrix to invert.
+	 *
+	 * \return	The inverse of the given matrix: the transposed rotation, and the translation
+	 *			rotated back and negated.
+	 *
+	 * \remarks	The result is only correct when the upper 3x3 of \p mat is orthonormal.
+	 *			MatrixInverse calls this for any matrix whose type satisfies MatrixTypeIsRigid, so rotations
+	 *			from RotationMatrixFromEuler carry the error of its approximated sine and cosine.
+	 *
+	 * \relatedalso gofxmath::Mat44
+	 */
+	GOFX_SISD_INLINE Mat44 RigidMatrixInverse(const Mat44& mat);
+
+	/*!
+	 * \brief Calculates the inverse of the given affine 4x4 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The affine matrix to invert.
+	 *
+	 * \return	The inverse of the given matrix, or a matrix with a MatrixType::INVALID type if
+	 *			the upper 3x3 is singular.
+	 *
+	 * \remarks	Inverts the upper 3x3 from the cross products of its columns and applies the inverse
+	 *			to the negated translation, instead of computing the full 4x4 cofactor matrix.
+	 *			The result is only correct when the bottom row of \p mat is <0 0 0 1>.
+	 *			MatrixInverse calls this for any matrix whose type satisfies MatrixTypeIsAffine.
+	 *
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 MatrixInverse(const Mat44& mat);
+	GOFX_SISD_INLINE Mat44 AffineMatrixInverse(const Mat44& mat);
 
 	/*!
 	 * \brief Calculates the transpose of the given 4x4 matrix.
@@ -75,9 +170,81 @@ namespace gofxmath
 	 *
 	 * \return	The transpose matrix of the given matrix.
 	 * 
+	 * \remarks	IDENTITY, ROTATION and UNIFORM_SCALE matrices keep their type; a transposed
+	 *			translation moves into the bottom row, so any other type becomes PROJECTIVE.
+	 *
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 MatrixTranspose(const Mat44& mat);
+	GOFX_CONSTEXPR Mat44 MatrixTranspose(const Mat44& mat)
+	{
+		return Mat44(
+			Vec4(mat.col0.x, mat.col1.x, mat.col2.x, mat.col3.x),
+			Vec4(mat.col0.y, mat.col1.y, mat.col2.y, mat.col3.y),
+			Vec4(mat.col0.z, mat.col1.z, mat.col2.z, mat.col3.z),
+			Vec4(mat.col0.w, mat.col1.w, mat.col2.w, mat.col3.w),
+			// Translation (0x2) or general linear (0x10) structure moves into the bottom row
+			(mat.matrixTypeVal != MatrixType::INVALID && (mat.matrixTypeVal & 0x12) != 0) ? MatrixType::PROJECTIVE : mat.matrixTypeVal);
+	}
+
+	/*!
+	 * \brief Calculates the 3x3 rotation matrix represented by the given quaternion rotation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	quat	The quaternion rotation to transform into a 3x3 matrix.
+	 *
+	 * \return	The 3x3 rotation matrix (orthonormal, assuming a unit quaternion).
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_CONSTEXPR Mat33 RotationMat33FromQuaternion(const Quaternion& quat)
+	{
+		Vec4 qSqr = Vec4((quat.x * quat.x), (quat.y * quat.y), (quat.z * quat.z), (quat.w * quat.w));
+
+		float twoX = 2.0f * quat.x;
+		float twoY = 2.0f * quat.y;
+		float twoZ = 2.0f * quat.z;
+
+		float xy = twoX * quat.y;
+		float xz = twoX * quat.z;
+		float xw = twoX * quat.w;
+
+		float yz = twoY * quat.z;
+		float yw = twoY * quat.w;
+
+		float zw = twoZ * quat.w;
+
+		//  (ww + xx - yy - zz)		 2(xy + wz)			 2(xz - wy)
+		//		2(xy - wz)		 (ww - xx + yy - zz)	 2(yz + wx)
+		//		2(xz + wy)			 2(yz - wx)		 (ww - xx - yy + zz)
+
+		return Mat33(
+			qSqr.w + qSqr.x - qSqr.y - qSqr.z,	xy - zw,								xz + yw,
+			xy + zw,							qSqr.w - qSqr.x + qSqr.y - qSqr.z,		yz - xw,
+			xz - yw,							yz + xw,								qSqr.w - qSqr.x - qSqr.y + qSqr.z);
+	}
+
+	/*!
+	 * \brief	Expands the given 3x3 matrix into the upper 3x3 of a Mat44, with no translation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat			 	The 3x3 matrix.
+	 * \param	matrixTypeVal	The type to give the result; defaults to MatrixType::AFFINE.
+	 *
+	 * \return	The expanded 4x4 matrix.
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_CONSTEXPR Mat44 ToMat44(const Mat33& mat, MatrixType matrixTypeVal = MatrixType::AFFINE)
+	{
+		return Mat44(
+			Vec4(mat.col0.x, mat.col0.y, mat.col0.z, 0.0f),
+			Vec4(mat.col1.x, mat.col1.y, mat.col1.z, 0.0f),
+			Vec4(mat.col2.x, mat.col2.y, mat.col2.z, 0.0f),
+			Vec4(0.0f, 0.0f, 0.0f, 1.0f),
+			matrixTypeVal);
+	}
 
 	/*!
 	 * \brief Calculates the 4x4 rotation matrix represented by the given quaternion rotation.
@@ -86,11 +253,14 @@ namespace gofxmath
 	 *
 	 * \param	quat	The quaternion rotation to transform into a 4x4 matrix.
 	 *
-	 * \return	A Mat44.
+	 * \return	A Mat44 of type MatrixType::ROTATION (assuming a unit quaternion).
 	 * 
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 RotationMatrixFromQuaternion(const Quaternion& quat);
+	GOFX_CONSTEXPR Mat44 RotationMatrixFromQuaternion(const Quaternion& quat)
+	{
+		return ToMat44(RotationMat33FromQuaternion(quat), MatrixType::ROTATION);
+	}
 
 	/*!
 	 * \brief Calculates the 4x4 rotation matrix represented by the given euler angle rotation.
@@ -99,11 +269,44 @@ namespace gofxmath
 	 *
 	 * \param	angles	The euler angles to use for generating the 4x4 matrix.
 	 *
-	 * \return	The 4x4 rotation matrix represented by the given euler angle rotation.
+	 * \return	The 4x4 rotation matrix represented by the given euler angle rotation, of type MatrixType::ROTATION.
 	 * 
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 RotationMatrixFromEuler(const Vec3& angles);
+	GOFX_CONSTEXPR Mat44 RotationMatrixFromEuler(const Vec3& angles)
+	{
+		float cosPitch = FastCosApprox(angles.x);
+		float cosYaw = FastCosApprox(angles.y);
+		float cosRoll = FastCosApprox(angles.z);
+
+		float sinPitch = FastSinApprox(angles.x);
+		float sinYaw = FastSinApprox(angles.y);
+		float sinRoll = FastSinApprox(angles.z);
+
+		// heading (rotate about y)
+		// attitude (rotate about z)
+		// bank (rotate about x)
+		//
+		// ch*ca	-ch*sa*cb + sh*sb	 ch*sa*sb + sh*cb
+		// sa		 ca*cb				-ca*sb
+		//-sh*ca	 sh*sa*cb + ch*sb	-sh*sa*sb + ch*cb
+
+		return Mat44(
+			Vec4( cosYaw * cosRoll,
+				  sinRoll,
+				 -sinYaw * cosRoll,
+				  0.0f),
+			Vec4(-cosYaw   * sinRoll  * cosPitch  + sinYaw * sinPitch,
+				  cosRoll  * cosPitch,
+				  sinYaw   * sinRoll  * cosPitch  + cosYaw * sinPitch,
+				  0.0f),
+			Vec4( cosYaw   * sinRoll * sinPitch   + sinYaw * cosPitch,
+				 -cosRoll  * sinPitch,
+				 -sinYaw   * sinRoll * sinPitch   + cosYaw * cosPitch,
+				  0.0f),
+			Vec4(0.0f, 0.0f, 0.0f, 1.0f),
+			MatrixType::ROTATION);
+	}
 
 	/*!
 	 * \brief Calculates the 4x4 translation matrix represented by the given 3D position vector.
@@ -112,11 +315,20 @@ namespace gofxmath
 	 *
 	 * \param	vec	The given 3D position vector.
 	 *
-	 * \return	The translation matrix represented by the given 3D position vector.
+	 * \return	The translation matrix represented by the given 3D position vector, of type MatrixType::TRANSLATION.
 	 * 
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 TranslationMatrixFromVec3(const Vec3& vec);
+	GOFX_CONSTEXPR Mat44 TranslationMatrixFromVec3(const Vec3& vec)
+	{
+		Mat44 result(	1.0f, 0.0f, 0.0f, vec.x,
+						0.0f, 1.0f, 0.0f, vec.y,
+						0.0f, 0.0f, 1.0f, vec.z,
+						0.0f, 0.0f, 0.0f, 1.0f,
+						MatrixType::TRANSLATION);
+
+		return result;
+	}
 
 	/*!
 	 * \brief Calculates the 4x4 scale matrix represented by the given 3D scale vector.
@@ -125,11 +337,21 @@ namespace gofxmath
 	 *
 	 * \param	vec	The given 3D scale vector.
 	 *
-	 * \return	The scale matrix represented by the given 3D position vector.
+	 * \return	The scale matrix represented by the given 3D position vector, of type MatrixType::UNIFORM_SCALE
+	 *			when all three components are equal and MatrixType::AFFINE otherwise.
 	 * 
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 ScaleMatrixFromVec3(const Vec3& vec);
+	GOFX_CONSTEXPR Mat44 ScaleMatrixFromVec3(const Vec3& vec)
+	{
+		Mat44 result(vec.x, 0.0f, 0.0f, 0.0f,
+					 0.0f, vec.y, 0.0f, 0.0f,
+					 0.0f, 0.0f, vec.z, 0.0f,
+					 0.0f, 0.0f, 0.0f, 1.0f,
+					 (vec.x == vec.y && vec.y == vec.z) ? MatrixType::UNIFORM_SCALE : MatrixType::AFFINE);
+
+		return result;
+	}
 
 	/*!
 	 * \brief Calculates the right-handed perspective projection matrix.
@@ -162,7 +384,7 @@ namespace gofxmath
 	 * 
 	 * \relatedalso gofxmath::Mat44
 	 */
-	void PerspectiveProjectionMatrix(float near, float far, float fov, float aspect, Mat44& result);
+	GOFX_SISD_INLINE void PerspectiveProjectionMatrix(float near, float far, float fov, float aspect, Mat44& result);
 
 	/*!
 	 * \brief	Calculates the view matrix given the forward direction vector, rather than a target
@@ -176,11 +398,11 @@ namespace gofxmath
      *              unless the camera has a roll/bank rotation that isn't 0, or the
      *              camera has its pitch value at %%\\pm\\frac{\\pi}{2}%% radians (\\pm %%90^{\\circ}%%%).
 	 *
-	 * \return	The calculated view matrix.
+	 * \return	The calculated view matrix, of type MatrixType::RIGID.
 	 * 
 	 * \relatedalso gofxmath::Mat44
 	 */
-	Mat44 LookDir(const Vec3& eye, const Vec3& dir, const Vec3& up);
+	GOFX_SISD_INLINE Mat44 LookDir(const Vec3& eye, const Vec3& dir, const Vec3& up);
 
     /*!
      * \brief Calculates the standard lookat matrix for the camera, given the camera's position, the target's position, and a given "up" vector.
@@ -193,11 +415,11 @@ namespace gofxmath
      *                  unless the camera has a roll/bank rotation that isn't 0, or the
      *                  camera has its pitch value at %%\\pm\\frac{\\pi}{2}%% radians (\\pm %%90^{\\circ}%%%).
      *
-     * \return The calculated view matrix.
+     * \return The calculated view matrix, of type MatrixType::RIGID.
 	 * 
 	 * \relatedalso gofxmath::Mat44
      */
-	Mat44 LookAt(const Vec3& eye, const Vec3& target, const Vec3& up);
+	GOFX_SISD_INLINE Mat44 LookAt(const Vec3& eye, const Vec3& target, const Vec3& up);
 
     /*!
      * \brief Transforms the given 3D vector.
@@ -209,9 +431,29 @@ namespace gofxmath
      *
      * \return The transformed 3D vector.
 	 * 
+	 * \remarks IDENTITY and TRANSLATION matrices skip the 3x3 multiply.
+	 *
 	 * \relatedalso gofxmath::Mat44
      */
-	Vec3 TransformVec3(const Mat44& mat, const Vec3& vec);
+	GOFX_CONSTEXPR Vec3 TransformVec3(const Mat44& mat, const Vec3& vec)
+	{
+		if (mat.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return vec;
+		}
+
+		if (mat.matrixTypeVal == MatrixType::TRANSLATION)
+		{
+			return Vec3(vec.x + mat.col3.x, vec.y + mat.col3.y, vec.z + mat.col3.z);
+		}
+
+		Vec3 result;
+		result.x = (mat.col0.x * vec.x) + (mat.col1.x * vec.y) + (mat.col2.x * vec.z) + mat.col3.x;
+		result.y = (mat.col0.y * vec.x) + (mat.col1.y * vec.y) + (mat.col2.y * vec.z) + mat.col3.y;
+		result.z = (mat.col0.z * vec.x) + (mat.col1.z * vec.y) + (mat.col2.z * vec.z) + mat.col3.z;
+
+		return result;
+	}
 
     /*!
      * \brief Calculates the determinant of the given Mat44
@@ -224,8 +466,155 @@ namespace gofxmath
 	 * 
 	 * \relatedalso gofxmath::Mat44
      */
-	float MatrixDeterminant(const Mat44& mat);
+	GOFX_SISD_INLINE float MatrixDeterminant(const Mat44& mat);
+
+	/*!
+	 * \brief Multiplies the given 3D vector by the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix that will be multiplied against the 3D vector.
+	 * \param	vec	The 3D vector to transform.
+	 *
+	 * \return	The transformed 3D vector.
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_CONSTEXPR Vec3 TransformVec3(const Mat33& mat, const Vec3& vec)
+	{
+		return Vec3(
+			(mat.col0.x * vec.x) + (mat.col1.x * vec.y) + (mat.col2.x * vec.z),
+			(mat.col0.y * vec.x) + (mat.col1.y * vec.y) + (mat.col2.y * vec.z),
+			(mat.col0.z * vec.x) + (mat.col1.z * vec.y) + (mat.col2.z * vec.z));
+	}
+
+	/*!
+	 * \brief Calculates the product (post-multiplication) of the two given 3x3 matrices.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	first 	The left matrix.
+	 * \param	second	The right matrix.
+	 *
+	 * \return	The post-multiplied product of the two matrices, following the same order as
+	 *			MatrixMultiply(const Mat44&, const Mat44&).
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_CONSTEXPR Mat33 MatrixMultiply(const Mat33& first, const Mat33& second)
+	{
+		return Mat33(TransformVec3(second, first.col0), TransformVec3(second, first.col1), TransformVec3(second, first.col2));
+	}
+
+	/*!
+	 * \brief Calculates the transpose of the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to transpose.
+	 *
+	 * \return	The transpose of the given matrix.
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_CONSTEXPR Mat33 MatrixTranspose(const Mat33& mat)
+	{
+		return Mat33(
+			Vec3(mat.col0.x, mat.col1.x, mat.col2.x),
+			Vec3(mat.col0.y, mat.col1.y, mat.col2.y),
+			Vec3(mat.col0.z, mat.col1.z, mat.col2.z));
+	}
+
+	/*!
+	 * \brief Calculates the determinant of the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to find the determinant of.
+	 *
+	 * \return	The determinant, as the triple product of the columns.
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_CONSTEXPR float MatrixDeterminant(const Mat33& mat)
+	{
+		return Vec3Dot(mat.col0, Vec3Cross(mat.col1, mat.col2));
+	}
+
+	/*!
+	 * \brief Calculates the inverse of the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to invert.
+	 *
+	 * \return	The inverse of the given matrix.
+	 *
+	 * \remarks	The rows of the inverse are the cross products of the column pairs over the
+	 *			determinant, the same 3x3 step AffineMatrixInverse uses.  As with the SseMat33 version,
+	 *			there is no branch on the determinant (a fixed threshold would reject well-conditioned
+	 *			matrices with small scales), so a singular input gives non-finite values; check
+	 *			MatrixDeterminant first when that can happen.
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_SISD_INLINE Mat33 MatrixInverse(const Mat33& mat);
+
+	/*!
+	 * \brief Calculates the normal matrix (the inverse transpose of the upper 3x3) of the given matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The model matrix whose normals are being transformed.
+	 *
+	 * \return	The normal matrix.
+	 *
+	 * \remarks	The inverse transpose is the cofactor matrix over the determinant, so its columns are
+	 *			the cross products of the column pairs and no transpose is needed.  For rigid
+	 *			matrices (see MatrixTypeIsRigid) the upper 3x3 is returned as is.  As with the SseMat44
+	 *			version, a singular upper 3x3 gives non-finite values.
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_SISD_INLINE Mat33 NormalMatrix(const Mat44& mat);
+
+	/*!
+	 * \brief	Calculates the unit quaternion represented by the given 3x3 rotation matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The rotation matrix; expected to be orthonormal.
+	 *
+	 * \return	The quaternion, with w kept non-negative.
+	 *
+	 * \remarks	Uses Shepperd's method: the largest of %%4x^2%%, %%4y^2%%, %%4z^2%% and %%4w^2%% recovers its
+	 *			own component, and the others come from the off-diagonals divided by it, which stays
+	 *			accurate for rotations near 180 degrees.
+	 *
+	 * \relatedalso gofxmath::Mat33
+	 */
+	GOFX_SISD_INLINE Quaternion QuaternionFromRotationMatrix(const Mat33& mat);
+
+	/*!
+	 * \brief	Calculates the unit quaternion represented by the upper 3x3 of the given rotation matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The rotation matrix; its upper 3x3 is expected to be orthonormal.
+	 *
+	 * \return	The quaternion, with w kept non-negative.
+	 *
+	 * \relatedalso gofxmath::Mat44
+	 */
+	inline Quaternion QuaternionFromRotationMatrix(const Mat44& mat)
+	{
+		return QuaternionFromRotationMatrix(Mat33(mat));
+	}
 
 	/*! @} */
 }
+
+#if defined(GOFXMATH_INLINE_SISD)
+#include "matmath_impl.h"
+#endif
 #endif // MAT_MATH_DOT_H
\ No newline at end of file
@@ -0,0 +1,318 @@
+#ifndef MAT_MATH_IMPL_DOT_H
+#define MAT_MATH_IMPL_DOT_H
+
+#include "matmath.h"
+#include "vecmath.h"
+#if defined(_MSC_VER)
+#include <cmath>
+#elif defined(__GNUC__) || defined(__MINGW32__)
+#include <cstdlib>
+#endif
+
+/*!
+ * \file
+ *
+ * \brief	The definitions of the out-of-line functions declared in matmath.h.
+ *
+ * \remarks Compiled into the static library by default.  With GOFXMATH_INLINE_SISD defined, matmath.h
+ *			includes this file instead, so that every translation unit sees the bodies and the compiler
+ *			can inline (and vectorize) calls to them without link-time optimization.
+ */
+
+namespace gofxmath
+{
+	GOFX_SISD_INLINE Mat44 MatrixInverse(const Mat44& mat)
+	{
+		if (mat.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return mat;
+		}
+
+		if (MatrixTypeIsRigid(mat.matrixTypeVal))
+		{
+			return RigidMatrixInverse(mat);
+		}
+
+		if (MatrixTypeIsAffine(mat.matrixTypeVal))
+		{
+			return AffineMatrixInverse(mat);
+		}
+
+		float subDetsR0[6] =
+		{
+			mat.Col(2).z * mat.Col(3).w - mat.Col(3).z * mat.Col(2).w, // (22 * 33) - (32 * 23)
+			mat.Col(2).y * mat.Col(3).w - mat.Col(3).y * mat.Col(2).w, // (21 * 33) - (31 * 23)
+			mat.Col(2).y * mat.Col(3).z - mat.Col(3).y * mat.Col(2).z, // (21 * 32) - (31 * 22)
+			mat.Col(2).x * mat.Col(3).w - mat.Col(3).x * mat.Col(2).w, // (20 * 33) - (30 * 23)
+			mat.Col(2).x * mat.Col(3).z - mat.Col(3).x * mat.Col(2).z, // (20 * 32) - (30 * 22)
+			mat.Col(2).x * mat.Col(3).y - mat.Col(3).x * mat.Col(2).y  // (20 * 31) - (30 * 21)
+		};
+
+		Mat44 result;
+		result.Col(0).x = ((mat.Col(1).y * subDetsR0[0]) - (mat.Col(1).z * subDetsR0[1]) + (mat.Col(1).w * subDetsR0[2]));
+		result.Col(1).x = -((mat.Col(1).x * subDetsR0[0]) - (mat.Col(1).z * subDetsR0[3]) + (mat.Col(1).w * subDetsR0[4]));
+		result.Col(2).x = ((mat.Col(1).x * subDetsR0[1]) - (mat.Col(1).y * subDetsR0[3]) + (mat.Col(1).w * subDetsR0[5]));
+		result.Col(3).x = -((mat.Col(1).x * subDetsR0[2]) - (mat.Col(1).y * subDetsR0[4]) + (mat.Col(1).z * subDetsR0[5]));
+
+		float det = (mat.Col(0).x * result.Col(0).x + mat.Col(0).y * result.Col(1).x + mat.Col(0).z * result.Col(2).x + mat.Col(0).w * result.Col(3).x);
+
+
+		if (std::fabs(det) < Epsilon())
+		{
+			result.matrixTypeVal = MatrixType::INVALID;
+			return result;
+		}
+		else
+		{
+			result.matrixTypeVal = mat.matrixTypeVal;
+		}
+
+		float subDetsRest[12] =
+		{
+			mat.Col(1).z * mat.Col(3).w - mat.Col(3).z * mat.Col(1).w,// 0 (12 * 33) - (32 * 13)
+			mat.Col(1).y * mat.Col(3).w - mat.Col(3).y * mat.Col(1).w,// 1 (11 * 33) - (31 * 13)
+			mat.Col(1).y * mat.Col(3).z - mat.Col(3).y * mat.Col(1).z,// 2 (11 * 32) - (31 * 12)
+			mat.Col(1).x * mat.Col(3).w - mat.Col(3).x * mat.Col(1).w,// 3 (10 * 33) - (30 * 13)
+			mat.Col(1).x * mat.Col(3).z - mat.Col(3).x * mat.Col(1).z,// 4 (10 * 32) - (30 * 12)
+			mat.Col(1).x * mat.Col(3).y - mat.Col(3).x * mat.Col(1).y,// 5 (10 * 31) - (30 * 11)
+
+			mat.Col(1).z * mat.Col(2).w - mat.Col(2).z * mat.Col(1).w,// 6  (12 * 23) - (22 * 13)
+			mat.Col(1).y * mat.Col(2).w - mat.Col(2).y * mat.Col(1).w,// 7  (11 * 23) - (21 * 13)
+			mat.Col(1).y * mat.Col(2).z - mat.Col(2).y * mat.Col(1).z,// 8  (11 * 22) - (21 * 12)
+			mat.Col(1).x * mat.Col(2).w - mat.Col(2).x * mat.Col(1).w,// 9  (10 * 23) - (20 * 13)
+			mat.Col(1).x * mat.Col(2).z - mat.Col(2).x * mat.Col(1).z,// 10 (10 * 22) - (20 * 12)
+			mat.Col(1).x * mat.Col(2).y - mat.Col(2).x * mat.Col(1).y // 11 (10 * 21) - (20 * 11)
+		};
+
+		float oneOverDet = 1.0f / det;
+
+		result.Col(0).x *= oneOverDet;
+		result.Col(1).x *= oneOverDet;
+		result.Col(2).x *= oneOverDet;
+		result.Col(3).x *= oneOverDet;
+
+		result.Col(0).y = oneOverDet  * -((mat.Col(0).y * subDetsR0[0]) - (mat.Col(0).z * subDetsR0[1]) + (mat.Col(0).w * subDetsR0[2]));
+		result.Col(1).y = oneOverDet  *  ((mat.Col(0).x * subDetsR0[0]) - (mat.Col(0).z * subDetsR0[3]) + (mat.Col(0).w * subDetsR0[4]));
+		result.Col(2).y = oneOverDet  * -((mat.Col(0).x * subDetsR0[1]) - (mat.Col(0).y * subDetsR0[3]) + (mat.Col(0).w * subDetsR0[5]));
+		result.Col(3).y = oneOverDet  *  ((mat.Col(0).x * subDetsR0[2]) - (mat.Col(0).y * subDetsR0[4]) + (mat.Col(0).z * subDetsR0[5]));
+
+		result.Col(0).z = oneOverDet  *  ((mat.Col(0).y * subDetsRest[0]) - (mat.Col(0).z * subDetsRest[1]) + (mat.Col(0).w * subDetsRest[2]));
+		result.Col(1).z = oneOverDet  * -((mat.Col(0).x * subDetsRest[0]) - (mat.Col(0).z * subDetsRest[3]) + (mat.Col(0).w * subDetsRest[4]));
+		result.Col(2).z = oneOverDet  *  ((mat.Col(0).x * subDetsRest[1]) - (mat.Col(0).y * subDetsRest[3]) + (mat.Col(0).w * subDetsRest[5]));
+		result.Col(3).z = oneOverDet  * -((mat.Col(0).x * subDetsRest[2]) - (mat.Col(0).y * subDetsRest[4]) + (mat.Col(0).z * subDetsRest[5]));
+
+		result.Col(0).w = oneOverDet  * -((mat.Col(0).y * subDetsRest[6]) - (mat.Col(0).z * subDetsRest[7]) + (mat.Col(0).w * subDetsRest[8]));
+		result.Col(1).w = oneOverDet  *  ((mat.Col(0).x * subDetsRest[6]) - (mat.Col(0).z * subDetsRest[9]) + (mat.Col(0).w * subDetsRest[10]));
+		result.Col(2).w = oneOverDet  * -((mat.Col(0).x * subDetsRest[7]) - (mat.Col(0).y * subDetsRest[9]) + (mat.Col(0).w * subDetsRest[11]));
+		result.Col(3).w = oneOverDet  *  ((mat.Col(0).x * subDetsRest[8]) - (mat.Col(0).y * subDetsRest[10]) + (mat.Col(0).z * subDetsRest[11]));
+
+		return result;
+	}
+
+	GOFX_SISD_INLINE Mat44 RigidMatrixInverse(const Mat44& mat)
+	{
+		// R^-1 = R^T, and the translation is rotated back by R^T and negated
+		Vec3 right(mat.col0.x, mat.col0.y, mat.col0.z);
+		Vec3 up(mat.col1.x, mat.col1.y, mat.col1.z);
+		Vec3 forward(mat.col2.x, mat.col2.y, mat.col2.z);
+		Vec3 translation(mat.col3.x, mat.col3.y, mat.col3.z);
+
+		return Mat44(
+			right.x,	right.y,	right.z,	-Vec3Dot(right, translation),
+			up.x,		up.y,		up.z,		-Vec3Dot(up, translation),
+			forward.x,	forward.y,	forward.z,	-Vec3Dot(forward, translation),
+			0.0f,		0.0f,		0.0f,		1.0f,
+			mat.matrixTypeVal);
+	}
+
+	GOFX_SISD_INLINE Mat44 AffineMatrixInverse(const Mat44& mat)
+	{
+		Vec3 c0(mat.col0.x, mat.col0.y, mat.col0.z);
+		Vec3 c1(mat.col1.x, mat.col1.y, mat.col1.z);
+		Vec3 c2(mat.col2.x, mat.col2.y, mat.col2.z);
+		Vec3 translation(mat.col3.x, mat.col3.y, mat.col3.z);
+
+		// The rows of the inverse 3x3 are the cross products of the column pairs over the determinant
+		Vec3 r0 = Vec3Cross(c1, c2);
+		Vec3 r1 = Vec3Cross(c2, c0);
+		Vec3 r2 = Vec3Cross(c0, c1);
+
+		float det = Vec3Dot(c0, r0);
+
+		Mat44 result;
+
+		if (std::fabs(det) < Epsilon())
+		{
+			result.matrixTypeVal = MatrixType::INVALID;
+			return result;
+		}
+
+		float oneOverDet = 1.0f / det;
+		r0 = Vec3MulScalar(r0, oneOverDet);
+		r1 = Vec3MulScalar(r1, oneOverDet);
+		r2 = Vec3MulScalar(r2, oneOverDet);
+
+		return Mat44(
+			r0.x, r0.y, r0.z, -Vec3Dot(r0, translation),
+			r1.x, r1.y, r1.z, -Vec3Dot(r1, translation),
+			r2.x, r2.y, r2.z, -Vec3Dot(r2, translation),
+			0.0f, 0.0f, 0.0f, 1.0f,
+			mat.matrixTypeVal);
+	}
+
+	GOFX_SISD_INLINE Mat33 MatrixInverse(const Mat33& mat)
+	{
+		// The rows of the inverse are the cross products of the column pairs over the determinant
+		Vec3 r0 = Vec3Cross(mat.col1, mat.col2);
+		Vec3 r1 = Vec3Cross(mat.col2, mat.col0);
+		Vec3 r2 = Vec3Cross(mat.col0, mat.col1);
+
+		float oneOverDet = 1.0f / Vec3Dot(mat.col0, r0);
+
+		return MatrixTranspose(Mat33(Vec3MulScalar(r0, oneOverDet), Vec3MulScalar(r1, oneOverDet), Vec3MulScalar(r2, oneOverDet)));
+	}
+
+	GOFX_SISD_INLINE Mat33 NormalMatrix(const Mat44& mat)
+	{
+		Mat33 upper(mat);
+
+		if (MatrixTypeIsRigid(mat.matrixTypeVal))
+		{
+			return upper;
+		}
+
+		// The cofactor matrix, whose columns are the rows of the adjugate
+		Vec3 c0 = Vec3Cross(upper.col1, upper.col2);
+		Vec3 c1 = Vec3Cross(upper.col2, upper.col0);
+		Vec3 c2 = Vec3Cross(upper.col0, upper.col1);
+
+		float oneOverDet = 1.0f / Vec3Dot(upper.col0, c0);
+
+		return Mat33(Vec3MulScalar(c0, oneOverDet), Vec3MulScalar(c1, oneOverDet), Vec3MulScalar(c2, oneOverDet));
+	}
+
+	GOFX_SISD_INLINE Quaternion QuaternionFromRotationMatrix(const Mat33& mat)
+	{
+		float m00 = mat.col0.x, m11 = mat.col1.y, m22 = mat.col2.z;
+
+		// 4x^2, 4y^2, 4z^2 and 4w^2; the largest one is the safest divisor
+		float xSqr = 1.0f + m00 - m11 - m22;
+		float ySqr = 1.0f - m00 + m11 - m22;
+		float zSqr = 1.0f - m00 - m11 + m22;
+		float wSqr = 1.0f + m00 + m11 + m22;
+
+		Quaternion result;
+		float divisorSqr;
+
+		if (xSqr >= ySqr && xSqr >= zSqr && xSqr >= wSqr)
+		{
+			divisorSqr = xSqr;
+			result = Quaternion(xSqr, mat.col0.y + mat.col1.x, mat.col2.x + mat.col0.z, mat.col1.z - mat.col2.y);
+		}
+		else if (ySqr >= zSqr && ySqr >= wSqr)
+		{
+			divisorSqr = ySqr;
+			result = Quaternion(mat.col0.y + mat.col1.x, ySqr, mat.col1.z + mat.col2.y, mat.col2.x - mat.col0.z);
+		}
+		else if (zSqr >= wSqr)
+		{
+			divisorSqr = zSqr;
+			result = Quaternion(mat.col2.x + mat.col0.z, mat.col1.z + mat.col2.y, zSqr, mat.col0.y - mat.col1.x);
+		}
+		else
+		{
+			divisorSqr = wSqr;
+			result = Quaternion(mat.col1.z - mat.col2.y, mat.col2.x - mat.col0.z, mat.col0.y - mat.col1.x, wSqr);
+		}
+
+		// Each candidate is 4q_i * q, and sqrt(4q_i^2) = 2|q_i|
+		float scale = 0.5f / sqrt(divisorSqr);
+
+		if (result.w < 0.0f)
+		{
+			scale = -scale;
+		}
+
+		return Quaternion(result.x * scale, result.y * scale, result.z * scale, result.w * scale);
+	}
+
+	GOFX_SISD_INLINE float MatrixDeterminant(const Mat44& mat)
+	{
+		float subDetsR0[6] =
+		{
+			mat.Col(2).z * mat.Col(3).w - mat.Col(3).z * mat.Col(2).w,
+			mat.Col(2).y * mat.Col(3).w - mat.Col(3).y * mat.Col(2).w,
+			mat.Col(2).y * mat.Col(3).z - mat.Col(3).y * mat.Col(2).z,
+			mat.Col(2).x * mat.Col(3).w - mat.Col(3).x * mat.Col(2).w,
+			mat.Col(2).x * mat.Col(3).z - mat.Col(3).x * mat.Col(2).z,
+			mat.Col(2).x * mat.Col(3).y - mat.Col(3).x * mat.Col(2).y
+		};
+
+		float res[4] = { ((mat.Col(1).y * subDetsR0[0]) - (mat.Col(1).z * subDetsR0[1]) + (mat.Col(1).w * subDetsR0[2])),
+			-((mat.Col(1).x * subDetsR0[0]) - (mat.Col(1).z * subDetsR0[3]) + (mat.Col(1).w * subDetsR0[4])),
+			((mat.Col(1).x * subDetsR0[1]) - (mat.Col(1).y * subDetsR0[3]) + (mat.Col(1).w * subDetsR0[5])),
+			-((mat.Col(1).x * subDetsR0[2]) - (mat.Col(1).y * subDetsR0[4]) + (mat.Col(1).z * subDetsR0[5])) };
+
+		float result = (mat.Col(0).x * res[0] + mat.Col(0).y * res[1] + mat.Col(0).z * res[2] + mat.Col(0).w * res[3]);
+
+
+		return result;
+	}
+
+
+
+	GOFX_SISD_INLINE void PerspectiveProjectionMatrix(float near, float far, float fov, float aspect, Mat44& result)
+	{
+		// [cotFOV		0.0f			  0.0f		 0.0f]
+		// [0.0f		cotFOV * aspect	  0.0f		 0.0f]
+		// [0.0f		0.0f			 -f/(f-n)	-1.0f]
+		// [0.0f		0.0f			 -fn/(f-n)	 0.0f]
+
+		result.Col(0).x = CotApprox(fov * 0.5f);
+		result.Col(1).y = result.Col(0).x * aspect;
+
+		result.Col(2).z = -far / (far - near);
+		result.Col(2).w = result.Col(2).z * near;
+		
+		result.Col(3).z = -1.0f;
+
+		result.matrixTypeVal = MatrixType::PROJECTIVE;
+	}
+
+	GOFX_SISD_INLINE Mat44 LookAt(const Vec3& eye, const Vec3& target, const Vec3& up)
+	{
+		Vec3 dir = Vec3Sub(target, eye);
+		return LookDir(eye, dir, up);
+	}
+
+	GOFX_SISD_INLINE Mat44 LookDir(const Vec3& eye, const Vec3& dir, const Vec3& up)
+	{
+		Vec3 fwdAxis, rightAxis, upAxis;
+		fwdAxis = Vec3Normalize(dir);
+
+		rightAxis = Vec3Normalize(Vec3Cross(fwdAxis, up));
+
+		upAxis = Vec3Cross(rightAxis, fwdAxis);
+
+		Vec3 backAxis = Vec3Negate(fwdAxis);
+		Vec3 negativeEye = Vec3Negate(eye);
+
+		float rightDotNegEye	= Vec3Dot(rightAxis, negativeEye);
+		float upDotNegEye		= Vec3Dot(upAxis,	 negativeEye);
+		float backwardDotNegEye = Vec3Dot(backAxis,  negativeEye);
+
+		//  rx  ry  rz -rDPe
+		//  ux	uy  uz -uDPe
+		// -dx -dy -dz  dDPe
+		//  0   0   0   1
+
+		return Mat44(
+			Vec4(rightAxis.x, upAxis.x, backAxis.x, 0.0f),
+			Vec4(rightAxis.y, upAxis.y, backAxis.y, 0.0f),
+			Vec4(rightAxis.z, upAxis.z, backAxis.z, 0.0f),
+			Vec4(rightDotNegEye, upDotNegEye, backwardDotNegEye, 1.0f),
+			MatrixType::RIGID);
+	}
+}
+
+#endif // MAT_MATH_IMPL_DOT_H
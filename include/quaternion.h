@@ -38,7 +38,7 @@ namespace gofxmath
 		 *
 		 * \date	2/22/2015
 		 */
-		Quaternion();
+		constexpr Quaternion() : Vec4() {}
 
 		/*!
 		 * \brief	Constructor taking a single float argument that will be copied into all four component values.
@@ -47,7 +47,7 @@ namespace gofxmath
 		 *
 		 * \param	xyzw	The value that will be copied into the x, y, z, and w components.
 		 */
-		Quaternion(float xyzw);
+		constexpr Quaternion(float xyzw) : Vec4(xyzw) {}
 
 		/*!
 		 * \brief	Constructor taking four separate component values to use for the respective coordinate components of this Quaternion.
@@ -59,7 +59,7 @@ namespace gofxmath
 		 * \param	z	The z-coordinate component value  of this Quaternion.
 		 * \param	w	The w-coordinate component value  of this Quaternion.
 		 */
-		Quaternion(float x, float y, float z, float w);
+		constexpr Quaternion(float x, float y, float z, float w) : Vec4(x, y, z, w) {}
 
 		/*!
 		 * \brief	Constructor that takes two Vec2 arguments and copies their values into the first and second pair of components, respectively.
@@ -69,7 +69,7 @@ namespace gofxmath
 		 * \param	xy	The Vec2 that will contribute its components to the x and y-coordinate components of this Quaternion.
 		 * \param	zw	The Vec2 that will contribute its components to the z and w-coordinate components of this Quaternion.
 		 */
-		Quaternion(const Vec2& xy, const Vec2& zw);
+		constexpr Quaternion(const Vec2& xy, const Vec2& zw) : Vec4(xy, zw) {}
 
 		/*!
 		 * \brief	Constructor taking a Vec2 for the x and y-component values, then two separate floats for the z and w-coordinate component values.
@@ -80,7 +80,7 @@ namespace gofxmath
 		 * \param	z 	The z-coordinate component value of this Quaternion.
 		 * \param	w 	The w-coordinate component value of this Quaternion.
 		 */
-		Quaternion(const Vec2& xy, float z, float w);
+		constexpr Quaternion(const Vec2& xy, float z, float w) : Vec4(xy, z, w) {}
 
 		/*!
 		 * \brief	Constructor taking a single float for the x-coordinate component, followed by a Vec2 for the y and z-coordinate component values, then another floats for the w-coordinate component.
@@ -91,7 +91,7 @@ namespace gofxmath
 		 * \param	yz	The Vec2 that will contribute its components to the y and z-coordinate components of this Quaternion.
 		 * \param	w 	The w-coordinate component value of this Quaternion.
 		 */
-		Quaternion(float x, const Vec2& yz, float w);
+		constexpr Quaternion(float x, const Vec2& yz, float w) : Vec4(x, yz, w) {}
 
 		/*!
 		 * \brief	Constructor taking two float values for the x and y-coordinate component values, followed by a Vec2 for the z and w-coordinate component values.
@@ -102,7 +102,7 @@ namespace gofxmath
 		 * \param	y 	The y-coordinate component value of this Quaternion.
 		 * \param	zw	The Vec2 that will contribute its components to the z and w-coordinate components of this Quaternion.
 		 */
-		Quaternion(float x, float y, const Vec2& zw);
+		constexpr Quaternion(float x, float y, const Vec2& zw) : Vec4(x, y, zw) {}
 
 		/*!
 		 * \brief	Constructor taking a single Vec3 for the x, y, and z-coordinate component values, followed by a single float for the w-coordinate component value.
@@ -112,7 +112,7 @@ namespace gofxmath
 		 * \param	xyz	The Vec3 that will contribute its components to the x, y and z-coordinate components of this Quaternion.
 		 * \param	w  	The w-coordinate component value of this Quaternion.
 		 */
-		Quaternion(const Vec3& xyz, float w);
+		constexpr Quaternion(const Vec3& xyz, float w) : Vec4(xyz, w) {}
 
 		/*!
 		 * \brief	Constructor taking a single float for the w-coordinate component value, followed by a single Vec3 for the x, y, and z-coordinate component values.
@@ -122,11 +122,11 @@ namespace gofxmath
 		 * \param	x  	The x-coordinate component value of this Quaternion.
 		 * \param	yzw	The Vec3 that will contribute its components to the y, z and w-coordinate components of this Quaternion.
 		 */
-		Quaternion(float x, const Vec3& yzw);
+		constexpr Quaternion(float x, const Vec3& yzw) : Vec4(x, yzw) {}
 
 		
 
-		static Quaternion Identity();  /*!< The identity quaternion */
+		static constexpr Quaternion Identity() { return Quaternion(0.0f, 0.0f, 0.0f, 1.0f); }	/*!< The identity quaternion */
 	};
 
 	/*! @} */
@@ -2,6 +2,7 @@
 #define SCALAR_MATH_DOT_H
 #include "math_defs.h"
 #include <stdint.h>
+#include <cmath>
 
 /*! \file 
  */
@@ -18,6 +19,39 @@ namespace gofxmath
 	 * @{
 	 */
 
+	/*!
+	 * \brief	Rounds the given value down to the nearest integer.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	val	The value to round down.
+	 *
+	 * \return	The largest integer not greater than the given value, matching std::floor
+	 *			(values at or beyond %%2^{23}%%, infinities and NaN are returned unchanged).
+	 *
+	 * \remarks	std::floor is not constexpr, so constant evaluation truncates through an int
+	 *			instead.  Runtime calls keep std::floor (a single roundss with SSE4.1) under C++11,
+	 *			and under C++14 where GOFX_HAS_IS_CONSTANT_EVALUATED is defined.
+	 */
+	GOFX_CONSTEXPR float Floor(float val)
+	{
+#if defined(GOFX_HAS_IS_CONSTANT_EVALUATED)
+		if (!__builtin_is_constant_evaluated())
+		{
+			return std::floor(val);
+		}
+#elif !defined(__cpp_constexpr) || __cpp_constexpr < 201304L
+		return std::floor(val);
+#endif
+		if (!(val > -8388608.0f && val < 8388608.0f))
+		{
+			return val;
+		}
+
+		float truncated = static_cast<float>(static_cast<int32_t>(val));
+		return truncated > val ? truncated - 1.0f : truncated;
+	}
+
 	/*!
 	 * \brief	Normalize the angle to the range of [-PI,PI).
 	 *
@@ -30,12 +64,52 @@ namespace gofxmath
 	 *			%%[-\\pi,\\pi)%%
 	 *
 	 * \remarks Uses additive range reduction by %%2\\pi%% to replace
-	 *			the value within the proper range.
+	 *			the value within the proper range.  Rounds the period count
+	 *			down (rather than toward zero), so negative angles are
+	 *			reduced into the same range.
+	 */
+	GOFX_CONSTEXPR float NormalizeAngle(float angle)
+	{
+		float shiftedAndScaled = Floor((angle + F_PI) * F_1_2PI + Epsilon());
+		return angle - (shiftedAndScaled * F_2PI);
+	}
+
+	/*!
+	 * \brief	Reduces the angle to the range of %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%% with Cody-Waite
+	 *			range reduction.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	angle			The angle to reduce.
+	 * \param [out]	quadrant	The quadrant the angle fell in: the nearest multiple of
+	 *							%%\\frac{\\pi}{2}%%, modulo 4.
+	 *
+	 * \return	The angle minus the nearest multiple of %%\\frac{\\pi}{2}%%.
+	 *
+	 * \remarks Subtracts %%k\\frac{\\pi}{2}%% as F_PI_2_HI, F_PI_2_MID and F_PI_2_LO in turn.  The first
+	 *			two products and subtractions are exact for %%|k| < 2^{16}%% (%%|x| < 10^5%%), so the reduced
+	 *			angle keeps close to full precision where NormalizeAngle would lose about one bit per
+	 *			doubling of the input.
+	 *
+	 *			The supported range is %%|x| < 10^5%%.  Past it the reduced angle loses precision, and
+	 *			past %%|x| \approx 2^{24}\frac{\pi}{2}%% (about %%2.6 \times 10^7%%), where k is no longer
+	 *			rounded to the nearest integer, it can fall outside %%[-\frac{\pi}{4},\frac{\pi}{4}]%%.  The
+	 *			result and quadrant are still well-defined for any finite angle (the quadrant is taken
+	 *			from k modulo 4 without converting k to an int); non-finite angles give quadrant 0.
+	 *
+	 * \sa AngleReduction
 	 */
-	inline float NormalizeAngle(float angle)
+	inline float ReduceAngleCodyWaite(float angle, int& quadrant)
 	{
-		int shiftedAndScaled = (int)((angle + F_PI) * F_1_2PI + Epsilon());
-		return angle - ((float)shiftedAndScaled * F_2PI);
+		float k = std::nearbyint(angle * F_2_PI);
+		float kMod4 = std::fmod(k, 4.0f);// exact, and in (-4, 4), so the conversion below cannot overflow
+		quadrant = kMod4 == kMod4 ? static_cast<int>(kMod4) & 3 : 0;
+
+		angle -= k * F_PI_2_HI;
+		angle -= k * F_PI_2_MID;
+		angle -= k * F_PI_2_LO;
+
+		return angle;
 	}
 
 	/*!
@@ -47,7 +121,7 @@ namespace gofxmath
 	 *
 	 * \return	An approximation of the sine of the given angle.
 	 */
-	inline float FastSinApprox(float angle)
+	GOFX_CONSTEXPR float FastSinApprox(float angle)
 	{
 		float coef = angle < 0 ? F_4_PI2 : -F_4_PI2;		
 		float sin = (F_4_PI + angle * coef) * angle;
@@ -65,7 +139,7 @@ namespace gofxmath
 	 *
 	 * \return	An approximation of the cosine of the given angle.
 	 */
-	inline float FastCosApprox(float angle)
+	GOFX_CONSTEXPR float FastCosApprox(float angle)
 	{
 		angle += angle > F_PI_2 ? -F_3PI_2 : F_PI_2;
 		return FastSinApprox(angle);
@@ -80,7 +154,7 @@ namespace gofxmath
 	 *
 	 * \return	An approximation of the tangent of the given angle.
 	 */
-	inline float FastTanApprox(float angle)
+	GOFX_CONSTEXPR float FastTanApprox(float angle)
 	{
 		return  FastSinApprox(angle) / FastCosApprox(angle);
 	}
@@ -94,43 +168,200 @@ namespace gofxmath
 	 *
 	 * \return	An approximation of the cotangent of the given angle.
 	 */
-	inline float FastCotApprox(float angle)
+	GOFX_CONSTEXPR float FastCotApprox(float angle)
 	{
 		return FastCosApprox(angle) / FastSinApprox(angle);
 	}
 
+	/*!
+	 * \brief	Evaluates the sine minimax polynomial for the given precision level.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	angle	The angle, already reduced to %%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%.
+	 *
+	 * \return	The approximation of the sine of the given angle.
+	 *
+	 * \sa SinMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	GOFX_CONSTEXPR float SinMinimaxPoly(float angle)
+	{
+		const int TERMS = SinMinimaxTerms<precisionLevel>();
+
+		float angleSqr = angle * angle;
+		float result = SinMinimaxCoef<precisionLevel>(TERMS - 1);
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			result = result * angleSqr + SinMinimaxCoef<precisionLevel>(i);
+		}
+
+		return result * angle;
+	}
+
+	/*!
+	 * \brief	Evaluates the cosine minimax polynomial for the given precision level.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	angle	The angle, already reduced to %%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%.
+	 *
+	 * \return	The approximation of the cosine of the given angle.
+	 *
+	 * \sa CosMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	GOFX_CONSTEXPR float CosMinimaxPoly(float angle)
+	{
+		const int TERMS = CosMinimaxTerms<precisionLevel>();
+
+		float angleSqr = angle * angle;
+		float result = CosMinimaxCoef<precisionLevel>(TERMS - 1);
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			result = result * angleSqr + CosMinimaxCoef<precisionLevel>(i);
+		}
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Evaluates the tangent minimax polynomial for the given precision level.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	angle	The angle, already reduced to %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%%.
+	 *
+	 * \return	The approximation of the tangent of the given angle.
+	 *
+	 * \sa TanMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	GOFX_CONSTEXPR float TanMinimaxPoly(float angle)
+	{
+		const int TERMS = TanMinimaxTerms<precisionLevel>();
+
+		float angleSqr = angle * angle;
+		float result = TanMinimaxCoef<precisionLevel>(TERMS - 1);
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			result = result * angleSqr + TanMinimaxCoef<precisionLevel>(i);
+		}
+
+		return result * angle;
+	}
+
+	/*!
+	 * \brief	Evaluates the quadrant-reduced sine minimax polynomial for the given precision level.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	angle	The angle, already reduced to %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%%.
+	 *
+	 * \return	The approximation of the sine of the given angle.
+	 *
+	 * \sa SinQuadrantMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	GOFX_CONSTEXPR float SinQuadrantMinimaxPoly(float angle)
+	{
+		const int TERMS = SinQuadrantMinimaxTerms<precisionLevel>();
+
+		float angleSqr = angle * angle;
+		float result = SinQuadrantMinimaxCoef<precisionLevel>(TERMS - 1);
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			result = result * angleSqr + SinQuadrantMinimaxCoef<precisionLevel>(i);
+		}
+
+		return result * angle;
+	}
+
+	/*!
+	 * \brief	Evaluates the quadrant-reduced cosine minimax polynomial for the given precision level.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	angle	The angle, already reduced to %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%%.
+	 *
+	 * \return	The approximation of the cosine of the given angle.
+	 *
+	 * \sa CosQuadrantMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	GOFX_CONSTEXPR float CosQuadrantMinimaxPoly(float angle)
+	{
+		const int TERMS = CosQuadrantMinimaxTerms<precisionLevel>();
+
+		float angleSqr = angle * angle;
+		float result = CosQuadrantMinimaxCoef<precisionLevel>(TERMS - 1);
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			result = result * angleSqr + CosQuadrantMinimaxCoef<precisionLevel>(i);
+		}
+
+		return result;
+	}
+
 	/*!
 	 * \brief	Sine Approximation
 	 *
 	 * \date	2/21/2015
 	 *
 	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \tparam	reduction		The range reduction to use.
 	 * \param	angle	The angle for which to approximate the sine.
 	 *
 	 * \return	The approximation of the sine of the given angle.
 	 *
+	 * \remarks	Reduces the angle to %%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%% with
+	 *			%%\\sin(x) = \\sin(\\pm\\pi - x)%%, then evaluates the minimax polynomial
+	 *			for the given precision level.
+	 *
+	 *			With gofxmath::AngleReduction::CODY_WAITE, reduces with ReduceAngleCodyWaite instead
+	 *			and evaluates the quadrant-reduced sine or cosine polynomial.
+	 *
+	 *			Can be evaluated at compile time under C++14 with gofxmath::AngleReduction::SINGLE_STEP;
+	 *			ReduceAngleCodyWaite relies on std::nearbyint, so CODY_WAITE is runtime-only.
+	 *
 	 * \sa FloatPrecision
+	 * \sa SinMinimaxCoef
+	 * \sa SinQuadrantMinimaxCoef
 	 */
-	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
-	inline float SinApprox(float angle)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	GOFX_CONSTEXPR float SinApprox(float angle)
 	{
-		static const size_t PRECISION = TrigPrecisionValue<precisionLevel>();
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			int quadrant = 0;
+			float reduced = ReduceAngleCodyWaite(angle, quadrant);
+			float result = (quadrant & 1) ? CosQuadrantMinimaxPoly<precisionLevel>(reduced) : SinQuadrantMinimaxPoly<precisionLevel>(reduced);
 
-		float norm = NormalizeAngle(angle - F_PI_2);
-		float normSqr = norm * norm;
+			return (quadrant & 2) ? -result : result;
+		}
 
-		float sinAngle = normSqr * CosCoef(PRECISION);
+		float norm = NormalizeAngle(angle);
 
-		for (size_t i = PRECISION - 1; i-- > 0;)
+		if (norm > F_PI_2)
 		{
-			sinAngle += CosCoef(i);
-
-			sinAngle *= normSqr;
+			norm = F_PI - norm;
+		}
+		else if (norm < -F_PI_2)
+		{
+			norm = -F_PI - norm;
 		}
 
-		sinAngle = (sinAngle + 1.0f);
-
-		return sinAngle;
+		return SinMinimaxPoly<precisionLevel>(norm);
 	}
 
 	/*!
@@ -139,31 +370,42 @@ namespace gofxmath
 	 * \date	2/21/2015
 	 *
 	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \tparam	reduction		The range reduction to use.
 	 * \param	angle	The angle for which to approximate the cosine.
 	 *
 	 * \return	The approximation of the cosine of the given angle.
 	 *
+	 * \remarks	Reduces the angle to %%[0,\\frac{\\pi}{2}]%% with %%\\cos(x) = -\\cos(\\pi - |x|)%%,
+	 *			then evaluates the minimax polynomial for the given precision level.
+	 *
+	 *			With gofxmath::AngleReduction::CODY_WAITE, reduces with ReduceAngleCodyWaite instead
+	 *			and evaluates the quadrant-reduced cosine or sine polynomial.
+	 *
 	 * \sa FloatPrecision
+	 * \sa CosMinimaxCoef
+	 * \sa CosQuadrantMinimaxCoef
 	 */
-	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
-	inline float CosApprox(float angle)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	GOFX_CONSTEXPR float CosApprox(float angle)
 	{
-		static const size_t PRECISION = TrigPrecisionValue<precisionLevel>();
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			int quadrant = 0;
+			float reduced = ReduceAngleCodyWaite(angle, quadrant);
+			float result = (quadrant & 1) ? SinQuadrantMinimaxPoly<precisionLevel>(reduced) : CosQuadrantMinimaxPoly<precisionLevel>(reduced);
 
-		float norm = NormalizeAngle(angle);
-		float normSqr = norm * norm;
+			return ((quadrant + 1) & 2) ? -result : result;
+		}
 
-		float cosAngle = normSqr * CosCoef(PRECISION);
+		float norm = NormalizeAngle(angle);
+		norm = norm < 0 ? -norm : norm;
 
-		for (size_t i = PRECISION - 1; i-- > 0;)
+		if (norm > F_PI_2)
 		{
-			cosAngle += CosCoef(i);
-
-			cosAngle *= normSqr;
+			return -CosMinimaxPoly<precisionLevel>(F_PI - norm);
 		}
-		cosAngle = (cosAngle + 1.0f);
 
-		return cosAngle;
+		return CosMinimaxPoly<precisionLevel>(norm);
 	}
 
 	/*!
@@ -172,36 +414,50 @@ namespace gofxmath
 	 * \date	2/21/2015
 	 *
 	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \tparam	reduction		The range reduction to use.
 	 * \param	angle	The angle for which to approximate the tangent.
 	 *
 	 * \return	The approximation of the tangent of the given angle.
 	 *
+	 * \remarks	Reduces the angle to %%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%% by the period of %%\\pi%%,
+	 *			then evaluates the minimax polynomial directly on %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%%,
+	 *			or as %%\\frac{1}{\\tan(\\pm\\frac{\\pi}{2} - x)}%% outside of it.
+	 *
 	 * \sa FloatPrecision
+	 * \sa TanMinimaxCoef
 	 */
-	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
-	inline float TanApprox(float angle)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	GOFX_CONSTEXPR float TanApprox(float angle)
 	{
-		static const size_t PRECISION = TrigPrecisionValue<precisionLevel>();
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			int quadrant = 0;
+			float result = TanMinimaxPoly<precisionLevel>(ReduceAngleCodyWaite(angle, quadrant));
 
-		float norm = NormalizeAngle(angle);
-		float normSqr = norm * norm;
+			return (quadrant & 1) ? -1.0f / result : result;
+		}
 
-		float sinAngle = normSqr * SinCoef(PRECISION);
-		float cosAngle = normSqr * CosCoef(PRECISION);
+		float norm = NormalizeAngle(angle);
 
-		for (size_t i = PRECISION - 1; i-- > 0;)
+		if (norm > F_PI_2)
 		{
-			sinAngle += SinCoef(i);
-			cosAngle += CosCoef(i);
-
-			sinAngle *= normSqr;
-			cosAngle *= normSqr;
+			norm -= F_PI;
+		}
+		else if (norm < -F_PI_2)
+		{
+			norm += F_PI;
 		}
 
-		sinAngle = (sinAngle + 1.0f) * norm;
-		cosAngle = (cosAngle + 1.0f);
+		if (norm > F_PI_4)
+		{
+			return 1.0f / TanMinimaxPoly<precisionLevel>(F_PI_2 - norm);
+		}
+		else if (norm < -F_PI_4)
+		{
+			return 1.0f / TanMinimaxPoly<precisionLevel>(-F_PI_2 - norm);
+		}
 
-		return sinAngle / cosAngle;
+		return TanMinimaxPoly<precisionLevel>(norm);
 	}
 
 	/*!
@@ -210,36 +466,203 @@ namespace gofxmath
 	 * \date	2/21/2015
 	 *
 	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \tparam	reduction		The range reduction to use.
 	 * \param	angle	The angle for which to approximate the cotangent.
 	 *
 	 * \return	The approximation of the cotangent of the given angle.
-	 * 
+	 *
+	 * \remarks	Uses the same reduction as TanApprox, with the reciprocal taken on the opposite
+	 *			half of the reduced range.
+	 *
 	 * \sa FloatPrecision
+	 * \sa TanMinimaxCoef
 	 */
-	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
-	inline float CotApprox(float angle)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	GOFX_CONSTEXPR float CotApprox(float angle)
 	{
-		static const size_t PRECISION = TrigPrecisionValue<precisionLevel>();
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			int quadrant = 0;
+			float result = TanMinimaxPoly<precisionLevel>(ReduceAngleCodyWaite(angle, quadrant));
+
+			return (quadrant & 1) ? -result : 1.0f / result;
+		}
 
 		float norm = NormalizeAngle(angle);
-		float normSqr = norm * norm;
 
-		float sinAngle = normSqr * SinCoef(PRECISION);
-		float cosAngle = normSqr * CosCoef(PRECISION);
+		if (norm > F_PI_2)
+		{
+			norm -= F_PI;
+		}
+		else if (norm < -F_PI_2)
+		{
+			norm += F_PI;
+		}
 
-		for (int i = PRECISION - 1; i-- > 0;)
+		if (norm > F_PI_4)
 		{
-			sinAngle += SinCoef(i);
-			cosAngle += CosCoef(i);
+			return TanMinimaxPoly<precisionLevel>(F_PI_2 - norm);
+		}
+		else if (norm < -F_PI_4)
+		{
+			return TanMinimaxPoly<precisionLevel>(-F_PI_2 - norm);
+		}
+
+		return 1.0f / TanMinimaxPoly<precisionLevel>(norm);
+	}
 
-			sinAngle *= normSqr;
-			cosAngle *= normSqr;
+	/*!
+	 * \brief	Evaluates the arctangent minimax polynomial for the given precision level.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	value	The value, already reduced to %%[-\\tan(\\frac{\\pi}{8}),\\tan(\\frac{\\pi}{8})]%%.
+	 *
+	 * \return	The approximation of the arctangent of the given value.
+	 *
+	 * \sa AtanMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline float AtanMinimaxPoly(float value)
+	{
+		const int TERMS = AtanMinimaxTerms<precisionLevel>();
+
+		float valueSqr = value * value;
+		float result = AtanMinimaxCoef<precisionLevel>(TERMS - 1);
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			result = result * valueSqr + AtanMinimaxCoef<precisionLevel>(i);
 		}
 
-		sinAngle = (sinAngle + 1.0f) * norm;
-		cosAngle = (cosAngle + 1.0f);
+		return result * value;
+	}
 
-		return cosAngle / sinAngle;
+	/*!
+	 * \brief	Arctangent approximation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	value	The value for which to approximate the arctangent.
+	 *
+	 * \return	The approximation of the arctangent of the given value, in the range
+	 *			%%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%.  NaN values are passed through.
+	 *
+	 * \remarks	Reduces %%|x|%% to %%[0,\\tan(\\frac{\\pi}{8})]%% with
+	 *			%%\\arctan(x) = \\frac{\\pi}{2} + \\arctan(-\\frac{1}{x})%% above %%\\tan(\\frac{3\\pi}{8})%% and
+	 *			%%\\arctan(x) = \\frac{\\pi}{4} + \\arctan(\\frac{x - 1}{x + 1})%% above %%\\tan(\\frac{\\pi}{8})%%,
+	 *			so only one division is needed.
+	 *
+	 * \sa FloatPrecision
+	 * \sa AtanMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline float AtanApprox(float value)
+	{
+		float absVal = std::fabs(value);
+		float offset = 0.0f;
+		float reduced = absVal;
+
+		if (absVal > F_TAN_3PI_8)
+		{
+			offset = F_PI_2;
+			reduced = -1.0f / absVal;
+		}
+		else if (absVal > F_TAN_PI_8)
+		{
+			offset = F_PI_4;
+			reduced = (absVal - 1.0f) / (absVal + 1.0f);
+		}
+
+		return std::copysign(offset + AtanMinimaxPoly<precisionLevel>(reduced), value);
+	}
+
+	/*!
+	 * \brief	Two-argument arctangent approximation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	y	The y-coordinate of the point.
+	 * \param	x	The x-coordinate of the point.
+	 *
+	 * \return	The approximation of the angle between the positive x-axis and the point
+	 *			%%(x, y)%%, in the range %%[-\\pi,\\pi]%%.
+	 *
+	 * \remarks	Follows the quadrant conventions of std::atan2, including signed zeros and
+	 *			infinite arguments.  Returns NaN if either argument is NaN.
+	 *
+	 * \sa AtanApprox
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline float Atan2Approx(float y, float x)
+	{
+		if (x != x || y != y)
+		{
+			return x + y;
+		}
+
+		float absX = std::fabs(x);
+		float absY = std::fabs(y);
+
+		// Keeps 0/0 and inf/inf out of the ratio
+		float ratio = absY == absX ? 1.0f : absY / absX;
+		ratio = absY == 0.0f ? 0.0f : ratio;
+
+		float angle = AtanApprox<precisionLevel>(ratio);
+
+		if (std::signbit(x))
+		{
+			angle = F_PI - angle;
+		}
+
+		return std::copysign(angle, y);
+	}
+
+	/*!
+	 * \brief	Arcsine approximation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	value	The value for which to approximate the arcsine.
+	 *
+	 * \return	The approximation of the arcsine of the given value, in the range
+	 *			%%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%.  Returns NaN outside of %%[-1,1]%%.
+	 *
+	 * \remarks	Evaluated as %%\\arctan2(x, \\sqrt{(1 - x)(1 + x)})%%, which stays accurate
+	 *			near %%\\pm 1%%.
+	 *
+	 * \sa Atan2Approx
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline float AsinApprox(float value)
+	{
+		return Atan2Approx<precisionLevel>(value, std::sqrt((1.0f - value) * (1.0f + value)));
+	}
+
+	/*!
+	 * \brief	Arccosine approximation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	The precision level to use for the approximation.
+	 * \param	value	The value for which to approximate the arccosine.
+	 *
+	 * \return	The approximation of the arccosine of the given value, in the range
+	 *			%%[0,\\pi]%%.  Returns NaN outside of %%[-1,1]%%.
+	 *
+	 * \remarks	Evaluated as %%\\arctan2(\\sqrt{(1 - x)(1 + x)}, x)%%, which stays accurate
+	 *			near %%\\pm 1%%.
+	 *
+	 * \sa Atan2Approx
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline float AcosApprox(float value)
+	{
+		return Atan2Approx<precisionLevel>(std::sqrt((1.0f - value) * (1.0f + value)), value);
 	}
 
 	/*!
@@ -278,7 +701,7 @@ namespace gofxmath
 	 * \remarks Uses the definition of NaN such that the number
 	 *			is not equal to itself.
 	 */
-	inline bool IsNaN(float val)
+	GOFX_CONSTEXPR bool IsNaN(float val)
 	{
 		return val != val;
 	}
@@ -295,7 +718,7 @@ namespace gofxmath
 	 * \remarks Uses the definition of infinity where the number is equal to itself,
 	 *			but when subtracted by itself, does not produce zero.
 	 */
-	inline bool IsInfinity(float val)
+	GOFX_CONSTEXPR bool IsInfinity(float val)
 	{
 		return (val == val) && (val - val) != 0.0f;
 	}
@@ -14,4 +14,30 @@
 /*! \def A byte aligned struct */
 #define ALIGNED_STRUCT(x) ALIGNED_TYPE(struct, x)
 
+/*! \def A function that can be evaluated at compile time (constexpr under C++14 and later, where constexpr functions may declare locals, branch and loop; inline otherwise) */
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define GOFX_CONSTEXPR constexpr
+
+/*! \def Defined when GOFX_CONSTEXPR functions can tell constant evaluation apart with __builtin_is_constant_evaluated, and so keep their intrinsic runtime paths */
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define GOFX_HAS_IS_CONSTANT_EVALUATED
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#define GOFX_HAS_IS_CONSTANT_EVALUATED
+#endif
+
+#else
+#define GOFX_CONSTEXPR inline
+#endif
+
+/*! \def An out-of-line SISD vector or matrix function (see vecmath_impl.h and matmath_impl.h): inline when
+ *	GOFXMATH_INLINE_SISD is defined (the GOFXMATH_INLINE_SISD CMake option), so its body is visible to every
+ *	caller; a normal function compiled into the static library otherwise */
+#if defined(GOFXMATH_INLINE_SISD)
+#define GOFX_SISD_INLINE inline
+#else
+#define GOFX_SISD_INLINE
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,560 @@
+#ifndef SSE_MAT33_DOT_H
+#define SSE_MAT33_DOT_H
+
+#include "ssemat_math_defs.h"
+#include "ssevec_math_defs.h"
+#include "ssevec.h"
+#include "ssemat44.h"
+#include "mat33.h"
+#include "sisd_defns.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+/*!
+ * \file
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SIMDMatMath
+	 * @{
+	 */
+
+	/*!
+	 * \class SseMat33
+	 *
+	 * \brief	A 3x3 column-major matrix that uses three SseVecs for column vectors.
+	 *
+	 * \remarks The w components of the columns are kept at 0, so the columns can be used directly
+	 *			as direction vectors and the products below never need to mask them.  There is no
+	 *			matrixTypeVal; functions that can fail document how they report it.
+	 */
+	ALIGNED_CLASS(16) SseMat33
+	{
+	public:
+		SseVec col0;/*!< The first column vector
+					 *	 \sa SseVec
+					 */
+
+		SseVec col1;/*!< The second column vector
+					 *	 \sa SseVec
+					 */
+
+		SseVec col2;/*!< The third column vector
+					 *	 \sa SseVec
+					 */
+
+		/*!
+		 * \brief	Empty SseMat33 constructor.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \remarks Sets all member columns to zero vectors.
+		 */
+		SseMat33() :
+			col0(_mm_setzero_ps()),
+			col1(_mm_setzero_ps()),
+			col2(_mm_setzero_ps()) {}
+
+		/*!
+		 * \brief SseMat33 constructor that takes SseVec arguments to fill the columns.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	v0	An SseVec that will be placed in the first column.
+		 * \param	v1	An SseVec that will be placed in the second column.
+		 * \param	v2	An SseVec that will be placed in the third column.
+		 *
+		 * \remarks The w components of the given vectors are expected to be 0.
+		 */
+		SseMat33(const SseVec& v0, const SseVec& v1, const SseVec& v2) :
+			col0(v0),
+			col1(v1),
+			col2(v2) {}
+
+		/*!
+		 * \brief	An SseMat33 constructor that takes 9 floats.
+		 *
+		 * \remarks Each three floats correspond to the columns of the resulting matrix.
+		 *
+		 * \date	10/18/2026
+		 */
+		SseMat33(float f00, float f10, float f20,
+				 float f01, float f11, float f21,
+				 float f02, float f12, float f22) :
+				 col0(SetSseVec4(f00, f10, f20, 0.0f)),
+				 col1(SetSseVec4(f01, f11, f21, 0.0f)),
+				 col2(SetSseVec4(f02, f12, f22, 0.0f)) {}
+
+		/*!
+		 * \brief	A conversion constructor from Mat33 to SseMat33.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The Mat33 matrix to copy from.
+		 */
+		SseMat33(const Mat33& mat) :
+			col0(SetSseVec4(mat.col0.x, mat.col0.y, mat.col0.z, 0.0f)),
+			col1(SetSseVec4(mat.col1.x, mat.col1.y, mat.col1.z, 0.0f)),
+			col2(SetSseVec4(mat.col2.x, mat.col2.y, mat.col2.z, 0.0f)) {}
+
+		/*!
+		 * \brief	Constructs an SseMat33 from the upper 3x3 of the given 4x4 matrix.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The matrix to take the rotation/scale part of.
+		 */
+		explicit SseMat33(const SseMat44& mat) :
+			col0(VecAnd(mat.col0, MASK_1110)),
+			col1(VecAnd(mat.col1, MASK_1110)),
+			col2(VecAnd(mat.col2, MASK_1110)) {}
+
+		/*!
+		 * \brief	Gets the identity matrix.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \return	The 3x3 identity matrix.
+		 */
+		static SseMat33 Identity()
+		{
+			return SseMat33(UNIT_1000, UNIT_0100, UNIT_0010);
+		}
+	};
+
+	/*!
+	 * \brief	Expands the given 3x3 matrix into the upper 3x3 of an SseMat44, with no translation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat			 	The matrix to expand.
+	 * \param	matrixTypeVal	The type to give the result; defaults to MatrixType::AFFINE.
+	 *
+	 * \return	The expanded 4x4 matrix.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	SSE_MAT_CALL ToSseMat44(const SseMat33& mat, MatrixType matrixTypeVal = MatrixType::AFFINE)
+	{
+		return SseMat44(mat.col0, mat.col1, mat.col2, UNIT_0001, matrixTypeVal);
+	}
+
+	/*!
+	 * \brief Converts the given 3x3 matrix to an array of floats.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to convert to an array.
+	 *
+	 * \return	The array of floats representing the given 3x3 matrix, in column-major order.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	inline std::array<float, 9> MatrixToArray(const SseMat33& mat)
+	{
+		float padded[12];
+
+		_mm_storeu_ps(padded, mat.col0);
+		_mm_storeu_ps(padded + 3, mat.col1);
+		_mm_storeu_ps(padded + 6, mat.col2);
+
+		std::array<float, 9> result;
+		std::copy(padded, padded + 9, result.begin());
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Multiplies the given 3D vector by the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix that will be multiplied against the 3D vector.
+	 * \param	vec	The 3D vector to transform.
+	 *
+	 * \return	The transformed 3D vector, with a w component of 0.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	SSE_VEC_CALL TransformVec3(const SseMat33& mat, const SseVec& vec)
+	{
+		SseVec tmp0 = VecMul(mat.col0, VecSplat<VecCoord::X>(vec));
+		SseVec tmp1 = VecMul(mat.col1, VecSplat<VecCoord::Y>(vec));
+		SseVec tmp2 = VecMul(mat.col2, VecSplat<VecCoord::Z>(vec));
+
+		return VecAdd(VecAdd(tmp0, tmp1), tmp2);
+	}
+
+	/*!
+	 * \brief Calculates the product (post-multiplication) of the two given 3x3 matrices.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	left 	The left matrix.
+	 * \param	right	The right matrix.
+	 *
+	 * \return	The post-multiplied product of the two matrices, following the same order as
+	 *			MatrixMultiply(const SseMat44&, const SseMat44&).
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	inline SseMat33 MatrixMultiply(const SseMat33& left, const SseMat33& right)
+	{
+		return SseMat33(TransformVec3(left, right.col0), TransformVec3(left, right.col1), TransformVec3(left, right.col2));
+	}
+
+	/*!
+	 * \brief Calculates the transpose of the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to transpose.
+	 *
+	 * \return	The transpose of the given matrix.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	inline SseMat33 MatrixTranspose(const SseMat33& mat)
+	{
+		SseVec tmp0, tmp1, tmp2, tmp3;
+
+		tmp0 = _mm_unpacklo_ps(mat.col0, mat.col1);// 00 01 10 11
+		tmp1 = _mm_unpackhi_ps(mat.col0, mat.col1);// 20 21 na na
+		tmp2 = _mm_unpacklo_ps(mat.col2, SetVecZero());// 02 0 12 0
+		tmp3 = _mm_unpackhi_ps(mat.col2, SetVecZero());// 22 0 na 0
+
+		return SseMat33(
+			_mm_movelh_ps(tmp0, tmp2),// 00 01 02 0
+			_mm_movehl_ps(tmp2, tmp0),// 10 11 12 0
+			_mm_movelh_ps(tmp1, tmp3));// 20 21 22 0
+	}
+
+	/*!
+	 * \brief Calculates the determinant of the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix.
+	 *
+	 * \return	An SseVec holding four copies of the determinant.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	inline SseVec MatrixDeterminant(const SseMat33& mat)
+	{
+		return Vec3Dot(mat.col0, Vec3Cross(mat.col1, mat.col2));
+	}
+
+	/*!
+	 * \brief Calculates the inverse of the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal of the determinant is calculated.
+	 * \param	mat	The matrix to invert.
+	 *
+	 * \return	The inverse of the given matrix.
+	 *
+	 * \remarks	The rows of the inverse are the cross products of the column pairs over the
+	 *			determinant.  There is no branch on the determinant, so a singular input gives
+	 *			non-finite values; check MatrixDeterminant first when that can happen.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	inline SseMat33 MatrixInverse(const SseMat33& mat)
+	{
+		SseVec row0 = VecAnd(Vec3Cross(mat.col1, mat.col2), MASK_1110);
+		SseVec row1 = VecAnd(Vec3Cross(mat.col2, mat.col0), MASK_1110);
+		SseVec row2 = VecAnd(Vec3Cross(mat.col0, mat.col1), MASK_1110);
+
+		SseVec detRcp = VecRcp<policy>(Vec3Dot(mat.col0, row0));
+
+		return MatrixTranspose(SseMat33(VecMul(row0, detRcp), VecMul(row1, detRcp), VecMul(row2, detRcp)));
+	}
+
+	/*!
+	 * \brief Calculates the normal matrix (the inverse transpose of the upper 3x3) of the given matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal of the determinant is calculated.
+	 * \param	mat	The model matrix whose normals are being transformed.
+	 *
+	 * \return	The normal matrix.
+	 *
+	 * \remarks	The inverse transpose is the cofactor matrix over the determinant, so its columns are
+	 *			the cross products of the column pairs and no transpose is needed.  For rigid
+	 *			matrices (see MatrixTypeIsRigid) the upper 3x3 is returned as is.  A singular upper 3x3
+	 *			gives non-finite values.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	inline SseMat33 NormalMatrix(const SseMat44& mat)
+	{
+		SseMat33 upper(mat);
+
+		if (MatrixTypeIsRigid(mat.matrixTypeVal))
+		{
+			return upper;
+		}
+
+		SseVec col0 = VecAnd(Vec3Cross(upper.col1, upper.col2), MASK_1110);
+		SseVec col1 = VecAnd(Vec3Cross(upper.col2, upper.col0), MASK_1110);
+		SseVec col2 = VecAnd(Vec3Cross(upper.col0, upper.col1), MASK_1110);
+
+		SseVec detRcp = VecRcp<policy>(Vec3Dot(upper.col0, col0));
+
+		return SseMat33(VecMul(col0, detRcp), VecMul(col1, detRcp), VecMul(col2, detRcp));
+	}
+
+	/*!
+	 * \brief Calculates the 3x3 rotation matrix represented by the given quaternion rotation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	quat	The quaternion rotation to transform into a 3x3 matrix.
+	 *
+	 * \return	The 3x3 rotation matrix (orthonormal, assuming a unit quaternion).
+	 *
+	 * \remarks	Shares RotationMatrixFromQuaternion; the unused fourth column is dropped when inlined.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	inline SseMat33 RotationMat33FromQuaternion(const SseVec& quat)
+	{
+		SseMat44 rotation = RotationMatrixFromQuaternion(quat);
+
+		return SseMat33(rotation.col0, rotation.col1, rotation.col2);
+	}
+
+	/*!
+	 * \brief	Calculates the unit quaternion represented by the given 3x3 rotation matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal square root is calculated (see VecRSqrt).
+	 * \param	mat	The rotation matrix; expected to be orthonormal.
+	 *
+	 * \return	The quaternion SseVec <x y z w>, with w kept non-negative.
+	 *
+	 * \remarks	Shares the SseMat44 QuaternionFromRotationMatrix, which only reads the upper 3x3.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	SSE_VEC_CALL QuaternionFromRotationMatrix(const SseMat33& mat)
+	{
+		return QuaternionFromRotationMatrix<policy>(SseMat44(mat.col0, mat.col1, mat.col2, UNIT_0001, MatrixType::ROTATION));
+	}
+
+	/*!
+	 * \brief	Writes one result of a batch function with the given StorePolicy.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	Whether to use ordinary or non-temporal stores.
+	 * \param	result	The destination.
+	 * \param	mat   	The matrix to write.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<StorePolicy storePolicy>
+	inline void BatchStore(SseMat33* result, const SseMat33& mat)
+	{
+		BatchStore<storePolicy>(&result->col0, mat.col0);
+		BatchStore<storePolicy>(&result->col1, mat.col1);
+		BatchStore<storePolicy>(&result->col2, mat.col2);
+	}
+
+	/*!
+	 * \brief	Multiplies every pair of matrices in the given arrays.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	lefts  	The left matrices.
+	 * \param	rights 	The right matrices.
+	 * \param	results	The array receiving the products.  May alias either input.
+	 * \param	count  	The number of matrix pairs.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void MatrixMultiplyBatch(const SseMat33* lefts, const SseMat33* rights, SseMat33* results, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			BatchPrefetch<prefetchDistance>(lefts, i, count);
+			BatchPrefetch<prefetchDistance>(rights, i, count);
+			BatchStore<storePolicy>(results + i, MatrixMultiply(lefts[i], rights[i]));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Inverts every matrix in the given array.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocals of the determinants are calculated.
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	mats   	The matrices to invert.
+	 * \param	results	The array receiving the inverses.  May alias mats.
+	 * \param	count  	The number of matrices.
+	 *
+	 * \remarks	The inverses are independent, so the cross products and reciprocals of consecutive
+	 *			matrices overlap in the pipeline.  As with MatrixInverse, singular inputs give
+	 *			non-finite values.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED, StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void MatrixInverseBatch(const SseMat33* mats, SseMat33* results, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			BatchPrefetch<prefetchDistance>(mats, i, count);
+			BatchStore<storePolicy>(results + i, MatrixInverse<policy>(mats[i]));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Multiplies every 3D vector in the given array by the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	mat	   	The matrix that will be multiplied against the vectors.
+	 * \param	vecs   	The 3D vectors to transform.
+	 * \param	results	The array receiving the transformed vectors.  May alias vecs.
+	 * \param	count  	The number of vectors.
+	 *
+	 * \remarks	The matrix columns stay in registers for the whole loop.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void TransformVec3Batch(const SseMat33& mat, const SseVec* vecs, SseVec* results, size_t count)
+	{
+		const SseMat33 local = mat;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+			BatchStore<storePolicy>(results + i, TransformVec3(local, vecs[i]));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Multiplies every packed 3D vector in the given array by the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	mat	   	The matrix that will be multiplied against the vectors.
+	 * \param	vecs   	The packed 3D vectors to transform.
+	 * \param	results	The array receiving the transformed vectors.  May alias vecs.
+	 * \param	count  	The number of vectors.
+	 *
+	 * \remarks	Meant for normal buffers (with a NormalMatrix); streams the packed array four vectors at a
+	 *			time (see LoadSseVec3PQuad).
+	 *
+	 *			With STREAMING, the blocks of four are streamed when results is 16-byte aligned (and
+	 *			written normally otherwise); the last count % 4 vectors are always written normally.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void TransformVec3PBatch(const SseMat33& mat, const Vec3P* vecs, Vec3P* results, size_t count)
+	{
+		const SseMat33 local = mat;
+		const bool stream = storePolicy == StorePolicy::STREAMING && (reinterpret_cast<uintptr_t>(results) & 0xF) == 0;
+		SseVec tmp[4];
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+			LoadSseVec3PQuad(vecs + i, tmp);
+
+			for (int j = 0; j < 4; ++j)
+			{
+				tmp[j] = TransformVec3(local, tmp[j]);
+			}
+
+			if (stream)
+			{
+				StoreSseVec3PQuad<StorePolicy::STREAMING>(tmp, results + i);
+			}
+			else
+			{
+				StoreSseVec3PQuad(tmp, results + i);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			results[i] = StoreSseVec3P(TransformVec3(local, LoadSseVec3P(vecs[i])));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Transforms and renormalizes one packed 3D attribute (such as the normal) of every vertex in
+	 *			an interleaved vertex buffer via the given 3x3 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the length is calculated and divided out (see Vec3Normalize).
+	 * \param	mat		 	The matrix that will be multiplied against the vectors, such as a NormalMatrix.
+	 * \param	src		 	The start of the source buffer.
+	 * \param	srcStride	The size of one source vertex, in bytes.
+	 * \param	srcOffset	The offset of the Vec3P attribute within a source vertex, in bytes.
+	 * \param	dst		 	The start of the destination buffer.  May be src, to transform in place.
+	 * \param	dstStride	The size of one destination vertex, in bytes.
+	 * \param	dstOffset	The offset of the Vec3P attribute within a destination vertex, in bytes.
+	 * \param	count	 	The number of vertices.
+	 *
+	 * \remarks	Only the 12 bytes of each attribute are read and written, so the other attributes of the
+	 *			vertices are untouched and no separate Vec3 array is needed.
+	 *
+	 * \relatedalso gofxmath::SseMat33
+	 *
+	 * \sa StridedAttribute
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
+	inline void TransformNormalVec3PStrided(const SseMat33& mat, const void* src, size_t srcStride, size_t srcOffset,
+		void* dst, size_t dstStride, size_t dstOffset, size_t count)
+	{
+		const SseMat33 local = mat;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			SseVec vec = TransformVec3(local, LoadSseVec3P(*StridedAttribute<Vec3P>(src, srcStride, srcOffset, i)));
+			*StridedAttribute<Vec3P>(dst, dstStride, dstOffset, i) = StoreSseVec3P(Vec3Normalize<policy>(vec));
+		}
+	}
+
+	/*! @} */
+}
+#endif // SSE_MAT33_DOT_H
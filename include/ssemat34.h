@@ -0,0 +1,372 @@
+#ifndef SSE_MAT34_DOT_H
+#define SSE_MAT34_DOT_H
+
+#include "ssemat_math_defs.h"
+#include "ssevec_math_defs.h"
+#include "ssevec.h"
+#include "ssemat44.h"
+#include "sisd_defns.h"
+#include <array>
+#include <cstddef>
+
+/*!
+ * \file
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SIMDMatMath
+	 * @{
+	 */
+
+	/*!
+	 * \class SseMat34
+	 *
+	 * \brief	A 3x4 row-major affine matrix that uses three SseVecs for row vectors.
+	 *
+	 * \remarks The implied fourth row is always <0 0 0 1>, so only the rows holding the upper 3x3 and
+	 *			the translation are stored: 48 bytes, against the 80 of an SseMat44 with its
+	 *			MatrixType.  The rows are laid out exactly like a row-major float3x4, so instance
+	 *			buffers can be filled with straight 16-byte stores (see StoreFloat3x4).
+	 *
+	 *			There is no matrixTypeVal; every SseMat34 is treated as MatrixType::AFFINE.
+	 */
+	ALIGNED_CLASS(16) SseMat34
+	{
+	public:
+		SseVec row0;/*!< The first row vector: <m00 m01 m02 m03>
+					 *	 \sa SseVec
+					 */
+
+		SseVec row1;/*!< The second row vector: <m10 m11 m12 m13>
+					 *	 \sa SseVec
+					 */
+
+		SseVec row2;/*!< The third row vector: <m20 m21 m22 m23>
+					 *	 \sa SseVec
+					 */
+
+		/*!
+		 * \brief	Empty SseMat34 constructor.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \remarks Sets all member rows to zero vectors.
+		 */
+		SseMat34() :
+			row0(_mm_setzero_ps()),
+			row1(_mm_setzero_ps()),
+			row2(_mm_setzero_ps()) {}
+
+		/*!
+		 * \brief SseMat34 constructor that takes SseVec arguments to fill the rows.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	r0	An SseVec that will be placed in the first row.
+		 * \param	r1	An SseVec that will be placed in the second row.
+		 * \param	r2	An SseVec that will be placed in the third row.
+		 */
+		SseMat34(const SseVec& r0, const SseVec& r1, const SseVec& r2) :
+			row0(r0),
+			row1(r1),
+			row2(r2) {}
+
+		/*!
+		 * \brief	An SseMat34 constructor that takes 12 floats.
+		 *
+		 * \remarks Each four floats correspond to the rows of the resulting matrix.
+		 *
+		 * \date	10/18/2026
+		 */
+		SseMat34(float f00, float f01, float f02, float f03,
+				 float f10, float f11, float f12, float f13,
+				 float f20, float f21, float f22, float f23) :
+				 row0(SetSseVec4(f00, f01, f02, f03)),
+				 row1(SetSseVec4(f10, f11, f12, f13)),
+				 row2(SetSseVec4(f20, f21, f22, f23)) {}
+
+		/*!
+		 * \brief	A conversion constructor from SseMat44 to SseMat34.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The SseMat44 matrix to copy from.
+		 *
+		 * \remarks The bottom row of the given matrix is dropped, so the conversion is only lossless for
+		 *			matrices whose type satisfies MatrixTypeIsAffine.
+		 */
+		explicit SseMat34(const SseMat44& mat)
+		{
+			SseMat44 transposed = MatrixTranspose(mat);
+
+			row0 = transposed.col0;
+			row1 = transposed.col1;
+			row2 = transposed.col2;
+		}
+
+		/*!
+		 * \brief	Gets the identity matrix.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \return	The 3x4 identity matrix.
+		 */
+		static SseMat34 Identity()
+		{
+			return SseMat34(UNIT_1000, UNIT_0100, UNIT_0010);
+		}
+	};
+
+	static_assert(sizeof(SseMat34) == 3 * sizeof(SseVec), "SseMat34 must pack into three SseVecs");
+
+	/*!
+	 * \brief	Expands the given 3x4 matrix into an SseMat44.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat			 	The matrix to expand.
+	 * \param	matrixTypeVal	The type to give the result; defaults to MatrixType::AFFINE.  Pass a more
+	 *							specific type when one is known, so the SseMat44 fast paths can use it.
+	 *
+	 * \return	The SseMat44 with the rows of the given matrix and a bottom row of <0 0 0 1>.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	SSE_MAT_CALL ToSseMat44(const SseMat34& mat, MatrixType matrixTypeVal = MatrixType::AFFINE)
+	{
+		SseMat44 result = MatrixTranspose(SseMat44(mat.row0, mat.row1, mat.row2, UNIT_0001));
+		result.matrixTypeVal = matrixTypeVal;
+
+		return result;
+	}
+
+	/*!
+	 * \brief Converts the given 3x4 matrix to an array of floats.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to convert to an array.
+	 *
+	 * \return	The array of floats representing the given 3x4 matrix, in row-major order.
+	 *
+	 * \remarks Unlike MatrixToArray(const SseMat44&), the values are row-major, matching the float3x4
+	 *			layout of the matrix.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	inline std::array<float, 12> MatrixToArray(const SseMat34& mat)
+	{
+		std::array<float, 12> result;
+
+		_mm_storeu_ps(result.data(), mat.row0);
+		_mm_storeu_ps(result.data() + 4, mat.row1);
+		_mm_storeu_ps(result.data() + 8, mat.row2);
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Loads a 3x4 matrix from 12 row-major floats.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	src	The 12 floats to load.  Does not need to be aligned.
+	 *
+	 * \return	The loaded matrix.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	inline SseMat34 LoadFloat3x4(const float* src)
+	{
+		return SseMat34(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8));
+	}
+
+	/*!
+	 * \brief	Stores the given 3x4 matrix as 12 row-major floats, such as one entry of a float3x4
+	 *			instance buffer.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param [out]	dest	The 12 floats to write.  Does not need to be aligned.
+	 * \param	mat			The matrix to store.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	inline void StoreFloat3x4(float* dest, const SseMat34& mat)
+	{
+		_mm_storeu_ps(dest, mat.row0);
+		_mm_storeu_ps(dest + 4, mat.row1);
+		_mm_storeu_ps(dest + 8, mat.row2);
+	}
+
+	/*!
+	 * \brief	Packs the given affine SseMat44 matrices into a float3x4 instance buffer.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param [out]	dest	The buffer to write, 12 floats per matrix.  Does not need to be aligned.
+	 * \param	mats		The matrices to pack.
+	 * \param	count		The number of matrices.
+	 *
+	 * \remarks The bottom rows are dropped, as in SseMat34(const SseMat44&); the transpose is done in
+	 *			registers, so the matrices never take the 80-byte round trip through memory.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	inline void StoreFloat3x4(float* dest, const SseMat44* mats, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			StoreFloat3x4(dest + 12 * i, SseMat34(mats[i]));
+		}
+	}
+
+	/*!
+	 * \brief Calculates the product of the two given 3x4 affine matrices.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	left 	The left matrix.
+	 * \param	right	The right matrix.
+	 *
+	 * \return	The product left * right, with the implied bottom rows multiplied through.
+	 *
+	 * \remarks Each result row is a linear combination of the right matrix's rows, plus the left
+	 *			matrix's translation: 9 multiplies and 9 adds against the 16 and 12 of MatrixMultiply
+	 *			for SseMat44.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	inline SseMat34 MatrixMultiply(const SseMat34& left, const SseMat34& right)
+	{
+		SseVec tmp0, tmp1, tmp2;
+		SseMat34 result;
+
+		tmp0 = VecMul(VecSplat<VecCoord::X>(left.row0), right.row0);
+		tmp1 = VecMul(VecSplat<VecCoord::Y>(left.row0), right.row1);
+		tmp2 = VecMul(VecSplat<VecCoord::Z>(left.row0), right.row2);
+		result.row0 = VecAdd(VecAdd(tmp0, tmp1), VecAdd(tmp2, VecAnd(left.row0, MASK_0001)));
+
+		tmp0 = VecMul(VecSplat<VecCoord::X>(left.row1), right.row0);
+		tmp1 = VecMul(VecSplat<VecCoord::Y>(left.row1), right.row1);
+		tmp2 = VecMul(VecSplat<VecCoord::Z>(left.row1), right.row2);
+		result.row1 = VecAdd(VecAdd(tmp0, tmp1), VecAdd(tmp2, VecAnd(left.row1, MASK_0001)));
+
+		tmp0 = VecMul(VecSplat<VecCoord::X>(left.row2), right.row0);
+		tmp1 = VecMul(VecSplat<VecCoord::Y>(left.row2), right.row1);
+		tmp2 = VecMul(VecSplat<VecCoord::Z>(left.row2), right.row2);
+		result.row2 = VecAdd(VecAdd(tmp0, tmp1), VecAdd(tmp2, VecAnd(left.row2, MASK_0001)));
+
+		return result;
+	}
+
+	/*!
+	 * \brief Calculates the determinant of the given 3x4 affine matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix.
+	 *
+	 * \return	An SseVec holding four copies of the determinant of the upper 3x3 (which is also the
+	 *			determinant of the full affine matrix).
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	inline SseVec MatrixDeterminant(const SseMat34& mat)
+	{
+		return Vec3Dot(mat.row0, Vec3Cross(mat.row1, mat.row2));
+	}
+
+	/*!
+	 * \brief Calculates the inverse of the given 3x4 affine matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal of the determinant is calculated.
+	 * \param	mat	The matrix to invert.
+	 *
+	 * \return	The inverse of the given matrix.
+	 *
+	 * \remarks	The columns of the inverse 3x3 are the cross products of the row pairs over the
+	 *			determinant, and the translation is carried through it and negated.  There is no
+	 *			matrixTypeVal to mark a singular matrix as MatrixType::INVALID, so a singular input gives
+	 *			non-finite values; check MatrixDeterminant first when that can happen.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	inline SseMat34 MatrixInverse(const SseMat34& mat)
+	{
+		SseVec col0 = VecAnd(Vec3Cross(mat.row1, mat.row2), MASK_1110);
+		SseVec col1 = VecAnd(Vec3Cross(mat.row2, mat.row0), MASK_1110);
+		SseVec col2 = VecAnd(Vec3Cross(mat.row0, mat.row1), MASK_1110);
+
+		SseVec detRcp = VecRcp<policy>(Vec3Dot(mat.row0, col0));
+
+		col0 = VecMul(col0, detRcp);
+		col1 = VecMul(col1, detRcp);
+		col2 = VecMul(col2, detRcp);
+
+		SseVec tmp0 = VecMul(col0, VecSplat<VecCoord::W>(mat.row0));
+		SseVec tmp1 = VecMul(col1, VecSplat<VecCoord::W>(mat.row1));
+		SseVec tmp2 = VecMul(col2, VecSplat<VecCoord::W>(mat.row2));
+		SseVec col3 = VecSub(SetVecZero(), VecAdd(VecAdd(tmp0, tmp1), tmp2));
+
+		SseMat44 transposed = MatrixTranspose(SseMat44(col0, col1, col2, col3));
+
+		return SseMat34(transposed.col0, transposed.col1, transposed.col2);
+	}
+
+	/*!
+	 * \brief	Transforms the given point via the given 3x4 affine matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix that will be multiplied against the point.
+	 * \param	vec	The point to transform.  Its w component is ignored and treated as 1.
+	 *
+	 * \return	The transformed point, with a w component of 1.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	SSE_VEC_CALL TransformVec3(const SseMat34& mat, const SseVec& vec)
+	{
+		SseVec point = VecBlend<LEFT, LEFT, LEFT, RIGHT>(vec, UNIT_0001);
+
+		SseVec result = _mm_dp_ps(mat.row0, point, 0xF1);
+		result = VecOr(result, _mm_dp_ps(mat.row1, point, 0xF2));
+		result = VecOr(result, _mm_dp_ps(mat.row2, point, 0xF4));
+
+		return VecOr(result, UNIT_0001);
+	}
+
+	/*!
+	 * \brief	Transforms the given direction via the given 3x4 affine matrix, ignoring its translation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix that will be multiplied against the direction.
+	 * \param	vec	The direction to transform.  Its w component is ignored.
+	 *
+	 * \return	The transformed direction, with a w component of 0.
+	 *
+	 * \relatedalso gofxmath::SseMat34
+	 */
+	SSE_VEC_CALL TransformDirectionVec3(const SseMat34& mat, const SseVec& vec)
+	{
+		SseVec result = _mm_dp_ps(mat.row0, vec, 0x71);
+		result = VecOr(result, _mm_dp_ps(mat.row1, vec, 0x72));
+
+		return VecOr(result, _mm_dp_ps(mat.row2, vec, 0x74));
+	}
+
+	/*! @} */
+}
+#endif // SSE_MAT34_DOT_H
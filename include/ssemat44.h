@@ -8,6 +8,8 @@
 #include "scalar_math.h"
 #include "sisd_defns.h"
 #include <array>
+#include <cstddef>
+#include <cstdint>
 
 /*!
  * \file 
@@ -175,10 +177,10 @@ namespace gofxmath
 		 * 			and sets the matrixTypeVal to the corresponding matrixTypeVal from the Mat44 passed in.
 		 */
 		SseMat44(Mat44& mat) :
-			col0(SetSseVec4(mat.col0.w, mat.col0.x, mat.col0.y, mat.col0.z)),
-			col1(SetSseVec4(mat.col1.w, mat.col1.x, mat.col1.y, mat.col1.z)),
-			col2(SetSseVec4(mat.col2.w, mat.col2.x, mat.col2.y, mat.col2.z)),
-			col3(SetSseVec4(mat.col3.w, mat.col3.x, mat.col3.y, mat.col3.z)),
+			col0(SetSseVec4(mat.col0.x, mat.col0.y, mat.col0.z, mat.col0.w)),
+			col1(SetSseVec4(mat.col1.x, mat.col1.y, mat.col1.z, mat.col1.w)),
+			col2(SetSseVec4(mat.col2.x, mat.col2.y, mat.col2.z, mat.col2.w)),
+			col3(SetSseVec4(mat.col3.x, mat.col3.y, mat.col3.z, mat.col3.w)),
 			matrixTypeVal(mat.matrixTypeVal) {}
 
 		static const SseMat44 IDENTITY; /*!< The identity matrix */
@@ -224,10 +226,39 @@ namespace gofxmath
 	 *
 	 * \return	The post-multiplied product of the two matrices.
 	 *
+	 * \remarks	An IDENTITY factor returns the other factor unchanged, and when both factors are
+	 *			affine (see MatrixTypeIsAffine) the known <0 0 0 1> bottom row is not multiplied
+	 *			through. The result's type is CombineMatrixTypes of the two factors' types.
+	 *
 	 * \relatedalso gofxmath::SseMat44
 	 */
 	SSE_MAT_CALL MatrixMultiply(const SseMat44& left, const SseMat44& right)
 	{
+		if (left.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return right;
+		}
+
+		if (right.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return left;
+		}
+
+		MatrixType resultType = CombineMatrixTypes(left.matrixTypeVal, right.matrixTypeVal);
+
+		if (MatrixTypeIsAffine(resultType))
+		{
+			// The w components of the right matrix's columns are known to be 0 0 0 1,
+			// so the fourth column of the left matrix is only needed once.
+			SseMat44 result;
+			result.col0 = VecAdd(VecAdd(VecMul(left.col0, VecSplat<VecCoord::X>(right.col0)), VecMul(left.col1, VecSplat<VecCoord::Y>(right.col0))), VecMul(left.col2, VecSplat<VecCoord::Z>(right.col0)));
+			result.col1 = VecAdd(VecAdd(VecMul(left.col0, VecSplat<VecCoord::X>(right.col1)), VecMul(left.col1, VecSplat<VecCoord::Y>(right.col1))), VecMul(left.col2, VecSplat<VecCoord::Z>(right.col1)));
+			result.col2 = VecAdd(VecAdd(VecMul(left.col0, VecSplat<VecCoord::X>(right.col2)), VecMul(left.col1, VecSplat<VecCoord::Y>(right.col2))), VecMul(left.col2, VecSplat<VecCoord::Z>(right.col2)));
+			result.col3 = VecAdd(VecAdd(VecMul(left.col0, VecSplat<VecCoord::X>(right.col3)), VecMul(left.col1, VecSplat<VecCoord::Y>(right.col3))), VecAdd(VecMul(left.col2, VecSplat<VecCoord::Z>(right.col3)), left.col3));
+			result.matrixTypeVal = resultType;
+			return result;
+		}
+
 		SseVec tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, leftCol0, leftCol1, leftCol2, leftCol3, res0, res1, res2, res3;
 
 		// Load all the result registers with the columns of the 
@@ -313,27 +344,57 @@ namespace gofxmath
 		res3 = VecAdd(res3, tmp3);
 
 		SseMat44 result(res0, res1, res2, res3);
-		result.matrixTypeVal = (MatrixType)(left.matrixTypeVal | right.matrixTypeVal);
+		result.matrixTypeVal = resultType;
 		return result;
 	}
 
+	SSE_MAT_CALL RigidMatrixInverse(const SseMat44& mat);
+
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	SSE_MAT_CALL AffineMatrixInverse(const SseMat44& mat);
+
 	/*!
 	 * \brief Calculates the inverse of the given 4x4 matrix.
 	 * 
 	 * \date	2/21/2015
 	 *
+	 * \tparam	policy	How the reciprocal of the determinant is calculated.
 	 * \param	mat	The matrix to invert.
 	 *
 	 * \return	The inverse of the given matrix.
 	 *
+	 * \remarks	The default gofxmath::PrecisionPolicy::REFINED takes <CODE>_mm_rcp_ss</CODE> of the
+	 *			determinant with one Newton-Raphson step.  gofxmath::PrecisionPolicy::EXACT divides instead,
+	 *			and gofxmath::PrecisionPolicy::ESTIMATE skips the refinement.
+	 *
+	 *			IDENTITY matrices are returned as-is, rigid types (see MatrixTypeIsRigid) go through
+	 *			RigidMatrixInverse and the other affine types through AffineMatrixInverse; only
+	 *			PROJECTIVE matrices pay for the full cofactor expansion.
+	 *
 	 * \relatedalso gofxmath::SseMat44
 	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
 	SSE_MAT_CALL MatrixInverse(const SseMat44& mat)
 	{
+		if (mat.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return mat;
+		}
+
+		if (MatrixTypeIsRigid(mat.matrixTypeVal))
+		{
+			return RigidMatrixInverse(mat);
+		}
+
+		if (MatrixTypeIsAffine(mat.matrixTypeVal))
+		{
+			return AffineMatrixInverse<policy>(mat);
+		}
+
 		SseVec tmp0, tmp1, tmp2, tmp3;
 		SseVec col0, col1, col2, col3;
 		SseVec minor0, minor1, minor2, minor3;
-		SseVec det;
+		SseVec det, detRcp;
 
 		// 00 01 02 03
 		// 10 11 12 13
@@ -456,17 +517,30 @@ namespace gofxmath
 		det = VecAdd(tmp0, det);
 		tmp0 = VecSwizzle<VecCoord::Y, X, W, Z>(det);// 1 0 3 2
 		det = _mm_add_ss(tmp0, det);
-		tmp1 = _mm_rcp_ss(det);
-		tmp0 = _mm_add_ss(tmp1, tmp1);
-		tmp2 = _mm_mul_ss(tmp1, tmp1);
-		tmp3 = _mm_mul_ss(det, tmp2);
-		det = _mm_sub_ss(tmp0, tmp3);
-		det = VecSplat<VecCoord::X>(det);
-
-		minor0 = VecMul(det, minor0);
-		minor1 = VecMul(det, minor1);
-		minor2 = VecMul(det, minor2);
-		minor3 = VecMul(det, minor3);
+
+		if (policy == PrecisionPolicy::EXACT)
+		{
+			detRcp = _mm_div_ss(_mm_set_ss(1.0f), det);
+		}
+		else
+		{
+			detRcp = _mm_rcp_ss(det);
+
+			if (policy == PrecisionPolicy::REFINED)
+			{
+				tmp0 = _mm_add_ss(detRcp, detRcp);
+				tmp2 = _mm_mul_ss(detRcp, detRcp);
+				tmp3 = _mm_mul_ss(det, tmp2);
+				detRcp = _mm_sub_ss(tmp0, tmp3);
+			}
+		}
+
+		detRcp = VecSplat<VecCoord::X>(detRcp);
+
+		minor0 = VecMul(detRcp, minor0);
+		minor1 = VecMul(detRcp, minor1);
+		minor2 = VecMul(detRcp, minor2);
+		minor3 = VecMul(detRcp, minor3);
 
 		tmp0 = VecShuffle<VecCoord::X, Y, X, Y>(minor0, minor1);// 0 1 0 1
 		tmp1 = VecShuffle<VecCoord::X, Y, X, Y>(minor2, minor3);// 0 1 0 1
@@ -495,6 +569,9 @@ namespace gofxmath
 	 *
 	 * \return	The transpose matrix of the given matrix.
 	 *
+	 * \remarks	IDENTITY, ROTATION and UNIFORM_SCALE matrices keep their type; a transposed
+	 *			translation moves into the bottom row, so any other type becomes PROJECTIVE.
+	 *
 	 * \relatedalso gofxmath::SseMat44
 	 */
 	SSE_MAT_CALL MatrixTranspose(const SseMat44& mat)
@@ -524,7 +601,91 @@ namespace gofxmath
 		// 30 31 32 33
 		col3 = VecShuffle<VecCoord::Y, W, Y, W>(tmp2, tmp3);
 
-		return SseMat44(col0, col1, col2, col3, mat.matrixTypeVal);
+		// Translation (0x2) or general linear (0x10) structure moves into the bottom row
+		MatrixType resultType = (mat.matrixTypeVal != MatrixType::INVALID && (mat.matrixTypeVal & 0x12) != 0) ? MatrixType::PROJECTIVE : mat.matrixTypeVal;
+
+		return SseMat44(col0, col1, col2, col3, resultType);
+	}
+
+	/*!
+	 * \brief	Calculates the inverse of the given rigid (rotation and translation only) matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to invert.  Its upper 3x3 must be orthonormal and its bottom row <0 0 0 1>.
+	 *
+	 * \return	The inverse of the given matrix, with the same matrixTypeVal.
+	 *
+	 * \remarks	The upper 3x3 is transposed and the translation is rotated back by it and negated,
+	 *			so no determinant is needed.  MatrixInverse calls this for matrices whose type satisfies
+	 *			MatrixTypeIsRigid.  The result is only as accurate as the orthonormality of the input;
+	 *			rotations from RotationMatrixFromEuler carry the error of its approximated sine and cosine.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	SSE_MAT_CALL RigidMatrixInverse(const SseMat44& mat)
+	{
+		SseMat44 result = MatrixTranspose(SseMat44(mat.col0, mat.col1, mat.col2, UNIT_0001));
+
+		SseVec tmp0 = VecMul(result.col0, VecSplat<VecCoord::X>(mat.col3));
+		SseVec tmp1 = VecMul(result.col1, VecSplat<VecCoord::Y>(mat.col3));
+		SseVec tmp2 = VecMul(result.col2, VecSplat<VecCoord::Z>(mat.col3));
+
+		tmp0 = VecSub(SetVecZero(), VecAdd(VecAdd(tmp0, tmp1), tmp2));
+
+		result.col3 = VecBlend<LEFT, LEFT, LEFT, RIGHT>(tmp0, UNIT_0001);
+		result.matrixTypeVal = mat.matrixTypeVal;
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Calculates the inverse of the given affine matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal of the determinant is calculated.
+	 * \param	mat	The matrix to invert.  Its bottom row must be <0 0 0 1>.
+	 *
+	 * \return	The inverse of the given matrix, with the same matrixTypeVal, or a matrix with a
+	 *			matrixTypeVal of INVALID if the upper 3x3 is singular.
+	 *
+	 * \remarks	Only the upper 3x3 is inverted (its rows are the cross products of the column pairs over
+	 *			the determinant); the translation is then carried through it and negated.  MatrixInverse
+	 *			calls this for matrices whose type satisfies MatrixTypeIsAffine but not MatrixTypeIsRigid.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<PrecisionPolicy policy>
+	SSE_MAT_CALL AffineMatrixInverse(const SseMat44& mat)
+	{
+		SseVec row0 = VecAnd(Vec3Cross(mat.col1, mat.col2), MASK_1110);
+		SseVec row1 = VecAnd(Vec3Cross(mat.col2, mat.col0), MASK_1110);
+		SseVec row2 = VecAnd(Vec3Cross(mat.col0, mat.col1), MASK_1110);
+
+		SseVec det = Vec3Dot(mat.col0, row0);
+
+		if (_mm_comieq_ss(det, SetVecZero()))
+		{
+			SseMat44 result;
+			result.matrixTypeVal = MatrixType::INVALID;
+			return result;
+		}
+
+		SseVec detRcp = VecRcp<policy>(det);
+
+		SseMat44 result = MatrixTranspose(SseMat44(VecMul(row0, detRcp), VecMul(row1, detRcp), VecMul(row2, detRcp), UNIT_0001));
+
+		SseVec tmp0 = VecMul(result.col0, VecSplat<VecCoord::X>(mat.col3));
+		SseVec tmp1 = VecMul(result.col1, VecSplat<VecCoord::Y>(mat.col3));
+		SseVec tmp2 = VecMul(result.col2, VecSplat<VecCoord::Z>(mat.col3));
+
+		tmp0 = VecSub(SetVecZero(), VecAdd(VecAdd(tmp0, tmp1), tmp2));
+
+		result.col3 = VecBlend<LEFT, LEFT, LEFT, RIGHT>(tmp0, UNIT_0001);
+		result.matrixTypeVal = mat.matrixTypeVal;
+
+		return result;
 	}
 	
 	/*!
@@ -700,9 +861,83 @@ namespace gofxmath
 		// [  (xz - wy)        (yz + wx)      (1 - xx - yy)  0 ]
 		// [      0                0                0        1 ]
 
+		result.matrixTypeVal = MatrixType::ROTATION;
+
 		return result;
 	}
 
+	/*!
+	 * \brief	Calculates the unit quaternion represented by the upper 3x3 of the given rotation matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal square root is calculated (see VecRSqrt).
+	 * \param	mat	The rotation matrix.  Its upper 3x3 is expected to be orthonormal; use DecomposeTRS
+	 *				for matrices that also hold a scale.
+	 *
+	 * \return	The quaternion SseVec <x y z w>, with w kept non-negative.
+	 *
+	 * \remarks Uses Shepperd's method: of the four values %%4x^2%%, %%4y^2%%, %%4z^2%% and %%4w^2%%
+	 *			(each one plus a signed sum of the diagonal), the largest is used to recover its own
+	 *			component, and the other three come from the off-diagonal sums and differences divided
+	 *			by it.  That avoids the cancellation of the trace-only formula for rotations near 180
+	 *			degrees.  All four candidates are built at once and the one with the largest divisor is
+	 *			picked with masks, so there are no data-dependent branches.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	inline SseVec QuaternionFromRotationMatrix(const SseMat44& mat)
+	{
+		SseVec tmp0, tmp1, tmp2;
+		SseVec diagSqr, symm, skew, maxVec, maxMask, result;
+
+		// 4x^2 4y^2 4z^2 4w^2 ========================================================================================================
+		tmp0 = Vec4Negate<false, true, true, false>(VecSplat<VecCoord::X>(mat.col0));// m00 -m00 -m00 m00
+		tmp1 = Vec4Negate<true, false, true, false>(VecSplat<VecCoord::Y>(mat.col1));// -m11 m11 -m11 m11
+		tmp2 = Vec4Negate<true, true, false, false>(VecSplat<VecCoord::Z>(mat.col2));// -m22 -m22 m22 m22
+
+		diagSqr = VecAdd(VecAdd(tmp0, tmp1), VecAdd(tmp2, SSE_VEC_ONE));
+
+		// Off-diagonal sums and differences ==========================================================================================
+		tmp0 = VecShuffle<VecCoord::Z, VecCoord::Z, VecCoord::Y, VecCoord::Y>(mat.col1, mat.col0);// m21 m21 m10 m10
+		tmp0 = VecBlend<LEFT, RIGHT, LEFT, LEFT>(tmp0, VecSplat<VecCoord::X>(mat.col2));// m21 m02 m10 na
+		tmp1 = VecShuffle<VecCoord::Y, VecCoord::Y, VecCoord::X, VecCoord::X>(mat.col2, mat.col1);// m12 m12 m01 m01
+		tmp1 = VecBlend<LEFT, RIGHT, LEFT, LEFT>(tmp1, VecSplat<VecCoord::Z>(mat.col0));// m12 m20 m01 na
+
+		symm = VecAdd(tmp0, tmp1);// 4yz 4xz 4xy na
+		skew = VecSub(tmp0, tmp1);// 4wx 4wy 4wz na
+
+		// Pick the candidate with the largest divisor ================================================================================
+		maxVec = VecHMax(diagSqr);
+		maxMask = VecCmpEQ(diagSqr, maxVec);
+
+		result = VecBlend<LEFT, LEFT, LEFT, RIGHT>(skew, diagSqr);// 4wx 4wy 4wz 4ww
+
+		tmp0 = VecSwizzle<VecCoord::Y, VecCoord::X, VecCoord::NA, VecCoord::NA>(symm);// 4xz 4yz na na
+		tmp0 = VecBlend<LEFT, LEFT, RIGHT, LEFT>(tmp0, diagSqr);// 4xz 4yz 4zz na
+		tmp0 = VecBlend<LEFT, LEFT, LEFT, RIGHT>(tmp0, VecSplat<VecCoord::Z>(skew));// 4xz 4yz 4zz 4wz
+		result = _mm_blendv_ps(result, tmp0, VecSplat<VecCoord::Z>(maxMask));
+
+		tmp0 = VecSwizzle<VecCoord::Z, VecCoord::NA, VecCoord::X, VecCoord::NA>(symm);// 4xy na 4yz na
+		tmp0 = VecBlend<LEFT, RIGHT, LEFT, LEFT>(tmp0, diagSqr);// 4xy 4yy 4yz na
+		tmp0 = VecBlend<LEFT, LEFT, LEFT, RIGHT>(tmp0, VecSplat<VecCoord::Y>(skew));// 4xy 4yy 4yz 4wy
+		result = _mm_blendv_ps(result, tmp0, VecSplat<VecCoord::Y>(maxMask));
+
+		tmp0 = VecSwizzle<VecCoord::NA, VecCoord::Z, VecCoord::Y, VecCoord::NA>(symm);// na 4xy 4xz na
+		tmp0 = VecBlend<RIGHT, LEFT, LEFT, LEFT>(tmp0, diagSqr);// 4xx 4xy 4xz na
+		tmp0 = VecBlend<LEFT, LEFT, LEFT, RIGHT>(tmp0, VecSplat<VecCoord::X>(skew));// 4xx 4xy 4xz 4wx
+		result = _mm_blendv_ps(result, tmp0, VecSplat<VecCoord::X>(maxMask));
+
+		// Each candidate is 4q_i * q, and sqrt(4q_i^2) = 2|q_i| ======================================================================
+		result = VecMul(result, VecMul(SetSseVec4(0.5f), VecRSqrt<policy>(maxVec)));
+
+		// Keep w non-negative ========================================================================================================
+		tmp0 = VecAnd(VecSplat<VecCoord::W>(result), SetSseVec4(-0.0f));
+
+		return VecXOr(result, tmp0);
+	}
+
 	/*!
 	 * \brief Calculates the 4x4 rotation matrix represented by the given euler angle rotation.
 	 * 
@@ -766,6 +1001,8 @@ namespace gofxmath
 
 		result.col3 = UNIT_0001;
 
+		result.matrixTypeVal = MatrixType::ROTATION;
+
 		return result;
 	}
 
@@ -788,6 +1025,8 @@ namespace gofxmath
 		result.col2 = UNIT_0010;
 		result.col3 = vec;
 
+		result.matrixTypeVal = MatrixType::TRANSLATION;
+
 		return result;
 	}
 
@@ -810,6 +1049,10 @@ namespace gofxmath
 		result.col2 = VecAnd(vec, MASK_0010);
 		result.col3 = UNIT_0001;
 
+		// Uniform when x == y == z
+		SseVec equalMask = VecCmpEQ(vec, VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::W>(vec));
+		result.matrixTypeVal = Vec3AllTrue(equalMask) ? MatrixType::UNIFORM_SCALE : MatrixType::AFFINE;
+
 		return result;
 	}
 
@@ -818,6 +1061,7 @@ namespace gofxmath
 	 * 
 	 * \date	2/21/2015
 	 *
+	 * \tparam	policy	How the divisions are calculated.
 	 * \param	near  	The distance to the near clip plane.
 	 * \param	far   	The distance to the far clip plane.
 	 * \param	fov   	The vertical field of view angle.
@@ -846,20 +1090,37 @@ namespace gofxmath
 	 * This is the SseMat44 equivalent of the Mat44 version of this function:<BR>
 	 * PerspectiveProjectionMatrix(float near, float far, float fov, float aspect, Mat44& result)
 	 *
+	 * With PrecisionPolicy::EXACT, the scalar divisions are done as before.  Otherwise, the four divisions are
+	 * done in one VecDiv with the given policy.
+	 *
 	 * \sa void PerspectiveProjectionMatrix(float near, float far, float fov, float aspect, Mat44& result)
 	 *
 	 * \relatedalso gofxmath::SseMat44
 	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
 	SSE_MAT_CALL PerspectiveProjectionMatrix(float near, float far, float fov, float aspect)
 	{		
 		SseMat44 result;
-		static const SseVec NEGATIVE_UNIT_0001 = Vec4Negate(UNIT_0001);
+		static constexpr SseVecConst NEGATIVE_UNIT_0001 = { { -0.0f, -0.0f, -0.0f, -1.0f } };
+
+		SseVec tmp0;
+
+		if (policy == PrecisionPolicy::EXACT)
+		{
+			float farDistOverDepth = far / (far - near);
+			float cotFOV = CotApprox(fov*0.5f);
+
+			// Multiply the second cotFOV by the aspect ratio to reduce stretching near the edges.
+			tmp0 = SetSseVec4(cotFOV, cotFOV * aspect, -farDistOverDepth, -farDistOverDepth * near);
+		}
+		else
+		{
+			float tanFOV = TanApprox(fov*0.5f);
+			float depth = far - near;
+
+			tmp0 = VecDiv<policy>(SetSseVec4(1.0f, aspect, -far, -far * near), SetSseVec4(tanFOV, tanFOV, depth, depth));
+		}
 
-		float farDistOverDepth = far / (far - near);
-		float cotFOV = CotApprox(fov*0.5f);
-		
-		// Multiply the second cotFOV by the aspect ratio to reduce stretching near the edges.
-		SseVec tmp0 = SetSseVec4(cotFOV, cotFOV * aspect, -farDistOverDepth, -farDistOverDepth * near);
 		SseVec zero = SetVecZero();
 		
         result.col0 = VecBlend<RIGHT, LEFT, LEFT, LEFT>(zero, tmp0);//				    [cotFOV	    0.0f			  0.0f		 0.0f]
@@ -868,6 +1129,8 @@ namespace gofxmath
 		tmp0 = VecSwizzle<VecCoord::X, Y, W, Z>(tmp0);
         result.col3 = VecBlend<LEFT, LEFT, RIGHT, LEFT>(zero, tmp0);//					[0.0f		0.0f			 -fn/(f-n)	 0.0f]
 
+		result.matrixTypeVal = MatrixType::PROJECTIVE;
+
 		return result;
 	}
 
@@ -877,6 +1140,7 @@ namespace gofxmath
 	 *
 	 * \date	2/21/2015
 	 *
+	 * \tparam	policy	How the axes are normalized (see Vec3Normalize).
 	 * \param	eye	The position of the camera, in world space.
 	 * \param	dir	The direction the camera is facing.
 	 * \param	up 	The camera's relative "up" direction - should always be <0 1 0> 
@@ -887,12 +1151,13 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::SseMat44
 	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
 	SSE_MAT_CALL LookDir(const SseVec& eye, const SseVec& dir, const SseVec& up)
 	{
 		SseMat44 result;
 		SseVec zero = SetVecZero();
-		SseVec fwdAxis = Vec3Normalize(dir);
-		SseVec rightAxis = Vec3Normalize(Vec3Cross(fwdAxis, up));
+		SseVec fwdAxis = Vec3Normalize<policy>(dir);
+		SseVec rightAxis = Vec3Normalize<policy>(Vec3Cross(fwdAxis, up));
 		SseVec upAxis = Vec3Cross(rightAxis, fwdAxis);
 
 		SseVec negativeDir = Vec3Negate(fwdAxis);
@@ -946,6 +1211,8 @@ namespace gofxmath
 		// -dx -dy -dz  dDPe
 		//  0   0   0   1
 
+		result.matrixTypeVal = MatrixType::RIGID;
+
 		return result;
 	}
 
@@ -955,6 +1222,7 @@ namespace gofxmath
 	 *
 	 * \date	2/21/2015
 	 *
+	 * \tparam	policy	How the axes are normalized (see Vec3Normalize).
 	 * \param	eye   	The position of the camera, in world space.
 	 * \param	target	The position of the target that the camera is facing.
 	 * \param	up	  	The camera's relative "up" direction - should always be <0 1 0> 
@@ -965,10 +1233,11 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::SseMat44
 	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
 	SSE_MAT_CALL LookAt(const SseVec& eye, const SseVec& target, const SseVec& up)
 	{
 		SseVec dir = VecSub(target, eye);
-		return LookDir(eye, dir, up);
+		return LookDir<policy>(eye, dir, up);
 	}
 
 	/*!
@@ -985,6 +1254,16 @@ namespace gofxmath
 	 */
 	inline SseVec TransformVec3(const SseMat44& mat, const SseVec& vec)
 	{
+		if (mat.matrixTypeVal == MatrixType::IDENTITY)
+		{
+			return VecBlend<LEFT, LEFT, LEFT, RIGHT>(vec, UNIT_0001);
+		}
+
+		if (mat.matrixTypeVal == MatrixType::TRANSLATION)
+		{
+			return VecBlend<LEFT, LEFT, LEFT, RIGHT>(VecAdd(vec, mat.col3), UNIT_0001);
+		}
+
 		SseVec result;
 		SseVec xVec, yVec, zVec;
 		SseVec tmp0, tmp1, tmp2, tmp3;
@@ -1006,6 +1285,451 @@ namespace gofxmath
 		return result;
 	}
 
+	/*!
+	 * \brief	Writes one result of a batch function with the given StorePolicy.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	Whether to use ordinary or non-temporal stores.
+	 * \param	result	The destination.
+	 * \param	mat   	The matrix to write, including its matrixTypeVal.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<StorePolicy storePolicy>
+	inline void BatchStore(SseMat44* result, const SseMat44& mat)
+	{
+		BatchStore<storePolicy>(&result->col0, mat.col0);
+		BatchStore<storePolicy>(&result->col1, mat.col1);
+		BatchStore<storePolicy>(&result->col2, mat.col2);
+		BatchStore<storePolicy>(&result->col3, mat.col3);
+
+		if (storePolicy == StorePolicy::STREAMING)
+		{
+			_mm_stream_si32(reinterpret_cast<int*>(&result->matrixTypeVal), mat.matrixTypeVal);
+		}
+		else
+		{
+			result->matrixTypeVal = mat.matrixTypeVal;
+		}
+	}
+
+	/*!
+	 * \brief	Multiplies every pair of matrices in the given arrays, such as the model matrices of many
+	 *			objects by a shared view-projection matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the inputs (see BatchPrefetch).
+	 * \param	lefts  	The left matrices.
+	 * \param	rights 	The right matrices.
+	 * \param	results	The array receiving the products.  May alias either input.
+	 * \param	count  	The number of matrix pairs.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void MatrixMultiplyBatch(const SseMat44* lefts, const SseMat44* rights, SseMat44* results, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			BatchPrefetch<prefetchDistance>(lefts, i, count);
+			BatchPrefetch<prefetchDistance>(rights, i, count);
+			BatchStore<storePolicy>(results + i, MatrixMultiply(lefts[i], rights[i]));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Transforms every 3D point in the given array via the given SseMat44 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	mat	   	The matrix that will be multiplied against the points.
+	 * \param	vecs   	The 3D points to transform.
+	 * \param	results	The array receiving the transformed points.  May alias vecs.
+	 * \param	count  	The number of points.
+	 *
+	 * \remarks	The matrix columns stay in registers for the whole loop.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void TransformVec3Batch(const SseMat44& mat, const SseVec* vecs, SseVec* results, size_t count)
+	{
+		const SseMat44 local = mat;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+			BatchStore<storePolicy>(results + i, TransformVec3(local, vecs[i]));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Transforms every packed 3D point in the given array via the given SseMat44 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	mat	   	The matrix that will be multiplied against the points.
+	 * \param	vecs   	The packed 3D points to transform.
+	 * \param	results	The array receiving the transformed points.  May alias vecs.
+	 * \param	count  	The number of points.
+	 *
+	 * \remarks	Streams the packed array four points at a time (see LoadSseVec3PQuad), with no
+	 *			intermediate SseVec array, so vertex and point buffers can be transformed in place.
+	 *
+	 *			With STREAMING, the blocks of four are streamed when results is 16-byte aligned (and
+	 *			written normally otherwise); the last count % 4 vectors are always written normally.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void TransformVec3PBatch(const SseMat44& mat, const Vec3P* vecs, Vec3P* results, size_t count)
+	{
+		const SseMat44 local = mat;
+		const bool stream = storePolicy == StorePolicy::STREAMING && (reinterpret_cast<uintptr_t>(results) & 0xF) == 0;
+		SseVec tmp[4];
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+			LoadSseVec3PQuad(vecs + i, tmp);
+
+			for (int j = 0; j < 4; ++j)
+			{
+				tmp[j] = TransformVec3(local, tmp[j]);
+			}
+
+			if (stream)
+			{
+				StoreSseVec3PQuad<StorePolicy::STREAMING>(tmp, results + i);
+			}
+			else
+			{
+				StoreSseVec3PQuad(tmp, results + i);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			results[i] = StoreSseVec3P(TransformVec3(local, LoadSseVec3P(vecs[i])));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Transforms one packed 3D attribute (such as the position) of every vertex in an interleaved
+	 *			vertex buffer via the given SseMat44 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat		 	The matrix that will be multiplied against the points.
+	 * \param	src		 	The start of the source buffer.
+	 * \param	srcStride	The size of one source vertex, in bytes.
+	 * \param	srcOffset	The offset of the Vec3P attribute within a source vertex, in bytes.
+	 * \param	dst		 	The start of the destination buffer.  May be src, to transform in place.
+	 * \param	dstStride	The size of one destination vertex, in bytes.
+	 * \param	dstOffset	The offset of the Vec3P attribute within a destination vertex, in bytes.
+	 * \param	count	 	The number of vertices.
+	 *
+	 * \remarks	The attributes are treated as points (with a w component of 1).  Only the 12 bytes of each
+	 *			attribute are read and written, so the other attributes of the vertices are untouched and
+	 *			no separate Vec3 array is needed.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 *
+	 * \sa StridedAttribute
+	 */
+	inline void TransformVec3PStrided(const SseMat44& mat, const void* src, size_t srcStride, size_t srcOffset,
+		void* dst, size_t dstStride, size_t dstOffset, size_t count)
+	{
+		const SseMat44 local = mat;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			SseVec vec = LoadSseVec3P(*StridedAttribute<Vec3P>(src, srcStride, srcOffset, i));
+			*StridedAttribute<Vec3P>(dst, dstStride, dstOffset, i) = StoreSseVec3P(TransformVec3(local, vec));
+		}
+	}
+
+	/*!
+	 * \brief	Skins one packed 3D attribute of every vertex in an interleaved vertex buffer, blending up
+	 *			to four bone matrices per vertex (linear blend skinning).
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	isPoint	true to skin positions (w of 1, so the bone translations apply), false to skin
+	 *					directions such as normals (w of 0).
+	 * \param	bones		 	The bone matrices.
+	 * \param	src			 	The start of the source buffer.
+	 * \param	srcStride	 	The size of one source vertex, in bytes.
+	 * \param	srcOffset	 	The offset of the Vec3P attribute within a source vertex, in bytes.
+	 * \param	indexOffset	 	The offset of the four uint8_t bone indices within a source vertex, in
+	 *							bytes.
+	 * \param	weightOffset 	The offset of the four float bone weights within a source vertex, in bytes.
+	 * \param	dst			 	The start of the destination buffer.  May be src, to skin in place.
+	 * \param	dstStride	 	The size of one destination vertex, in bytes.
+	 * \param	dstOffset	 	The offset of the Vec3P attribute within a destination vertex, in bytes.
+	 * \param	count		 	The number of vertices.
+	 *
+	 * \remarks	Each vertex is transformed by %%\sum_{i} w_i B_{j_i}%%, the weighted sum of its bone
+	 *			matrices.  The weights are expected to sum to 1 (unused slots should have a weight of 0),
+	 *			and the indices are not range checked.  Skinned normals are not renormalized; follow with
+	 *			Vec3PNormalizeStrided when needed.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 *
+	 * \sa StridedAttribute
+	 */
+	template<bool isPoint = true>
+	inline void SkinVec3PStrided(const SseMat44* bones, const void* src, size_t srcStride, size_t srcOffset,
+		size_t indexOffset, size_t weightOffset, void* dst, size_t dstStride, size_t dstOffset, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			const uint8_t* indices = StridedAttribute<uint8_t>(src, srcStride, indexOffset, i);
+			SseVec weights = _mm_loadu_ps(StridedAttribute<float>(src, srcStride, weightOffset, i));
+			SseVec vec = LoadSseVec3P(*StridedAttribute<Vec3P>(src, srcStride, srcOffset, i));
+
+			SseVec cols[4];
+			SseVec weight = VecSplat<VecCoord::X>(weights);
+			const SseMat44* bone = bones + indices[0];
+			cols[0] = VecMul(bone->col0, weight);
+			cols[1] = VecMul(bone->col1, weight);
+			cols[2] = VecMul(bone->col2, weight);
+			cols[3] = VecMul(bone->col3, weight);
+
+			for (int j = 1; j < 4; ++j)
+			{
+				weights = VecSwizzle<Y, Z, W, X>(weights);// the next weight moves into x
+				weight = VecSplat<VecCoord::X>(weights);
+				bone = bones + indices[j];
+				cols[0] = VecAdd(cols[0], VecMul(bone->col0, weight));
+				cols[1] = VecAdd(cols[1], VecMul(bone->col1, weight));
+				cols[2] = VecAdd(cols[2], VecMul(bone->col2, weight));
+				cols[3] = VecAdd(cols[3], VecMul(bone->col3, weight));
+			}
+
+			SseVec result = VecAdd(VecMul(cols[0], VecSplat<VecCoord::X>(vec)), VecMul(cols[1], VecSplat<VecCoord::Y>(vec)));
+			result = VecAdd(result, VecMul(cols[2], VecSplat<VecCoord::Z>(vec)));
+
+			if (isPoint)
+			{
+				result = VecAdd(result, cols[3]);
+			}
+
+			*StridedAttribute<Vec3P>(dst, dstStride, dstOffset, i) = StoreSseVec3P(result);
+		}
+	}
+
+	/*!
+	 * \brief	Decomposes the given affine matrix into a translation, a rotation and a scale.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the divisions and reciprocal square roots are calculated.
+	 * \param	mat					The matrix to decompose.  Its bottom row is ignored.
+	 * \param [out]	translation	The translation, with a w component of 1 (see TranslationMatrixFromVec3).
+	 * \param [out]	rotation   	The unit quaternion rotation (see QuaternionFromRotationMatrix).
+	 * \param [out]	scale	   	The scale along each axis, with a w component of 1 (see
+	 *							ScaleMatrixFromVec3).
+	 *
+	 * \return	false if the matrix has the type MatrixType::INVALID or a zero scale along any axis, in
+	 *			which case the rotation is set to the identity quaternion; true otherwise.
+	 *
+	 * \remarks The matrix is taken to be translation * rotation * scale.  A mirroring (negative
+	 *			determinant) matrix comes back with all three scales negated, so that the rotation is
+	 *			still a proper one.  Shear cannot be represented and is folded into the rotation
+	 *			approximately.  Rigid matrix types skip the scale extraction.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
+	inline bool DecomposeTRS(const SseMat44& mat, SseVec& translation, SseVec& rotation, SseVec& scale)
+	{
+		translation = VecBlend<LEFT, LEFT, LEFT, RIGHT>(mat.col3, UNIT_0001);
+
+		if (MatrixTypeIsRigid(mat.matrixTypeVal))
+		{
+			scale = SSE_VEC_ONE;
+			rotation = mat.matrixTypeVal == MatrixType::IDENTITY || mat.matrixTypeVal == MatrixType::TRANSLATION ?
+				UNIT_0001 : QuaternionFromRotationMatrix<policy>(mat);
+
+			return true;
+		}
+
+		SseVec lengthSqr = _mm_dp_ps(mat.col0, mat.col0, 0x71);
+		lengthSqr = VecOr(lengthSqr, _mm_dp_ps(mat.col1, mat.col1, 0x72));
+		lengthSqr = VecOr(lengthSqr, _mm_dp_ps(mat.col2, mat.col2, 0x74));// sx^2 sy^2 sz^2 0
+
+		// A mirroring matrix gets all three scales negated ===========================================================================
+		SseVec detSign = VecAnd(Vec3Dot(mat.col0, Vec3Cross(mat.col1, mat.col2)), SetSseVec4(-0.0f));
+
+		scale = VecXOr(VecSqrt<policy>(lengthSqr), VecAnd(detSign, MASK_1110));
+		scale = VecBlend<LEFT, LEFT, LEFT, RIGHT>(scale, UNIT_0001);
+
+		if (mat.matrixTypeVal == MatrixType::INVALID || Vec3AnyTrue(VecCmpEQ(lengthSqr, SetVecZero())))
+		{
+			rotation = UNIT_0001;
+
+			return false;
+		}
+
+		SseVec scaleRcp = VecDiv<policy>(SSE_VEC_ONE, scale);
+		SseMat44 rotationMat(
+			VecMul(mat.col0, VecSplat<VecCoord::X>(scaleRcp)),
+			VecMul(mat.col1, VecSplat<VecCoord::Y>(scaleRcp)),
+			VecMul(mat.col2, VecSplat<VecCoord::Z>(scaleRcp)),
+			UNIT_0001, MatrixType::ROTATION);
+
+		rotation = QuaternionFromRotationMatrix<policy>(rotationMat);
+
+		return true;
+	}
+
+	/*!
+	 * \brief	Decomposes each of the given affine matrices into a translation, a rotation and a scale.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the divisions and reciprocal square roots are calculated.
+	 * \param	mats				The matrices to decompose.
+	 * \param [out]	translations	The translations; the same length as mats.
+	 * \param [out]	rotations   	The quaternion rotations; the same length as mats.
+	 * \param [out]	scales	   	The scales; the same length as mats.
+	 * \param	count				The number of matrices.
+	 *
+	 * \return	true if every matrix could be decomposed (see DecomposeTRS).
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
+	inline bool DecomposeTRSBatch(const SseMat44* mats, SseVec* translations, SseVec* rotations, SseVec* scales, size_t count)
+	{
+		bool succeeded = true;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			succeeded &= DecomposeTRS<policy>(mats[i], translations[i], rotations[i], scales[i]);
+		}
+
+		return succeeded;
+	}
+
+	/*!
+	 * \brief	Check for approximate equality of all sixteen values of two SseMat44s.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precision	The precision level to use for the approximation.
+	 * \param	left 	The first matrix.
+	 * \param	right	The second matrix.
+	 *
+	 * \return	true if every pair of values is within the given precision epsilon of one another (as
+	 *			with ApproxEqual), otherwise false.
+	 *
+	 * \remarks Only the values are compared; the matrixTypeVal members are not.  The four column
+	 *			masks are combined and answered with one VecMoveMask.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<FloatPrecision precision = FloatPrecision::HIGH>
+	inline bool SseMat44ApproxEqual(const SseMat44& left, const SseMat44& right)
+	{
+		const SseVec EPSILON_1111 = SetSseVec4(FloatPrecisionValue<precision>());
+
+		SseVec mask0 = VecCmpLE(Vec4Abs(VecSub(left.col0, right.col0)), EPSILON_1111);
+		SseVec mask1 = VecCmpLE(Vec4Abs(VecSub(left.col1, right.col1)), EPSILON_1111);
+		SseVec mask2 = VecCmpLE(Vec4Abs(VecSub(left.col2, right.col2)), EPSILON_1111);
+		SseVec mask3 = VecCmpLE(Vec4Abs(VecSub(left.col3, right.col3)), EPSILON_1111);
+
+		return VecAllTrue(VecAnd(VecAnd(mask0, mask1), VecAnd(mask2, mask3)));
+	}
+
+	/*!
+	 * \brief	Checks whether any value of the given matrix is NaN or infinite.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to check.
+	 *
+	 * \return	true if any of the sixteen values is NaN or infinite, otherwise false.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	inline bool HasNaNOrInf(const SseMat44& mat)
+	{
+		SseVec mask = VecOr(VecOr(VecNaNOrInfMask(mat.col0), VecNaNOrInfMask(mat.col1)),
+			VecOr(VecNaNOrInfMask(mat.col2), VecNaNOrInfMask(mat.col3)));
+
+		return VecAnyTrue(mask);
+	}
+
+	/*!
+	 * \brief	Finds the first matrix in the given array with a NaN or infinite value.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mats 	The matrices to check.
+	 * \param	count	The number of matrices.
+	 *
+	 * \return	The index of the first matrix for which HasNaNOrInf is true, or count if there is none.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	inline size_t FindNaNOrInf(const SseMat44* mats, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (HasNaNOrInf(mats[i]))
+			{
+				return i;
+			}
+		}
+
+		return count;
+	}
+
+	/*!
+	 * \brief	Finds the first pair of matrices in the given arrays that are not approximately equal.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precision	The precision level to use for the approximation.
+	 * \param	left 	The first array of matrices.
+	 * \param	right	The second array of matrices; the same length as left.
+	 * \param	count	The number of matrices in each array.
+	 *
+	 * \return	The index of the first pair for which SseMat44ApproxEqual is false, or count if there is
+	 *			none.
+	 *
+	 * \relatedalso gofxmath::SseMat44
+	 */
+	template<FloatPrecision precision = FloatPrecision::HIGH>
+	inline size_t FindApproxUnequal(const SseMat44* left, const SseMat44* right, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (!SseMat44ApproxEqual<precision>(left[i], right[i]))
+			{
+				return i;
+			}
+		}
+
+		return count;
+	}
+
 	/*! @} */
 }
 #endif // SSE_MAT44_DOT_H
\ No newline at end of file
@@ -0,0 +1,581 @@
+#ifndef SSE_MAT44D_DOT_H
+#define SSE_MAT44D_DOT_H
+
+#include "ssemat_math_defs.h"
+#include "ssevecd.h"
+#include "ssemat44.h"
+#include "sisd_defns.h"
+#include <array>
+#include <cstddef>
+
+/*!
+ * \file
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SIMDMatMath
+	 * @{
+	 */
+
+	/*!
+	 * \class SseMat44D
+	 *
+	 * \brief	A 4x4 column-major double-precision matrix that uses four SseVecDs for column vectors.
+	 *
+	 * \remarks This class is meant for large-world coordinates, where single-precision world
+	 *			positions lose sub-millimeter accuracy a few kilometers from the origin.  World
+	 *			transforms are kept in double precision, and rebased relative to the camera
+	 *			into SseMat44s right before rendering.
+	 *
+	 * \sa RebaseToCameraRelative(const SseMat44D*, const SseVecD&, SseMat44*, size_t)
+	 */
+	ALIGNED_CLASS(32) SseMat44D
+	{
+	public:
+		MatrixType matrixTypeVal;/*!< A MatrixType used to track the matrix state.
+								 *	\sa MatrixType
+								 */
+
+		SseVecD col0;/*!< The first column vector
+					  *	 \sa SseVecD
+					  */
+
+		SseVecD col1;/*!< The second column vector
+					  *	 \sa SseVecD
+					  */
+
+		SseVecD col2;/*!< The third column vector
+					  *	 \sa SseVecD
+					  */
+
+		SseVecD col3;/*!< The fourth column vector
+					  *	 \sa SseVecD
+					  */
+
+		/*!
+		 * \brief	Empty SseMat44D constructor.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \remarks Sets all member columns to zerovectors,
+		 * 		    and sets the matrixTypeVal to MatrixType::MISC.
+		 */
+		SseMat44D() :
+			matrixTypeVal(MatrixType::MISC),
+			col0(SetVecDZero()),
+			col1(SetVecDZero()),
+			col2(SetVecDZero()),
+			col3(SetVecDZero()) {}
+
+		/*!
+		 * \brief SseMat44D constructor that takes SseVecD arguments to fill the columns,
+		 * 		  and an optional MatrixType argument to initialize its state.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	v0	 	An SseVecD that will be placed in the first column.
+		 * \param	v1	 	An SseVecD that will be placed in the second column.
+		 * \param	v2	 	An SseVecD that will be placed in the third column.
+		 * \param	v3	 	An SseVecD that will be placed in the fourth column.
+		 * \param	matrixTypeVal	The matrix type value.  Defaults as MatrixType::MISC
+		 */
+		SseMat44D(const SseVecD& v0, const SseVecD& v1, const SseVecD& v2, const SseVecD& v3, MatrixType matrixTypeVal = MatrixType::MISC) :
+			matrixTypeVal(matrixTypeVal),
+			col0(v0),
+			col1(v1),
+			col2(v2),
+			col3(v3) {}
+
+		/*!
+		 * \brief	An SseMat44D constructor that takes 16 doubles.
+		 *
+		 * \remarks Each four doubles correspond to the columns of the resulting matrix.
+		 *
+		 * \date	10/18/2026
+		 */
+		SseMat44D(double f00, double f10, double f20, double f30,
+				  double f01, double f11, double f21, double f31,
+				  double f02, double f12, double f22, double f32,
+				  double f03, double f13, double f23, double f33,
+				  MatrixType matrixTypeVal = MatrixType::MISC) :
+				  matrixTypeVal(matrixTypeVal),
+				  col0(SetSseVecD4(f00, f10, f20, f30)),
+				  col1(SetSseVecD4(f01, f11, f21, f31)),
+				  col2(SetSseVecD4(f02, f12, f22, f32)),
+				  col3(SetSseVecD4(f03, f13, f23, f33)) {}
+
+		/*!
+		 * \brief	A widening conversion constructor from SseMat44 to SseMat44D.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	mat	The SseMat44 matrix to copy from.
+		 */
+		explicit SseMat44D(const SseMat44& mat) :
+			matrixTypeVal(mat.matrixTypeVal),
+			col0(ToSseVecD(mat.col0)),
+			col1(ToSseVecD(mat.col1)),
+			col2(ToSseVecD(mat.col2)),
+			col3(ToSseVecD(mat.col3)) {}
+
+		/*!
+		 * \brief	Gets the identity matrix.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \return	The 4x4 double-precision identity matrix.
+		 */
+		static SseMat44D Identity()
+		{
+			return SseMat44D(
+				SetSseVecD4(1.0, 0.0, 0.0, 0.0),
+				SetSseVecD4(0.0, 1.0, 0.0, 0.0),
+				SetSseVecD4(0.0, 0.0, 1.0, 0.0),
+				SetSseVecD4(0.0, 0.0, 0.0, 1.0),
+				MatrixType::IDENTITY);
+		}
+	};
+
+	/*!
+	 * \brief Converts the given 4x4 matrix to an array of doubles.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to convert to an array.
+	 *
+	 * \return	The array of doubles representing the given 4x4 matrix, in column-major order.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline std::array<double, 16> MatrixToArray(const SseMat44D& mat)
+	{
+		std::array<double, 16> result;
+
+		StoreSseVecD4(result.data(), mat.col0);
+		StoreSseVecD4(result.data() + 4, mat.col1);
+		StoreSseVecD4(result.data() + 8, mat.col2);
+		StoreSseVecD4(result.data() + 12, mat.col3);
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Narrows the given double-precision matrix into an SseMat44.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to narrow.
+	 *
+	 * \return	The SseMat44 holding the matrix values rounded to single precision.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	SSE_MAT_CALL ToSseMat44(const SseMat44D& mat)
+	{
+		return SseMat44(ToSseVec(mat.col0), ToSseVec(mat.col1), ToSseVec(mat.col2), ToSseVec(mat.col3), mat.matrixTypeVal);
+	}
+
+	/*!
+	 * \brief	Multiplies the given matrix column by a column vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to multiply by.
+	 * \param	vec	The column vector being multiplied.
+	 *
+	 * \return	The product of the matrix and the given column vector.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	SSE_VECD_CALL MatrixMulColumn(const SseMat44D& mat, const SseVecD& vec)
+	{
+		SseVecD tmp0, tmp1, tmp2, tmp3;
+
+		tmp0 = VecMul(mat.col0, VecSplat<VecCoord::X>(vec));
+		tmp1 = VecMul(mat.col1, VecSplat<VecCoord::Y>(vec));
+		tmp2 = VecMul(mat.col2, VecSplat<VecCoord::Z>(vec));
+		tmp3 = VecMul(mat.col3, VecSplat<VecCoord::W>(vec));
+
+		tmp0 = VecAdd(tmp0, tmp1);
+		tmp2 = VecAdd(tmp2, tmp3);
+
+		return VecAdd(tmp0, tmp2);
+	}
+
+	/*!
+	 * \brief Calculates the product (post-multiplication) of the two given 4x4 matrices.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	left 	The left matrix.
+	 * \param	right	The right matrix.
+	 *
+	 * \return	The post-multiplied product of the two matrices.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline SseMat44D MatrixMultiply(const SseMat44D& left, const SseMat44D& right)
+	{
+		SseMat44D result(
+			MatrixMulColumn(left, right.col0),
+			MatrixMulColumn(left, right.col1),
+			MatrixMulColumn(left, right.col2),
+			MatrixMulColumn(left, right.col3));
+		result.matrixTypeVal = CombineMatrixTypes(left.matrixTypeVal, right.matrixTypeVal);
+		return result;
+	}
+
+	/*!
+	 * \brief Calculates the inverse of the given 4x4 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to invert.
+	 *
+	 * \return	The inverse of the given matrix.
+	 *
+	 * \remarks	Uses the same cofactor method as the SseMat44 version, but takes the exact
+	 *			reciprocal of the determinant rather than a refined estimate.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline SseMat44D MatrixInverse(const SseMat44D& mat)
+	{
+		SseVecD tmp0, tmp1, tmp2, tmp3;
+		SseVecD col0, col1, col2, col3;
+		SseVecD minor0, minor1, minor2, minor3;
+		SseVecD det;
+
+		// Load the registers
+		col0 = mat.col0;
+		col1 = mat.col1;
+		col2 = mat.col2;
+		col3 = mat.col3;
+
+		col1 = VecSwizzle<VecCoord::Z, W, X, Y>(col1);// 2 3 0 1
+		col3 = VecSwizzle<VecCoord::Z, W, X, Y>(col3);// 2 3 0 1
+
+		// Calculate Cofactors
+		// 1 -----------------------------------------------
+		tmp2 = VecMul(col2, col3);
+		tmp0 = VecSwizzle<VecCoord::Y, X, W, Z>(tmp2);// 1 0 3 2
+		tmp1 = VecSwizzle<W, Z, Y, X>(tmp2);// 3 2 1 0
+
+		minor0 = VecMul(col1, tmp0);
+		minor1 = VecMul(col0, tmp0);
+
+		tmp2 = VecMul(col1, tmp1);
+		tmp1 = VecMul(col0, tmp1);
+		minor0 = VecSub(tmp2, minor0);
+		minor1 = VecSub(tmp1, minor1);
+
+		// 2 -----------------------------------------------
+		tmp2 = VecMul(col1, col2);
+		tmp0 = VecSwizzle<VecCoord::Y, X, W, Z>(tmp2);// 1 0 3 2
+		tmp1 = VecSwizzle<W, Z, Y, X>(tmp2);// 3 2 1 0
+		minor1 = VecSwizzle<VecCoord::Z, W, X, Y>(minor1);// 2 3 0 1
+
+		tmp3 = VecMul(col0, tmp0);
+		tmp0 = VecMul(col3, tmp0);
+		tmp2 = VecMul(col3, tmp1);
+		tmp1 = VecMul(col0, tmp1);
+
+		minor0 = VecAdd(tmp0, minor0);
+		minor0 = VecSub(minor0, tmp2);
+		minor3 = VecSub(tmp1, tmp3);
+
+		// 3 -----------------------------------------------
+		minor3 = VecSwizzle<VecCoord::Z, W, X, Y>(minor3);// 2 3 0 1
+		tmp2 = VecSwizzle<VecCoord::Z, W, X, Y>(col1);// 2 3 0 1
+		tmp2 = VecMul(tmp2, col3);
+
+		tmp0 = VecSwizzle<VecCoord::Y, X, W, Z>(tmp2);// 1 0 3 2
+		col2 = VecSwizzle<VecCoord::Z, W, X, Y>(col2);// 2 3 0 1
+		tmp1 = VecSwizzle<W, Z, Y, X>(tmp2);// 3 2 1 0
+
+		tmp3 = VecMul(col2, tmp0);
+		tmp0 = VecMul(col0, tmp0);
+		tmp2 = VecMul(col2, tmp1);
+		tmp1 = VecMul(col0, tmp1);
+
+		minor0 = VecAdd(tmp3, minor0);
+		minor0 = VecSub(minor0, tmp2);
+		minor2 = VecSub(tmp1, tmp0);
+
+		// 4 -----------------------------------------------
+		tmp2 = VecMul(col0, col1);
+		tmp0 = VecSwizzle<VecCoord::Y, X, W, Z>(tmp2);// 1 0 3 2
+		tmp1 = VecSwizzle<W, Z, Y, X>(tmp2);// 3 2 1 0
+		minor2 = VecSwizzle<VecCoord::Z, W, X, Y>(minor2);// 2 3 0 1
+
+		tmp2 = VecMul(col3, tmp0);
+		tmp3 = VecMul(col2, tmp0);
+		tmp0 = VecMul(col3, tmp1);
+		tmp1 = VecMul(col2, tmp1);
+
+		minor2 = VecAdd(tmp2, minor2);
+		minor3 = VecSub(tmp3, minor3);
+		minor2 = VecSub(tmp0, minor2);
+		minor3 = VecSub(minor3, tmp1);
+
+		// 5 -----------------------------------------------
+		tmp2 = VecMul(col0, col3);
+		tmp0 = VecSwizzle<VecCoord::Y, X, W, Z>(tmp2);// 1 0 3 2
+		tmp1 = VecSwizzle<W, Z, Y, X>(tmp2);// 3 2 1 0
+
+		tmp3 = VecMul(col2, tmp0);
+		tmp0 = VecMul(col1, tmp0);
+		tmp2 = VecMul(col2, tmp1);
+		tmp1 = VecMul(col1, tmp1);
+
+		tmp3 = VecSub(minor1, tmp3);
+		tmp0 = VecAdd(tmp0, minor2);
+
+		minor1 = VecAdd(tmp2, tmp3);
+		minor2 = VecSub(tmp0, tmp1);
+
+		// 6 -----------------------------------------------
+		tmp2 = VecMul(col0, col2);
+		tmp0 = VecSwizzle<VecCoord::Y, X, W, Z>(tmp2);// 1 0 3 2
+		tmp1 = VecSwizzle<W, Z, Y, X>(tmp2);// 3 2 1 0
+
+		tmp3 = VecMul(col3, tmp0);
+		tmp0 = VecMul(col1, tmp0);
+		tmp2 = VecMul(col3, tmp1);
+		tmp1 = VecMul(col1, tmp1);
+
+		tmp3 = VecAdd(tmp3, minor1);
+		tmp0 = VecSub(minor3, tmp0);
+
+		minor1 = VecSub(tmp3, tmp2);
+		minor3 = VecAdd(tmp1, tmp0);
+
+		// Calculate Determinant
+		det = VecSumD(VecMul(col0, minor0));
+		MatrixType resultType = SseVecDGetX(det) != 0.0 ? mat.matrixTypeVal : MatrixType::INVALID;
+		det = VecDiv(SetSseVecD4(1.0), det);
+
+		minor0 = VecMul(det, minor0);
+		minor1 = VecMul(det, minor1);
+		minor2 = VecMul(det, minor2);
+		minor3 = VecMul(det, minor3);
+
+		tmp0 = VecShuffle<VecCoord::X, Y, X, Y>(minor0, minor1);// 0 1 0 1
+		tmp1 = VecShuffle<VecCoord::X, Y, X, Y>(minor2, minor3);// 0 1 0 1
+		tmp2 = VecShuffle<VecCoord::Z, W, Z, W>(minor0, minor1);// 2 3 2 3
+		tmp3 = VecShuffle<VecCoord::Z, W, Z, W>(minor2, minor3);// 2 3 2 3
+
+		minor0 = VecShuffle<VecCoord::X, Z, X, Z>(tmp0, tmp1);// 0 2 0 2
+		minor2 = VecShuffle<VecCoord::X, Z, X, Z>(tmp2, tmp3);// 0 2 0 2
+		minor1 = VecShuffle<VecCoord::Y, W, Y, W>(tmp0, tmp1);// 1 3 1 3
+		minor3 = VecShuffle<VecCoord::Y, W, Y, W>(tmp2, tmp3);// 1 3 1 3
+
+		return SseMat44D(minor0, minor1, minor2, minor3, resultType);
+	}
+
+	/*!
+	 * \brief Calculates the transpose of the given 4x4 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to transpose.
+	 *
+	 * \return	The transpose matrix of the given matrix.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline SseMat44D MatrixTranspose(const SseMat44D& mat)
+	{
+		SseVecD tmp0, tmp1, tmp2, tmp3;
+
+		// 00 10 01 11
+		tmp0 = VecShuffle<VecCoord::X, Y, X, Y>(mat.col0, mat.col1);
+		// 02 12 03 13
+		tmp1 = VecShuffle<VecCoord::X, Y, X, Y>(mat.col2, mat.col3);
+		// 20 30 21 31
+		tmp2 = VecShuffle<VecCoord::Z, W, Z, W>(mat.col0, mat.col1);
+		// 22 32 23 33
+		tmp3 = VecShuffle<VecCoord::Z, W, Z, W>(mat.col2, mat.col3);
+
+		return SseMat44D(
+			VecShuffle<VecCoord::X, Z, X, Z>(tmp0, tmp1),// 00 01 02 03
+			VecShuffle<VecCoord::Y, W, Y, W>(tmp0, tmp1),// 10 11 12 13
+			VecShuffle<VecCoord::X, Z, X, Z>(tmp2, tmp3),// 20 21 22 23
+			VecShuffle<VecCoord::Y, W, Y, W>(tmp2, tmp3),// 30 31 32 33
+			mat.matrixTypeVal);
+	}
+
+	/*!
+	 * \brief Calculates the determinant of the given SseMat44D
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to calculate the determinant of.
+	 *
+	 * \return	An SseVecD containing four identical copies of this matrix's determinant.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline SseVecD MatrixDeterminant(const SseMat44D& mat)
+	{
+		SseVecD tmp0, tmp1, tmp2, tmp3;
+
+		// 2x2 sub-determinants of the row pairs in the left columns (s), and of the complementary
+		// row pairs in the right columns (c).
+		// s: [(0,1) (0,2) (0,3) (1,2)] [(1,3) (2,3) na na]
+		// c: [(2,3) (1,3) (1,2) (0,3)] [(0,2) (0,1) na na]
+		tmp0 = VecSub(
+			VecMul(VecSwizzle<VecCoord::X, X, X, Y>(mat.col0), VecSwizzle<VecCoord::Y, Z, W, Z>(mat.col1)),
+			VecMul(VecSwizzle<VecCoord::Y, Z, W, Z>(mat.col0), VecSwizzle<VecCoord::X, X, X, Y>(mat.col1)));
+		tmp1 = VecSub(
+			VecMul(VecSwizzle<VecCoord::Z, Y, Y, X>(mat.col2), VecSwizzle<VecCoord::W, W, Z, W>(mat.col3)),
+			VecMul(VecSwizzle<VecCoord::W, W, Z, W>(mat.col2), VecSwizzle<VecCoord::Z, Y, Y, X>(mat.col3)));
+
+		tmp2 = VecSub(
+			VecMul(VecSwizzle<VecCoord::Y, Z, NA, NA>(mat.col0), VecSwizzle<VecCoord::W, W, NA, NA>(mat.col1)),
+			VecMul(VecSwizzle<VecCoord::W, W, NA, NA>(mat.col0), VecSwizzle<VecCoord::Y, Z, NA, NA>(mat.col1)));
+		tmp3 = VecSub(
+			VecMul(VecSwizzle<VecCoord::X, X, NA, NA>(mat.col2), VecSwizzle<VecCoord::Z, Y, NA, NA>(mat.col3)),
+			VecMul(VecSwizzle<VecCoord::Z, Y, NA, NA>(mat.col2), VecSwizzle<VecCoord::X, X, NA, NA>(mat.col3)));
+
+		// Laplace expansion along the left two columns:
+		// det = s01 c23 - s02 c13 + s03 c12 + s12 c03 - s13 c02 + s23 c01
+		tmp0 = VecMul(tmp0, tmp1);
+		tmp2 = VecAnd(VecMul(tmp2, tmp3), SetSseVecDMask(~0ULL, ~0ULL, 0x0, 0x0));
+		tmp0 = VecXOr(tmp0, SetSseVecDMask(0x0, 0x8000000000000000ULL, 0x0, 0x0));
+		tmp2 = VecXOr(tmp2, SetSseVecDMask(0x8000000000000000ULL, 0x0, 0x0, 0x0));
+
+		return VecSumD(VecAdd(tmp0, tmp2));
+	}
+
+	/*!
+	 * \brief Calculates the 4x4 translation matrix represented by the given 3D position vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The given 3D position vector.
+	 *
+	 * \return	The translation matrix represented by the given 3D position vector.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline SseMat44D TranslationMatrixFromVec3(const SseVecD& vec)
+	{
+		return SseMat44D(
+			SetSseVecD4(1.0, 0.0, 0.0, 0.0),
+			SetSseVecD4(0.0, 1.0, 0.0, 0.0),
+			SetSseVecD4(0.0, 0.0, 1.0, 0.0),
+			vec);
+	}
+
+	/*!
+	 * \brief	Calculates the 4x4 scale matrix represented by the given 3D scale vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The given 3D scale vector.
+	 *
+	 * \return	The scale matrix represented by the given 3D scale vector.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline SseMat44D ScaleMatrixFromVec3(const SseVecD& vec)
+	{
+		return SseMat44D(
+			VecAnd(vec, SetSseVecDMask(~0ULL, 0x0, 0x0, 0x0)),
+			VecAnd(vec, SetSseVecDMask(0x0, ~0ULL, 0x0, 0x0)),
+			VecAnd(vec, SetSseVecDMask(0x0, 0x0, ~0ULL, 0x0)),
+			SetSseVecD4(0.0, 0.0, 0.0, 1.0));
+	}
+
+	/*!
+	 * \brief	Transforms a 3D vector by the given 4x4 matrix.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	mat	The matrix to transform by.
+	 * \param	vec	The 3D vector being transformed.  Its w-coordinate is treated as 1.0.
+	 *
+	 * \return	The transformed vector.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	SSE_VECD_CALL TransformVec3(const SseMat44D& mat, const SseVecD& vec)
+	{
+		return MatrixMulColumn(mat, VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(vec, SetSseVecD4(1.0)));
+	}
+
+	/*!
+	 * \brief	Rebases an array of double-precision world matrices into camera-relative SseMat44s.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	worldMats	The double-precision world matrices.
+	 * \param	cameraPos	The double-precision world position of the camera.
+	 * \param [out]	result	The camera-relative single-precision matrices.  Must hold count entries.
+	 * \param	count	The number of matrices to rebase.
+	 *
+	 * \remarks	The translation column is subtracted from the camera position in double precision
+	 *			before narrowing, so objects near the camera keep full single-precision accuracy
+	 *			no matter how far both are from the world origin.  The resulting matrices should be
+	 *			used with a view matrix that has its eye at the origin.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline void RebaseToCameraRelative(const SseMat44D* worldMats, const SseVecD& cameraPos, SseMat44* result, size_t count)
+	{
+		const SseVecD offset = VecAnd(cameraPos, SetSseVecDMask(~0ULL, ~0ULL, ~0ULL, 0x0));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const SseMat44D& mat = worldMats[i];
+
+			result[i].col0 = ToSseVec(mat.col0);
+			result[i].col1 = ToSseVec(mat.col1);
+			result[i].col2 = ToSseVec(mat.col2);
+			result[i].col3 = ToSseVec(VecSub(mat.col3, offset));
+			result[i].matrixTypeVal = CombineMatrixTypes(mat.matrixTypeVal, MatrixType::TRANSLATION);
+		}
+	}
+
+	/*!
+	 * \brief	Rebases single-precision local matrices, placed at double-precision world positions,
+	 *			into camera-relative SseMat44s.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	localMats	The single-precision rotation/scale matrices.  Their translation columns are ignored.
+	 * \param	worldPositions	The double-precision world positions, one per matrix.
+	 * \param	cameraPos	The double-precision world position of the camera.
+	 * \param [out]	result	The camera-relative single-precision matrices.  Must hold count entries.
+	 * \param	count	The number of matrices to rebase.
+	 *
+	 * \relatedalso gofxmath::SseMat44D
+	 */
+	inline void RebaseToCameraRelative(const SseMat44* localMats, const SseVecD* worldPositions, const SseVecD& cameraPos, SseMat44* result, size_t count)
+	{
+		const SseVecD offset = VecAnd(cameraPos, SetSseVecDMask(~0ULL, ~0ULL, ~0ULL, 0x0));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			SseVec translation = ToSseVec(VecSub(worldPositions[i], offset));
+
+			result[i].col0 = localMats[i].col0;
+			result[i].col1 = localMats[i].col1;
+			result[i].col2 = localMats[i].col2;
+			result[i].col3 = VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(translation, UNIT_0001);
+			result[i].matrixTypeVal = CombineMatrixTypes(localMats[i].matrixTypeVal, MatrixType::TRANSLATION);
+		}
+	}
+
+	/*! @} */
+}
+
+#endif // SSE_MAT44D_DOT_H
@@ -0,0 +1,242 @@
+#ifndef SSE_TRANSFORM_DOT_H
+#define SSE_TRANSFORM_DOT_H
+
+#include "ssemat_math_defs.h"
+#include "ssevec_math_defs.h"
+#include "ssevec.h"
+#include "ssemat44.h"
+#include "ssemat34.h"
+#include "sisd_defns.h"
+
+/*!
+ * \file
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SIMDMatMath
+	 * @{
+	 */
+
+	/*!
+	 * \class SseTransform
+	 *
+	 * \brief	A rotation, uniform scale and translation, stored as a quaternion and a translation/scale
+	 *			SseVec.
+	 *
+	 * \remarks A point p is transformed as %%t + s(qpq^*)%%.  At 32 bytes this is well under half of an
+	 *			SseMat44, and composing or inverting one is a quaternion product plus a rotated vector
+	 *			instead of a full matrix product or inverse, which makes it the cheaper type for
+	 *			hierarchies and animation.  Convert with ToSseMat34 or ToSseMat44 only when the matrix is
+	 *			actually needed, such as when uploading to the GPU.
+	 *
+	 *			The rotation is expected to be a unit quaternion, and the scale to be non-zero.
+	 */
+	ALIGNED_CLASS(16) SseTransform
+	{
+	public:
+		SseVec rotation;/*!< The unit quaternion rotation: <x y z w>
+						 *	 \sa SseVec
+						 */
+
+		SseVec translationScale;/*!< The translation in x, y and z, with the uniform scale in w: <tx ty tz s>
+								 *	 \sa SseVec
+								 */
+
+		/*!
+		 * \brief	Empty SseTransform constructor.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \remarks Unlike the matrix types, sets the identity transform, since a zero quaternion and scale
+		 *			are not a usable transform.
+		 */
+		SseTransform() :
+			rotation(UNIT_0001),
+			translationScale(UNIT_0001) {}
+
+		/*!
+		 * \brief	SseTransform constructor that takes the two member SseVecs directly.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	rot		  	The unit quaternion rotation.
+		 * \param	transScale	The translation in x, y and z, with the uniform scale in w.
+		 */
+		SseTransform(const SseVec& rot, const SseVec& transScale) :
+			rotation(rot),
+			translationScale(transScale) {}
+
+		/*!
+		 * \brief	SseTransform constructor that takes a rotation, a translation and a uniform scale.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	rot		   	The unit quaternion rotation.
+		 * \param	translation	The translation.  Its w component is ignored.
+		 * \param	scale	   	The uniform scale.
+		 */
+		SseTransform(const SseVec& rot, const SseVec& translation, float scale) :
+			rotation(rot),
+			translationScale(VecBlend<LEFT, LEFT, LEFT, RIGHT>(translation, SetSseVec4(scale))) {}
+
+		/*!
+		 * \brief	Gets the identity transform.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \return	The identity transform.
+		 */
+		static SseTransform Identity()
+		{
+			return SseTransform(UNIT_0001, UNIT_0001);
+		}
+	};
+
+	static_assert(sizeof(SseTransform) == 2 * sizeof(SseVec), "SseTransform must pack into two SseVecs");
+
+	/*!
+	 * \brief	Composes the two given transforms.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	left 	The outer (parent) transform.
+	 * \param	right	The inner (child) transform, applied first.
+	 *
+	 * \return	The transform that applies right, then left; the counterpart of MatrixMultiply(left, right)
+	 *			for the equivalent matrices.
+	 *
+	 * \relatedalso gofxmath::SseTransform
+	 */
+	inline SseTransform TransformMultiply(const SseTransform& left, const SseTransform& right)
+	{
+		SseVec leftScale = VecSplat<VecCoord::W>(left.translationScale);
+
+		SseVec translation = QuaternionRotateVec3(left.rotation, right.translationScale);
+		translation = VecAdd(VecMul(leftScale, translation), left.translationScale);// t0 + s0(q0 t1 q0*)
+
+		SseVec scale = VecMul(leftScale, right.translationScale);// na na na s0s1
+
+		return SseTransform(QuaternionMultiply(left.rotation, right.rotation),
+			VecBlend<LEFT, LEFT, LEFT, RIGHT>(translation, scale));
+	}
+
+	/*!
+	 * \brief	Calculates the inverse of the given transform.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal of the scale is calculated (see VecRcp).
+	 * \param	xform	The transform to invert.
+	 *
+	 * \return	The inverse transform.
+	 *
+	 * \remarks The inverse of a rotation, uniform scale and translation is another one, so no general
+	 *			matrix inverse is needed: the rotation is conjugated, the scale inverted, and the
+	 *			translation rotated and scaled back.
+	 *
+	 * \relatedalso gofxmath::SseTransform
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	inline SseTransform TransformInverse(const SseTransform& xform)
+	{
+		SseVec rotation = Vec4Negate<true, true, true, false>(xform.rotation);
+		SseVec scale = VecRcp<policy>(VecSplat<VecCoord::W>(xform.translationScale));
+
+		SseVec translation = QuaternionRotateVec3(rotation, xform.translationScale);
+		translation = Vec4Negate(VecMul(scale, translation));// -(q* t q)/s
+
+		return SseTransform(rotation, VecBlend<LEFT, LEFT, LEFT, RIGHT>(translation, scale));
+	}
+
+	/*!
+	 * \brief	Transforms the given point via the given transform.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xform	The transform to apply.
+	 * \param	vec  	The point to transform.  Its w component is ignored.
+	 *
+	 * \return	The transformed point, with a w component of 1.
+	 *
+	 * \relatedalso gofxmath::SseTransform
+	 */
+	SSE_VEC_CALL TransformVec3(const SseTransform& xform, const SseVec& vec)
+	{
+		SseVec result = QuaternionRotateVec3(xform.rotation, vec);
+		result = VecMul(VecSplat<VecCoord::W>(xform.translationScale), result);
+		result = VecAdd(result, xform.translationScale);
+
+		return VecBlend<LEFT, LEFT, LEFT, RIGHT>(result, UNIT_0001);
+	}
+
+	/*!
+	 * \brief	Transforms the given direction via the given transform, ignoring its translation.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xform	The transform to apply.
+	 * \param	vec  	The direction to transform.  Its w component is ignored.
+	 *
+	 * \return	The rotated and scaled direction, with a w component of 0.
+	 *
+	 * \relatedalso gofxmath::SseTransform
+	 */
+	SSE_VEC_CALL TransformDirectionVec3(const SseTransform& xform, const SseVec& vec)
+	{
+		SseVec result = QuaternionRotateVec3(xform.rotation, vec);
+
+		return VecAnd(VecMul(VecSplat<VecCoord::W>(xform.translationScale), result), MASK_1110);
+	}
+
+	/*!
+	 * \brief	Expands the given transform into an SseMat44.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xform	The transform to expand.
+	 *
+	 * \return	The equivalent SseMat44; its type is MatrixType::RIGID when the scale is exactly 1, and
+	 *			MatrixType::AFFINE otherwise.
+	 *
+	 * \relatedalso gofxmath::SseTransform
+	 */
+	SSE_MAT_CALL ToSseMat44(const SseTransform& xform)
+	{
+		SseMat44 result = RotationMatrixFromQuaternion(xform.rotation);
+		SseVec scale = VecSplat<VecCoord::W>(xform.translationScale);
+
+		result.col0 = VecMul(result.col0, scale);
+		result.col1 = VecMul(result.col1, scale);
+		result.col2 = VecMul(result.col2, scale);
+		result.col3 = VecBlend<LEFT, LEFT, LEFT, RIGHT>(xform.translationScale, UNIT_0001);
+		result.matrixTypeVal = _mm_comieq_ss(scale, SSE_VEC_ONE) ? MatrixType::RIGID : MatrixType::AFFINE;
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Expands the given transform into an SseMat34, ready to be stored into a float3x4 buffer.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xform	The transform to expand.
+	 *
+	 * \return	The equivalent SseMat34.
+	 *
+	 * \relatedalso gofxmath::SseTransform
+	 */
+	inline SseMat34 ToSseMat34(const SseTransform& xform)
+	{
+		return SseMat34(ToSseMat44(xform));
+	}
+
+	/*! @} */
+}
+#endif // SSE_TRANSFORM_DOT_H
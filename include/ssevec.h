@@ -1,9 +1,14 @@
 #ifndef SSE_VEC_DOT_H
 #define SSE_VEC_DOT_H
 #include "ssevec_math_defs.h"
+#include "scalar_math.h"
 #include "vec2.h"
 #include "vec3.h"
 #include "vec4.h"
+#include "vec3p.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 /*! 
  * \file 
@@ -444,6 +449,258 @@ namespace gofxmath
 		return result;
 	}
 
+	/*!
+	 * \brief	Writes one result of a batch function with the given StorePolicy.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	Whether to use an ordinary or a non-temporal store.
+	 * \param	result	The (16-byte aligned) destination.
+	 * \param	vec   	The SseVec to write.
+	 *
+	 * \sa BatchStoreFence
+	 */
+	template<StorePolicy storePolicy>
+	inline void BatchStore(SseVec* result, const SseVec& vec)
+	{
+		if (storePolicy == StorePolicy::STREAMING)
+		{
+			_mm_stream_ps(reinterpret_cast<float*>(result), vec);
+		}
+		else
+		{
+			*result = vec;
+		}
+	}
+
+	/*!
+	 * \brief	Ends a batch written with the given StorePolicy.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	The policy the batch was written with.
+	 *
+	 * \remarks	Non-temporal stores are weakly ordered, so a streamed batch is fenced before returning, to
+	 *			make its results visible to whatever (such as another thread) reads them next.  Does
+	 *			nothing for cached stores.
+	 */
+	template<StorePolicy storePolicy>
+	inline void BatchStoreFence()
+	{
+		if (storePolicy == StorePolicy::STREAMING)
+		{
+			_mm_sfence();
+		}
+	}
+
+	/*!
+	 * \brief	Prefetches the input of a batch function the given number of elements ahead.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	distance	How many elements ahead to prefetch; 0 disables prefetching.
+	 * \tparam	T			The type of the input elements.
+	 * \param	items	The input array.
+	 * \param	index	The index of the element being processed.
+	 * \param	count	The number of elements in the array.
+	 *
+	 * \remarks	Every cache line of element %%index + distance%% is prefetched into all cache levels, unless
+	 *			that is past the end of the array.  The hardware prefetchers already follow a plain
+	 *			sequential stream, so this mainly helps when several input arrays (or an expensive kernel)
+	 *			keep them from running far enough ahead; the best distance is found by measuring.
+	 */
+	template<size_t distance, typename T>
+	inline void BatchPrefetch(const T* items, size_t index, size_t count)
+	{
+		if (distance != 0 && index + distance < count)
+		{
+			const char* item = reinterpret_cast<const char*>(items + index + distance);
+
+			for (size_t line = 0; line < sizeof(T); line += 64)
+			{
+				_mm_prefetch(item + line, _MM_HINT_T0);
+			}
+		}
+	}
+
+	/*!
+	 * \brief	Loads and returns a SseVec with the components from the given packed Vec3P.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The packed 3D vector containing the components to be loaded.
+	 *
+	 * \return	A SseVec loaded with the components from the given Vec3P, and a fourth component of
+	 *			1.0f (as with LoadSseVec3).
+	 *
+	 * \remarks	Reads exactly the 12 bytes of the Vec3P (an 8-byte and a 4-byte load), so it is safe on
+	 *			the last element of a buffer and needs no alignment.
+	 */
+	SSE_VEC_CALL LoadSseVec3P(const Vec3P& vec)
+	{
+		SseVec xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(vec.vals));// x y 0 0
+		SseVec z1 = _mm_unpacklo_ps(_mm_load_ss(vec.vals + 2), SSE_VEC_ONE);// z 1 0 1
+
+		return _mm_movelh_ps(xy, z1);
+	}
+
+	/*!
+	 * \brief	Stores the 3D components of the given SseVec into a packed Vec3P.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVec.
+	 *
+	 * \return	The Vec3P containing the x, y and z components of the SseVec.
+	 */
+	inline Vec3P StoreSseVec3P(const SseVec& vec)
+	{
+		Vec3P result;
+		_mm_storel_pi(reinterpret_cast<__m64*>(result.vals), vec);
+		_mm_store_ss(result.vals + 2, _mm_movehl_ps(vec, vec));
+		return result;
+	}
+
+	/*!
+	 * \brief	Loads four consecutive packed Vec3Ps into four SseVecs.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vecs   	The first of the four packed 3D vectors.
+	 * \param	results	The array receiving the four SseVecs, each with a fourth component of 1.0f.
+	 *
+	 * \remarks	The 48 bytes are read with three unaligned 16-byte loads and then shuffled apart, instead
+	 *			of with four separate 12-byte loads.
+	 */
+	inline void LoadSseVec3PQuad(const Vec3P* vecs, SseVec* results)
+	{
+		const float* vals = reinterpret_cast<const float*>(vecs);
+		SseVec tmp0 = _mm_loadu_ps(vals);// x0 y0 z0 x1
+		SseVec tmp1 = _mm_loadu_ps(vals + 4);// y1 z1 x2 y2
+		SseVec tmp2 = _mm_loadu_ps(vals + 8);// z2 x3 y3 z3
+		SseVec tmp3 = VecShuffle<W, W, X, X>(tmp0, tmp1);// x1 x1 y1 y1
+
+		results[0] = VecBlend<LEFT, LEFT, LEFT, RIGHT>(tmp0, UNIT_0001);
+		results[1] = VecBlend<LEFT, LEFT, LEFT, RIGHT>(VecShuffle<X, Z, Y, Y>(tmp3, tmp1), UNIT_0001);// x1 y1 z1 1
+		results[2] = VecBlend<LEFT, LEFT, LEFT, RIGHT>(VecShuffle<Z, W, X, X>(tmp1, tmp2), UNIT_0001);// x2 y2 z2 1
+		results[3] = VecBlend<LEFT, LEFT, LEFT, RIGHT>(VecSwizzle<Y, Z, W, W>(tmp2), UNIT_0001);// x3 y3 z3 1
+	}
+
+	/*!
+	 * \brief	Stores the 3D components of four SseVecs into four consecutive packed Vec3Ps.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	Whether to use ordinary or non-temporal stores.  STREAMING requires results to be
+	 *						16-byte aligned.
+	 * \param	vecs   	The four SseVecs to store.
+	 * \param	results	The first of the four packed 3D vectors to write.
+	 *
+	 * \remarks	The counterpart of LoadSseVec3PQuad: the vectors are shuffled together and written with
+	 *			three unaligned 16-byte stores.
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED>
+	inline void StoreSseVec3PQuad(const SseVec* vecs, Vec3P* results)
+	{
+		float* vals = reinterpret_cast<float*>(results);
+		SseVec tmp0 = VecShuffle<Z, Z, X, X>(vecs[0], vecs[1]);// z0 z0 x1 x1
+		SseVec tmp1 = VecShuffle<Z, Z, X, X>(vecs[2], vecs[3]);// z2 z2 x3 x3
+		SseVec out0 = VecShuffle<X, Y, X, Z>(vecs[0], tmp0);// x0 y0 z0 x1
+		SseVec out1 = VecShuffle<Y, Z, X, Y>(vecs[1], vecs[2]);// y1 z1 x2 y2
+		SseVec out2 = VecShuffle<X, Z, Y, Z>(tmp1, vecs[3]);// z2 x3 y3 z3
+
+		if (storePolicy == StorePolicy::STREAMING)
+		{
+			_mm_stream_ps(vals, out0);
+			_mm_stream_ps(vals + 4, out1);
+			_mm_stream_ps(vals + 8, out2);
+		}
+		else
+		{
+			_mm_storeu_ps(vals, out0);
+			_mm_storeu_ps(vals + 4, out1);
+			_mm_storeu_ps(vals + 8, out2);
+		}
+	}
+
+	/*!
+	 * \brief	Loads every packed Vec3P in the given array into an SseVec.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	vecs   	The packed 3D vectors to load.
+	 * \param	results	The array receiving the SseVecs, each with a fourth component of 1.0f.
+	 * \param	count  	The number of vectors.
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void LoadSseVec3PBatch(const Vec3P* vecs, SseVec* results, size_t count)
+	{
+		SseVec tmp[4];
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+			LoadSseVec3PQuad(vecs + i, tmp);
+
+			for (int j = 0; j < 4; ++j)
+			{
+				BatchStore<storePolicy>(results + i + j, tmp[j]);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			BatchStore<storePolicy>(results + i, LoadSseVec3P(vecs[i]));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Stores the 3D components of every SseVec in the given array into a packed Vec3P.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	vecs   	The SseVecs to store.
+	 * \param	results	The array receiving the packed 3D vectors.
+	 * \param	count  	The number of vectors.
+	 *
+	 * \remarks	With STREAMING, the blocks of four are streamed when results is 16-byte aligned (and
+	 *			written normally otherwise); the last count % 4 vectors are always written normally.
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void StoreSseVec3PBatch(const SseVec* vecs, Vec3P* results, size_t count)
+	{
+		const bool stream = storePolicy == StorePolicy::STREAMING && (reinterpret_cast<uintptr_t>(results) & 0xF) == 0;
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+
+			if (stream)
+			{
+				StoreSseVec3PQuad<StorePolicy::STREAMING>(vecs + i, results + i);
+			}
+			else
+			{
+				StoreSseVec3PQuad(vecs + i, results + i);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			results[i] = StoreSseVec3P(vecs[i]);
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
 	/*!
 	 * \brief	Negates the 2D components of the given SseVec.
 	 *
@@ -458,7 +715,7 @@ namespace gofxmath
 	template<bool nX = true, bool nY = true>
 	SSE_VEC_CALL Vec2Negate(const SseVec& vec)
 	{
-		static const SseVec NEGATE_MASK = SetSseVecMask(nX << 31, nY << 31, 0x0, 0x0);
+		static constexpr SseVecMaskConst NEGATE_MASK = { { nX ? 0x80000000u : 0x0u, nY ? 0x80000000u : 0x0u, 0x0, 0x0 } };
 		return VecXOr(vec, NEGATE_MASK);
 	}
 
@@ -477,7 +734,7 @@ namespace gofxmath
 	template<bool nX = true, bool nY = true, bool nZ = true>
 	SSE_VEC_CALL Vec3Negate(const SseVec& vec)
 	{
-		static const SseVec NEGATE_MASK = SetSseVecMask(nX << 31, nY << 31, nZ << 31, 0x0);
+		static constexpr SseVecMaskConst NEGATE_MASK = { { nX ? 0x80000000u : 0x0u, nY ? 0x80000000u : 0x0u, nZ ? 0x80000000u : 0x0u, 0x0 } };
 		return VecXOr(vec, NEGATE_MASK);
 	}
 
@@ -497,7 +754,7 @@ namespace gofxmath
 	template<bool nX = true, bool nY = true, bool nZ = true, bool nW = true>
 	SSE_VEC_CALL Vec4Negate(const SseVec& vec)
 	{
-		static const SseVec NEGATE_MASK = SetSseVecMask(nX << 31, nY << 31, nZ << 31, nW << 31);
+		static constexpr SseVecMaskConst NEGATE_MASK = { { nX ? 0x80000000u : 0x0u, nY ? 0x80000000u : 0x0u, nZ ? 0x80000000u : 0x0u, nW ? 0x80000000u : 0x0u } };
 		return VecXOr(vec, NEGATE_MASK);
 	}
 
@@ -515,7 +772,7 @@ namespace gofxmath
 	template<bool aX = true, bool aY = true>
 	SSE_VEC_CALL Vec2Abs(const SseVec& vec)
 	{
-		static const SseVec NEGATE_MASK = SetSseVecMask(~(aX << 31), ~(aY << 31), 0x0, 0x1);
+		static constexpr SseVecMaskConst NEGATE_MASK = { { aX ? 0x7FFFFFFFu : 0xFFFFFFFFu, aY ? 0x7FFFFFFFu : 0xFFFFFFFFu, 0x0, 0x1 } };
 		return VecAnd(vec, NEGATE_MASK);
 	}
 
@@ -534,7 +791,7 @@ namespace gofxmath
 	template<bool aX = true, bool aY = true, bool aZ = true>
 	SSE_VEC_CALL Vec3Abs(const SseVec& vec)
 	{
-		static const SseVec NEGATE_MASK = SetSseVecMask(~(aX << 31), ~(aY << 31), ~(aZ << 31), 0x1);
+		static constexpr SseVecMaskConst NEGATE_MASK = { { aX ? 0x7FFFFFFFu : 0xFFFFFFFFu, aY ? 0x7FFFFFFFu : 0xFFFFFFFFu, aZ ? 0x7FFFFFFFu : 0xFFFFFFFFu, 0x1 } };
 		return VecAnd(vec, NEGATE_MASK);
 	}
 
@@ -554,7 +811,7 @@ namespace gofxmath
 	template<bool aX = true, bool aY = true, bool aZ = true, bool aW = true>
 	SSE_VEC_CALL Vec4Abs(const SseVec& vec)
 	{
-		static const SseVec NEGATE_MASK = SetSseVecMask(~(aX << 31), ~(aY << 31), ~(aZ << 31), ~(aW << 31));
+		static constexpr SseVecMaskConst NEGATE_MASK = { { aX ? 0x7FFFFFFFu : 0xFFFFFFFFu, aY ? 0x7FFFFFFFu : 0xFFFFFFFFu, aZ ? 0x7FFFFFFFu : 0xFFFFFFFFu, aW ? 0x7FFFFFFFu : 0xFFFFFFFFu } };
 		return VecAnd(vec, NEGATE_MASK);
 	}
 
@@ -707,17 +964,72 @@ namespace gofxmath
 	 *
 	 * \date	2/21/2015
 	 *
+	 * \tparam	policy	How the reciprocal square root is calculated.
 	 * \param	vec	The vector for which to compute the reciprocal square root of the
 	 *				components.
 	 *
 	 * \return	The SseVec containing the reciprocal square roots of the components
 	 *			of the given vector.
 	 * 
-	 * \remarks Equivalent to a call to <CODE>_mm_rsqrt_ps(vec)</CODE>.
+	 * \remarks With the default gofxmath::PrecisionPolicy::ESTIMATE, equivalent to a call to
+	 *			<CODE>_mm_rsqrt_ps(vec)</CODE>.  gofxmath::PrecisionPolicy::REFINED adds the step
+	 *			%%y_1 = \\frac{y_0}{2}(3 - ay_0^2)%%, and gofxmath::PrecisionPolicy::EXACT divides one by
+	 *			<CODE>_mm_sqrt_ps(vec)</CODE>.  Zeros and infinities are not refined correctly.
 	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::ESTIMATE>
 	SSE_VEC_CALL VecRSqrt(const SseVec& vec)
 	{
-		return _mm_rsqrt_ps(vec);
+		const SseVec ONE_1111 = SetSseVec4(1.0f);
+
+		if (policy == PrecisionPolicy::EXACT)
+		{
+			return _mm_div_ps(ONE_1111, _mm_sqrt_ps(vec));
+		}
+
+		SseVec estimate = _mm_rsqrt_ps(vec);
+
+		if (policy == PrecisionPolicy::REFINED)
+		{
+			const SseVec HALF_1111 = SetSseVec4(0.5f);
+			const SseVec THREE_1111 = SetSseVec4(3.0f);
+
+			estimate = VecMul(VecMul(HALF_1111, estimate), VecSub(THREE_1111, VecMul(vec, VecMul(estimate, estimate))));
+		}
+
+		return estimate;
+	}
+
+	/*!
+	 * \brief	Calculates and returns the approximate reciprocal of the given SseVec.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the reciprocal is calculated.
+	 * \param	vec   	The vector for which to compute the reciprocal of the components.
+	 *
+	 * \return	The SseVec containing the approximate reciprocals of the components of the given vector.
+	 *
+	 * \remarks Uses <CODE>_mm_rcp_ps(vec)</CODE>, which is accurate to about 12 bits.  The default
+	 *			gofxmath::PrecisionPolicy::REFINED adds the step %%x_1 = 2x_0 - ax_0^2%%, which brings that to
+	 *			about 22 bits and is still cheaper than a full division on most hardware.  Zeros and
+	 *			infinities are not refined correctly.  gofxmath::PrecisionPolicy::EXACT divides instead.
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::REFINED>
+	SSE_VEC_CALL VecRcp(const SseVec& vec)
+	{
+		if (policy == PrecisionPolicy::EXACT)
+		{
+			return _mm_div_ps(SetSseVec4(1.0f), vec);
+		}
+
+		SseVec estimate = _mm_rcp_ps(vec);
+
+		if (policy == PrecisionPolicy::REFINED)
+		{
+			estimate = VecSub(VecAdd(estimate, estimate), VecMul(vec, VecMul(estimate, estimate)));
+		}
+
+		return estimate;
 	}
 
 
@@ -726,15 +1038,26 @@ namespace gofxmath
 	 *
 	 * \date	2/21/2015
 	 *
+	 * \tparam	policy	How the square root is calculated.
 	 * \param	vec	The vector for which to compute the square root of the components.
 	 *
 	 * \return	The SseVec containing the square roots of the components of the given vector.
 	 *
-	 * \remarks Equivalent to a call to <CODE>_mm_sqrt_ps(vec)</CODE>.
+	 * \remarks With the default gofxmath::PrecisionPolicy::EXACT, equivalent to a call to
+	 *			<CODE>_mm_sqrt_ps(vec)</CODE>.  Otherwise multiplies the components by VecRSqrt with the
+	 *			same policy, keeping zeros at zero.
 	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
 	SSE_VEC_CALL VecSqrt(const SseVec& vec)
 	{
-		return _mm_sqrt_ps(vec);
+		if (policy == PrecisionPolicy::EXACT)
+		{
+			return _mm_sqrt_ps(vec);
+		}
+
+		SseVec nonZeroMask = _mm_cmpneq_ps(vec, _mm_setzero_ps());
+
+		return VecAnd(nonZeroMask, VecMul(vec, VecRSqrt<policy>(vec)));
 	}
 
 	/*!
@@ -742,620 +1065,2127 @@ namespace gofxmath
 	 *
 	 * \date	2/21/2015
 	 *
+	 * \tparam	policy	How the division is calculated.
 	 * \param	v0	The first vector.
 	 * \param	v1	The second vector.
 	 *
 	 * \return	The quotient of the two vectors' respective components.
 	 *
-	 * \remarks Equivalent to a call to <CODE>_mm_div_ps(vec)</CODE>.
+	 * \remarks With the default gofxmath::PrecisionPolicy::EXACT, equivalent to a call to
+	 *			<CODE>_mm_div_ps(vec)</CODE>.  Otherwise multiplies by VecRcp with the same policy.
 	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
 	SSE_VEC_CALL VecDiv(const SseVec& v0, const SseVec& v1)
 	{
-		return _mm_div_ps(v0, v1);
+		if (policy == PrecisionPolicy::EXACT)
+		{
+			return _mm_div_ps(v0, v1);
+		}
+
+		return VecMul(v0, VecRcp<policy>(v1));
 	}
 
 	/*!
-	 * \brief	Adds two SseVecs representing Vec2s.
+	 * \brief	Compares the two given SseVecs for equality.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	The first 2D vector.
-	 * \param	v1	The second 2D vector.
+	 * \return	A mask with all bits set in the positions where v0 is equal to v1.
 	 *
-	 * \return	The sum SseVec of the two original SseVecs.
+	 * \remarks Equivalent to a call to <CODE>_mm_cmpeq_ps(v0, v1)</CODE>.  NaNs compare unequal.
 	 */
-	SSE_VEC_CALL Vec2Add(const SseVec& v0, const SseVec& v1)
+	SSE_VEC_CALL VecCmpEQ(const SseVec& v0, const SseVec& v1)
 	{
-		static const SseVec VEC2_MASK = SetSseVecMask(0xFFFFFFFF, 0xFFFFFFFF, 0x0, 0x0);
-		SseVec tmp = VecAnd(v0, VEC2_MASK);
-		SseVec result = VecAdd(tmp, v1);
-
-		return result;
+		return _mm_cmpeq_ps(v0, v1);
 	}
 
 	/*!
-	 * \brief	Adds two SseVecs representing Vec3s.
+	 * \brief	Compares the two given SseVecs for inequality.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	The first 3D vector.
-	 * \param	v1	The second 3D vector.
+	 * \return	A mask with all bits set in the positions where v0 is not equal to v1.
 	 *
-	 * \return	The sum SseVec of the two original SseVecs.
+	 * \remarks Equivalent to a call to <CODE>_mm_cmpneq_ps(v0, v1)</CODE>.  NaNs compare unequal.
 	 */
-	SSE_VEC_CALL Vec3Add(const SseVec& v0, const SseVec& v1)
+	SSE_VEC_CALL VecCmpNEQ(const SseVec& v0, const SseVec& v1)
 	{
-		static const SseVec VEC3_MASK = SetSseVecMask(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0);
-		SseVec tmp = VecAnd(v0, VEC3_MASK);
-		SseVec result = VecAdd(tmp, v1);
-
-		return result;
+		return _mm_cmpneq_ps(v0, v1);
 	}
-	
+
 	/*!
-	 * \brief	Subtracts two SseVecs representing Vec2s.
-	 * 
-	 * \date	2/21/2015
+	 * \brief	Compares the two given SseVecs for "less-than."
 	 *
-	 * \param	v0	The first 2D vector.
-	 * \param	v1	The second 2D vector.
+	 * \date	10/18/2026
 	 *
-	 * \return	The difference SseVec of the two original SseVecs.
+	 * \return	A mask with all bits set in the positions where v0 is less than v1.
+	 *
+	 * \remarks Equivalent to a call to <CODE>_mm_cmplt_ps(v0, v1)</CODE>.
 	 */
-	SSE_VEC_CALL Vec2Sub(const SseVec& v0, const SseVec& v1)
+	SSE_VEC_CALL VecCmpLT(const SseVec& v0, const SseVec& v1)
 	{
-		static const SseVec VEC3_MASK = SetSseVecMask(0xFFFFFFFF, 0xFFFFFFFF, 0x0, 0x0);
-		SseVec tmp = VecAnd(v1, VEC3_MASK);
-		return VecSub(v0, tmp);
+		return _mm_cmplt_ps(v0, v1);
 	}
 
 	/*!
-	 * \brief	Subtracts two SseVecs representing Vec3s.
-	 * 
-	 * \date	2/21/2015
+	 * \brief	Compares the two given SseVecs for "less-than-or-equal."
 	 *
-	 * \param	v0	The first 3D vector.
-	 * \param	v1	The second 3D vector.
+	 * \date	10/18/2026
 	 *
-	 * \return	The difference SseVec of the two original SseVecs.
+	 * \return	A mask with all bits set in the positions where v0 is less than or equal to v1.
+	 *
+	 * \remarks Equivalent to a call to <CODE>_mm_cmple_ps(v0, v1)</CODE>.
 	 */
-	SSE_VEC_CALL Vec3Sub(const SseVec& v0, const SseVec& v1)
+	SSE_VEC_CALL VecCmpLE(const SseVec& v0, const SseVec& v1)
 	{
-		static const SseVec VEC3_MASK = SetSseVecMask(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0);
-		SseVec tmp = VecAnd(v1, VEC3_MASK);
-		return VecSub(v0, tmp);
+		return _mm_cmple_ps(v0, v1);
 	}
 
 	/*!
-	 * \brief	Multiplies two SseVecs representing Vec2s and then adds a third.
+	 * \brief	Compares the two given SseVecs for "greater-than."
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	The first 2D vector.
-	 * \param	v1	The second 2D vector.
-	 * \param	v2	The third 2D vector.
+	 * \return	A mask with all bits set in the positions where v0 is greater than v1.
 	 *
-	 * \return	The result of the multiplication of the first two vectors summed with the third.
+	 * \remarks Equivalent to a call to <CODE>_mm_cmpgt_ps(v0, v1)</CODE>.
 	 */
-	SSE_VEC_CALL Vec2MulAdd(const SseVec& v0, const SseVec& v1, const SseVec& v2)
+	SSE_VEC_CALL VecCmpGT(const SseVec& v0, const SseVec& v1)
 	{
-		SseVec tmp0 = VecMul(v0, v1);
-		return VecAdd(tmp0, v2);
+		return _mm_cmpgt_ps(v0, v1);
 	}
 
 	/*!
-	 * \brief	Multiplies two SseVecs representing Vec3s then adds a third.
+	 * \brief	Compares the two given SseVecs for "greater-than-or-equal."
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	The first 3D vector.
-	 * \param	v1	The second 3D vector.
-	 * \param	v2	The third 3D vector.
+	 * \return	A mask with all bits set in the positions where v0 is greater than or equal to v1.
 	 *
-	 * \return	The result of the multiplication of the first two vectors summed with the third.
+	 * \remarks Equivalent to a call to <CODE>_mm_cmpge_ps(v0, v1)</CODE>.
 	 */
-	SSE_VEC_CALL Vec3MulAdd(const SseVec& v0, const SseVec& v1, const SseVec& v2)
+	SSE_VEC_CALL VecCmpGE(const SseVec& v0, const SseVec& v1)
 	{
-		SseVec tmp = VecMul(v0, v1);
-		SseVec result = VecAdd(tmp, v2);
-
-		return result;
+		return _mm_cmpge_ps(v0, v1);
 	}
 
 	/*!
-	 * \brief	Multiplies two SseVecs representing Vec4s then adds a third.
+	 * \brief	Gathers the sign bits of the four components of the given SseVec into an int.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	The first 4D vector.
-	 * \param	v1	The second 4D vector.
-	 * \param	v2	The third 4D vector.
+	 * \param	vec	The SseVec, usually a mask from one of the VecCmp functions.
 	 *
-	 * \return	The result of the multiplication of the first two vectors summed with the third.
+	 * \return	An int with bit 0 holding the sign of x, bit 1 of y, bit 2 of z and bit 3 of w.
+	 *
+	 * \remarks Equivalent to a call to <CODE>_mm_movemask_ps(vec)</CODE>.
 	 */
-	SSE_VEC_CALL Vec4MulAdd(const SseVec& v0, const SseVec& v1, const SseVec& v2)
+	inline int VecMoveMask(const SseVec& vec)
 	{
-		SseVec tmp = VecMul(v0, v1);
-		return VecAdd(tmp, v2);
+		return _mm_movemask_ps(vec);
 	}
 
 	/*!
-	 * \brief	Multiplies the given SseVec representing a Vec2 by the given scalar.
+	 * \brief	Checks whether the sign bit of any of the four components of the given SseVec is set.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	  	The 2D vector to be scaled.
-	 * \param	scalar	The scalar to multiply against the vector.
+	 * \param	vec	The SseVec, usually a mask from one of the VecCmp functions.
 	 *
-	 * \return	The scaled form of the given 2D vector.
+	 * \return	true if any of the four sign bits is set.
+	 *
+	 * \remarks With AVX, uses <CODE>_mm_testz_ps</CODE>, which sets the flags directly instead of
+	 *			moving the mask to an integer register first.
 	 */
-	SSE_VEC_CALL Vec2MulScalar(const SseVec& v0, float scalar)
+	inline bool VecAnyTrue(const SseVec& vec)
 	{
-		SseVec s = SetSseVec2(scalar, scalar);
-		return VecMul(v0, s);
+#if defined(__AVX__)
+		return _mm_testz_ps(vec, vec) == 0;
+#else
+		return _mm_movemask_ps(vec) != 0;
+#endif
 	}
 
 	/*!
-	 * \brief	Multiplies the given SseVec representing a Vec3 by the given scalar.
+	 * \brief	Checks whether the sign bits of all four components of the given SseVec are set.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	  	The 3D vector to be scaled.
-	 * \param	scalar	The scalar to multiply against the vector.
+	 * \param	vec	The SseVec, usually a mask from one of the VecCmp functions.
 	 *
-	 * \return	The scaled form of the given 3D vector.
+	 * \return	true if all four sign bits are set.
+	 *
+	 * \remarks With AVX, uses <CODE>_mm_testc_ps</CODE> against an all-ones mask.
 	 */
-	SSE_VEC_CALL Vec3MulScalar(const SseVec& v0, float scalar)
+	inline bool VecAllTrue(const SseVec& vec)
 	{
-		SseVec s = SetSseVec3(scalar, scalar, scalar);
-		return VecMul(v0, s);
+#if defined(__AVX__)
+		return _mm_testc_ps(vec, _mm_castsi128_ps(_mm_set1_epi32(-1))) != 0;
+#else
+		return _mm_movemask_ps(vec) == 0xF;
+#endif
 	}
 
 	/*!
-	 * \brief	Multiplies the given SseVec representing a Vec4 by the given scalar.
+	 * \brief	Checks whether the sign bit of any of the x, y and z components of the given SseVec is
+	 *			set, ignoring w.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	  	The 4D vector to be scaled.
-	 * \param	scalar	The scalar to multiply against the vector.
+	 * \param	vec	The SseVec, usually a mask from one of the VecCmp functions.
 	 *
-	 * \return	The scaled form of the given 4D vector.
+	 * \return	true if any of the three sign bits is set.
 	 */
-	SSE_VEC_CALL Vec4MulScalar(const SseVec& v0, float scalar)
+	inline bool Vec3AnyTrue(const SseVec& vec)
 	{
-		SseVec s = SetSseVec4(scalar, scalar, scalar, scalar);
-		return VecMul(v0, s);
+		return (_mm_movemask_ps(vec) & 0x7) != 0;
 	}
 
 	/*!
-	 * \brief	Calculates the normalized form of the given 2D vector.
+	 * \brief	Checks whether the sign bits of all of the x, y and z components of the given SseVec
+	 *			are set, ignoring w.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	vec	The 2D vector to find the normalized form of.
+	 * \param	vec	The SseVec, usually a mask from one of the VecCmp functions.
 	 *
-	 * \return	The normalized form of the given 2D vector.
+	 * \return	true if all three sign bits are set.
 	 */
-	SSE_VEC_CALL Vec2Normalize(const SseVec& vec)
+	inline bool Vec3AllTrue(const SseVec& vec)
 	{
-		SseVec tmp0;
-		tmp0 = Vec2Dot(vec, vec);
-
-		SseVec result = VecSqrt(tmp0);
-
-		SseVec zeroMask = _mm_cmpnle_ps(result, EPSILON_1111);
-
-		result = VecDiv(vec, result);
-
-		result = VecAnd(zeroMask, result);
-		return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT, BlendOrder::RIGHT>(result, UNIT_0001);
+		return (_mm_movemask_ps(vec) & 0x7) == 0x7;
 	}
 
 	/*!
-	 * \brief	Calculates the normalized form of the given 3D vector.
+	 * \brief	Sums all four components of the given SseVec into all four positions of the result.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	vec	The 3D vector to find the normalized form of.
+	 * \param	vec	The SseVec to sum.
 	 *
-	 * \return	The normalized form of the given 3D vector.
+	 * \return	An SseVec containing four copies of %%x + y + z + w%%.
+	 *
+	 * \remarks Two swizzle-and-add steps, which leave the sum in every lane.  <CODE>_mm_hadd_ps</CODE>
+	 *			is avoided: it decodes to two shuffles and an add on every current core, so two of them
+	 *			cost more than this.
 	 */
-	SSE_VEC_CALL Vec3Normalize(const SseVec& vec)
+	SSE_VEC_CALL VecHSum(const SseVec& vec)
 	{
-		static const SseVec UNIT_0001 = SetSseVec4(0.0f, 0.0f, 0.0f, 1.0f);
-		static const SseVec EPSILON_1111 = SetSseVec4(Epsilon());
-		static const SseVec INFINITY_1111 = SetSseVec4(Infinity());
+		SseVec tmp0 = VecAdd(vec, VecSwizzle<VecCoord::Y, VecCoord::X, VecCoord::W, VecCoord::Z>(vec));// (x + y) (x + y) (z + w) (z + w)
 
-		SseVec tmp0;
-		tmp0 = Vec3Dot(vec, vec);
+		return VecAdd(tmp0, VecSwizzle<VecCoord::Z, VecCoord::W, VecCoord::X, VecCoord::Y>(tmp0));
+	}
 
-		SseVec result = VecSqrt(tmp0);
-		SseVec zeroMask = _mm_cmpnle_ps(result, EPSILON_1111);
-		result = _mm_div_ps(vec, result);
+	/*!
+	 * \brief	Finds the smallest of the four components of the given SseVec.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVec to reduce.
+	 *
+	 * \return	An SseVec containing four copies of the smallest component.
+	 *
+	 * \remarks NaN components are not reliably skipped; see <CODE>_mm_min_ps</CODE>.
+	 */
+	SSE_VEC_CALL VecHMin(const SseVec& vec)
+	{
+		SseVec tmp0 = _mm_min_ps(vec, VecSwizzle<VecCoord::Y, VecCoord::X, VecCoord::W, VecCoord::Z>(vec));
 
-		SseVec infMask = _mm_cmpneq_ps(result, INFINITY_1111);
-		SseVec mask = VecAnd(zeroMask, infMask);
+		return _mm_min_ps(tmp0, VecSwizzle<VecCoord::Z, VecCoord::W, VecCoord::X, VecCoord::Y>(tmp0));
+	}
 
-		result = VecAnd(mask, result);
-		return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(result, UNIT_0001);
+	/*!
+	 * \brief	Finds the largest of the four components of the given SseVec.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVec to reduce.
+	 *
+	 * \return	An SseVec containing four copies of the largest component.
+	 *
+	 * \remarks NaN components are not reliably skipped; see <CODE>_mm_max_ps</CODE>.
+	 */
+	SSE_VEC_CALL VecHMax(const SseVec& vec)
+	{
+		SseVec tmp0 = _mm_max_ps(vec, VecSwizzle<VecCoord::Y, VecCoord::X, VecCoord::W, VecCoord::Z>(vec));
+
+		return _mm_max_ps(tmp0, VecSwizzle<VecCoord::Z, VecCoord::W, VecCoord::X, VecCoord::Y>(tmp0));
 	}
 
 	/*!
-	 * \brief	Calculates the normalized form of the given 4D vector.
+	 * \brief	Check for approximate equality of all four components of two SseVecs.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	vec	The 4D vector to find the normalized form of.
+	 * \tparam	precision	The precision level to use for the approximation.
+	 * \param	v0	The first vector.
+	 * \param	v1	The second vector.
 	 *
-	 * \return	The normalized form of the given 4D vector.
+	 * \return	true if every pair of components is within the given precision epsilon of one another
+	 *			(as with ApproxEqual), otherwise false.  NaNs are never approximately equal.
+	 *
+	 * \remarks All four lanes are compared at once and answered with one VecMoveMask.
+	 *
+	 * \sa FloatPrecision
 	 */
-	SSE_VEC_CALL Vec4Normalize(const SseVec& vec)
+	template<FloatPrecision precision = FloatPrecision::HIGH>
+	inline bool SseVecApproxEqual(const SseVec& v0, const SseVec& v1)
 	{
-		static const SseVec EPSILON_1111 = SetSseVec4(Epsilon());
-		static const SseVec INFINITY_1111 = SetSseVec4(Infinity());
+		SseVec difference = Vec4Abs(VecSub(v0, v1));
 
-		SseVec tmp0;
-		tmp0 = Vec4Dot(vec, vec);
+		return VecAllTrue(VecCmpLE(difference, SetSseVec4(FloatPrecisionValue<precision>())));
+	}
 
-		SseVec result = VecSqrt(tmp0);
-		SseVec zeroMask = _mm_cmpnle_ps(result, EPSILON_1111);
-		result = VecDiv(vec, result);
+	/*!
+	 * \brief	Check for approximate equality of the x, y and z components of two SseVecs, ignoring w.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precision	The precision level to use for the approximation.
+	 * \param	v0	The first 3D vector.
+	 * \param	v1	The second 3D vector.
+	 *
+	 * \return	true if the x, y and z components are within the given precision epsilon of one another,
+	 *			otherwise false.
+	 *
+	 * \sa FloatPrecision
+	 */
+	template<FloatPrecision precision = FloatPrecision::HIGH>
+	inline bool SseVec3ApproxEqual(const SseVec& v0, const SseVec& v1)
+	{
+		SseVec difference = Vec4Abs(VecSub(v0, v1));
 
-		SseVec infMask = _mm_cmpneq_ps(result, INFINITY_1111);
-		SseVec mask = VecAnd(zeroMask, infMask);
+		return Vec3AllTrue(VecCmpLE(difference, SetSseVec4(FloatPrecisionValue<precision>())));
+	}
 
-		return VecAnd(mask, result);
+	/*!
+	 * \brief	Finds the components of the given SseVec that are NaN or infinite.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVec to classify.
+	 *
+	 * \return	A mask with all bits set in the positions holding a NaN or an infinity.
+	 *
+	 * \remarks Both have every exponent bit set, so one integer compare of the exponent field covers
+	 *			them, with no floating point compare that could trap or be reordered.
+	 */
+	SSE_VEC_CALL VecNaNOrInfMask(const SseVec& vec)
+	{
+		const __m128i EXPONENT_MASK = _mm_set1_epi32(0x7F800000);
+		__m128i exponents = _mm_and_si128(_mm_castps_si128(vec), EXPONENT_MASK);
+
+		return _mm_castsi128_ps(_mm_cmpeq_epi32(exponents, EXPONENT_MASK));
 	}
 
 	/*!
-	 * \brief	Calculates a fast approximation of the normalized form of a given 2D vector.
+	 * \brief	Checks whether any of the four components of the given SseVec is NaN or infinite.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVec to check.
+	 *
+	 * \return	true if any component is NaN or infinite, otherwise false.
+	 */
+	inline bool HasNaNOrInf(const SseVec& vec)
+	{
+		return VecAnyTrue(VecNaNOrInfMask(vec));
+	}
+
+	/*!
+	 * \brief	Checks whether any of the x, y and z components of the given SseVec is NaN or infinite,
+	 *			ignoring w.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The 3D SseVec to check.
+	 *
+	 * \return	true if the x, y or z component is NaN or infinite, otherwise false.
+	 */
+	inline bool Vec3HasNaNOrInf(const SseVec& vec)
+	{
+		return Vec3AnyTrue(VecNaNOrInfMask(vec));
+	}
+
+	/*!
+	 * \brief	Finds the first SseVec in the given array with a NaN or infinite component.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vecs 	The SseVecs to check.
+	 * \param	count	The number of SseVecs.
+	 *
+	 * \return	The index of the first SseVec for which HasNaNOrInf is true, or count if there is none.
+	 *
+	 * \remarks The masks of four SseVecs are combined before each VecAnyTrue, so a clean array costs
+	 *			one branch per four elements.
+	 */
+	inline size_t FindNaNOrInf(const SseVec* vecs, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			SseVec mask = VecOr(VecOr(VecNaNOrInfMask(vecs[i]), VecNaNOrInfMask(vecs[i + 1])),
+				VecOr(VecNaNOrInfMask(vecs[i + 2]), VecNaNOrInfMask(vecs[i + 3])));
+
+			if (VecAnyTrue(mask))
+			{
+				break;
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			if (HasNaNOrInf(vecs[i]))
+			{
+				return i;
+			}
+		}
+
+		return count;
+	}
+
+	/*!
+	 * \brief	Adds two SseVecs representing Vec2s.
 	 *
 	 * \date	2/21/2015
 	 *
-	 * \param	vec	The 2D vector to find the approximate normalized form of.
+	 * \param	v0	The first 2D vector.
+	 * \param	v1	The second 2D vector.
 	 *
-	 * \return	The approimate normalized form of the given 2D vector.
+	 * \return	The sum SseVec of the two original SseVecs.
+	 */
+	SSE_VEC_CALL Vec2Add(const SseVec& v0, const SseVec& v1)
+	{
+		static constexpr SseVecMaskConst VEC2_MASK = { { 0xFFFFFFFF, 0xFFFFFFFF, 0x0, 0x0 } };
+		SseVec tmp = VecAnd(v0, VEC2_MASK);
+		SseVec result = VecAdd(tmp, v1);
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Adds two SseVecs representing Vec3s.
 	 *
-	 * \remarks	Uses the fast inverse square root to approximate the normalized vector considerably
-	 * 			more quickly, without losing a lot of accuracy.
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	The first 3D vector.
+	 * \param	v1	The second 3D vector.
+	 *
+	 * \return	The sum SseVec of the two original SseVecs.
 	 */
-	SSE_VEC_CALL FastVec2Normalize(const SseVec& vec)
+	SSE_VEC_CALL Vec3Add(const SseVec& v0, const SseVec& v1)
 	{
-		SseVec tmp0;
-		SseVec result;
-		tmp0 = Vec3Dot(vec, vec);
+		static constexpr SseVecMaskConst VEC3_MASK = { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0 } };
+		SseVec tmp = VecAnd(v0, VEC3_MASK);
+		SseVec result = VecAdd(tmp, v1);
 
-		tmp0 = VecRSqrt(tmp0);
-		result = VecMul(vec, tmp0);
-		result = VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(result, UNIT_0001);
 		return result;
 	}
+	
+	/*!
+	 * \brief	Subtracts two SseVecs representing Vec2s.
+	 * 
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	The first 2D vector.
+	 * \param	v1	The second 2D vector.
+	 *
+	 * \return	The difference SseVec of the two original SseVecs.
+	 */
+	SSE_VEC_CALL Vec2Sub(const SseVec& v0, const SseVec& v1)
+	{
+		static constexpr SseVecMaskConst VEC3_MASK = { { 0xFFFFFFFF, 0xFFFFFFFF, 0x0, 0x0 } };
+		SseVec tmp = VecAnd(v1, VEC3_MASK);
+		return VecSub(v0, tmp);
+	}
 
 	/*!
-	 * \brief	Calculates a fast approximation of the normalized form of a given 3D vector.
+	 * \brief	Subtracts two SseVecs representing Vec3s.
+	 * 
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	The first 3D vector.
+	 * \param	v1	The second 3D vector.
+	 *
+	 * \return	The difference SseVec of the two original SseVecs.
+	 */
+	SSE_VEC_CALL Vec3Sub(const SseVec& v0, const SseVec& v1)
+	{
+		static constexpr SseVecMaskConst VEC3_MASK = { { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0 } };
+		SseVec tmp = VecAnd(v1, VEC3_MASK);
+		return VecSub(v0, tmp);
+	}
+
+	/*!
+	 * \brief	Multiplies two SseVecs representing Vec2s and then adds a third.
 	 *
 	 * \date	2/21/2015
 	 *
-	 * \param	vec	The 3D vector to find the approximate normalized form of.
+	 * \param	v0	The first 2D vector.
+	 * \param	v1	The second 2D vector.
+	 * \param	v2	The third 2D vector.
 	 *
-	 * \return	The approimate normalized form of the given 3D vector.
+	 * \return	The result of the multiplication of the first two vectors summed with the third.
+	 */
+	SSE_VEC_CALL Vec2MulAdd(const SseVec& v0, const SseVec& v1, const SseVec& v2)
+	{
+		SseVec tmp0 = VecMul(v0, v1);
+		return VecAdd(tmp0, v2);
+	}
+
+	/*!
+	 * \brief	Multiplies two SseVecs representing Vec3s then adds a third.
 	 *
-	 * \remarks	Uses the fast inverse square root to approximate the normalized vector considerably
-	 * 			more quickly, without losing a lot of accuracy.
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	The first 3D vector.
+	 * \param	v1	The second 3D vector.
+	 * \param	v2	The third 3D vector.
+	 *
+	 * \return	The result of the multiplication of the first two vectors summed with the third.
 	 */
-	SSE_VEC_CALL FastVec3Normalize(const SseVec& vec)
+	SSE_VEC_CALL Vec3MulAdd(const SseVec& v0, const SseVec& v1, const SseVec& v2)
 	{
-		SseVec result;
-		SseVec tmp0 = _mm_dp_ps(vec, vec, 0x7F);
-		tmp0 = _mm_rsqrt_ps(tmp0);
-		result = VecMul(vec, tmp0);
-		result = VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(result, UNIT_0001);
+		SseVec tmp = VecMul(v0, v1);
+		SseVec result = VecAdd(tmp, v2);
 
 		return result;
 	}
 
 	/*!
-	 * \brief	Calculates a fast approximation of the normalized form of a given 4D vector.
+	 * \brief	Multiplies two SseVecs representing Vec4s then adds a third.
 	 *
 	 * \date	2/21/2015
 	 *
-	 * \param	vec	The 4D vector to find the approximate normalized form of.
+	 * \param	v0	The first 4D vector.
+	 * \param	v1	The second 4D vector.
+	 * \param	v2	The third 4D vector.
 	 *
-	 * \return	The approimate normalized form of the given 4D vector.
+	 * \return	The result of the multiplication of the first two vectors summed with the third.
+	 */
+	SSE_VEC_CALL Vec4MulAdd(const SseVec& v0, const SseVec& v1, const SseVec& v2)
+	{
+		SseVec tmp = VecMul(v0, v1);
+		return VecAdd(tmp, v2);
+	}
+
+	/*!
+	 * \brief	Multiplies the given SseVec representing a Vec2 by the given scalar.
 	 *
-	 * \remarks	Uses the fast inverse square root to approximate the normalized vector considerably
-	 * 			more quickly, without losing a lot of accuracy.
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	  	The 2D vector to be scaled.
+	 * \param	scalar	The scalar to multiply against the vector.
+	 *
+	 * \return	The scaled form of the given 2D vector.
 	 */
-	SSE_VEC_CALL FastVec4Normalize(const SseVec& vec)
+	SSE_VEC_CALL Vec2MulScalar(const SseVec& v0, float scalar)
 	{
-		SseVec tmp0 = _mm_dp_ps(vec, vec, 0xFF);
-		tmp0 = _mm_rsqrt_ps(tmp0);
-		return VecMul(vec, tmp0);
+		SseVec s = SetSseVec2(scalar, scalar);
+		return VecMul(v0, s);
+	}
+
+	/*!
+	 * \brief	Multiplies the given SseVec representing a Vec3 by the given scalar.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	  	The 3D vector to be scaled.
+	 * \param	scalar	The scalar to multiply against the vector.
+	 *
+	 * \return	The scaled form of the given 3D vector.
+	 */
+	SSE_VEC_CALL Vec3MulScalar(const SseVec& v0, float scalar)
+	{
+		SseVec s = SetSseVec3(scalar, scalar, scalar);
+		return VecMul(v0, s);
+	}
+
+	/*!
+	 * \brief	Multiplies the given SseVec representing a Vec4 by the given scalar.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	  	The 4D vector to be scaled.
+	 * \param	scalar	The scalar to multiply against the vector.
+	 *
+	 * \return	The scaled form of the given 4D vector.
+	 */
+	SSE_VEC_CALL Vec4MulScalar(const SseVec& v0, float scalar)
+	{
+		SseVec s = SetSseVec4(scalar, scalar, scalar, scalar);
+		return VecMul(v0, s);
+	}
+
+	/*!
+	 * \brief	Calculates the normalized form of the given 2D vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \tparam	policy	How the length is calculated and divided out.
+	 * \param	vec	The 2D vector to find the normalized form of.
+	 *
+	 * \return	The normalized form of the given 2D vector.
+	 *
+	 * \remarks	With gofxmath::PrecisionPolicy::REFINED or gofxmath::PrecisionPolicy::ESTIMATE, scales by
+	 *			VecRSqrt of the squared length instead of dividing by the square root.  Vectors
+	 *			with a length under Epsilon() still come out as zero.
+	 *
+	 * \sa FastVec2Normalize
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
+	SSE_VEC_CALL Vec2Normalize(const SseVec& vec)
+	{
+		SseVec tmp0;
+		tmp0 = Vec2Dot(vec, vec);
+
+		if (policy != PrecisionPolicy::EXACT)
+		{
+			static constexpr SseVecConst EPSILON_SQR_1111 = SseVecConstSplat(Epsilon() * Epsilon());
+
+			SseVec lengthMask = _mm_cmpnle_ps(tmp0, EPSILON_SQR_1111);
+			tmp0 = VecAnd(lengthMask, VecMul(vec, VecRSqrt<policy>(tmp0)));
+
+			return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT, BlendOrder::RIGHT>(tmp0, UNIT_0001);
+		}
+
+		SseVec result = VecSqrt(tmp0);
+
+		SseVec zeroMask = _mm_cmpnle_ps(result, EPSILON_1111);
+
+		result = VecDiv(vec, result);
+
+		result = VecAnd(zeroMask, result);
+		return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT, BlendOrder::RIGHT>(result, UNIT_0001);
+	}
+
+	/*!
+	 * \brief	Calculates the normalized form of the given 3D vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \tparam	policy	How the length is calculated and divided out.
+	 * \param	vec	The 3D vector to find the normalized form of.
+	 *
+	 * \return	The normalized form of the given 3D vector.
+	 *
+	 * \remarks	With gofxmath::PrecisionPolicy::REFINED or gofxmath::PrecisionPolicy::ESTIMATE, scales by
+	 *			VecRSqrt of the squared length instead of dividing by the square root.  Vectors
+	 *			with a length under Epsilon() still come out as zero.
+	 *
+	 * \sa FastVec3Normalize
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
+	SSE_VEC_CALL Vec3Normalize(const SseVec& vec)
+	{
+		static constexpr SseVecConst INFINITY_1111 = SseVecConstSplat(Infinity());
+
+		SseVec tmp0;
+		tmp0 = Vec3Dot(vec, vec);
+
+		if (policy != PrecisionPolicy::EXACT)
+		{
+			static constexpr SseVecConst EPSILON_SQR_1111 = SseVecConstSplat(Epsilon() * Epsilon());
+
+			SseVec lengthMask = _mm_cmpnle_ps(tmp0, EPSILON_SQR_1111);
+			tmp0 = VecAnd(lengthMask, VecMul(vec, VecRSqrt<policy>(tmp0)));
+
+			return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(tmp0, UNIT_0001);
+		}
+
+		SseVec result = VecSqrt(tmp0);
+		SseVec zeroMask = _mm_cmpnle_ps(result, EPSILON_1111);
+		result = _mm_div_ps(vec, result);
+
+		SseVec infMask = _mm_cmpneq_ps(result, INFINITY_1111);
+		SseVec mask = VecAnd(zeroMask, infMask);
+
+		result = VecAnd(mask, result);
+		return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(result, UNIT_0001);
+	}
+
+	/*!
+	 * \brief	Calculates the normalized form of the given 4D vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \tparam	policy	How the length is calculated and divided out.
+	 * \param	vec	The 4D vector to find the normalized form of.
+	 *
+	 * \return	The normalized form of the given 4D vector.
+	 *
+	 * \remarks	With gofxmath::PrecisionPolicy::REFINED or gofxmath::PrecisionPolicy::ESTIMATE, scales by
+	 *			VecRSqrt of the squared length instead of dividing by the square root.  Vectors
+	 *			with a length under Epsilon() still come out as zero.
+	 *
+	 * \sa FastVec4Normalize
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
+	SSE_VEC_CALL Vec4Normalize(const SseVec& vec)
+	{
+		static constexpr SseVecConst INFINITY_1111 = SseVecConstSplat(Infinity());
+
+		SseVec tmp0;
+		tmp0 = Vec4Dot(vec, vec);
+
+		if (policy != PrecisionPolicy::EXACT)
+		{
+			static constexpr SseVecConst EPSILON_SQR_1111 = SseVecConstSplat(Epsilon() * Epsilon());
+
+			SseVec lengthMask = _mm_cmpnle_ps(tmp0, EPSILON_SQR_1111);
+
+			return VecAnd(lengthMask, VecMul(vec, VecRSqrt<policy>(tmp0)));
+		}
+
+		SseVec result = VecSqrt(tmp0);
+		SseVec zeroMask = _mm_cmpnle_ps(result, EPSILON_1111);
+		result = VecDiv(vec, result);
+
+		SseVec infMask = _mm_cmpneq_ps(result, INFINITY_1111);
+		SseVec mask = VecAnd(zeroMask, infMask);
+
+		return VecAnd(mask, result);
+	}
+
+	/*!
+	 * \brief	Calculates a fast approximation of the normalized form of a given 2D vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	vec	The 2D vector to find the approximate normalized form of.
+	 *
+	 * \return	The approimate normalized form of the given 2D vector.
+	 *
+	 * \remarks	Uses the fast inverse square root to approximate the normalized vector considerably
+	 * 			more quickly, without losing a lot of accuracy.
+	 */
+	SSE_VEC_CALL FastVec2Normalize(const SseVec& vec)
+	{
+		SseVec tmp0;
+		SseVec result;
+		tmp0 = Vec3Dot(vec, vec);
+
+		tmp0 = VecRSqrt(tmp0);
+		result = VecMul(vec, tmp0);
+		result = VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(result, UNIT_0001);
+		return result;
+	}
+
+	/*!
+	 * \brief	Calculates a fast approximation of the normalized form of a given 3D vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	vec	The 3D vector to find the approximate normalized form of.
+	 *
+	 * \return	The approimate normalized form of the given 3D vector.
+	 *
+	 * \remarks	Uses the fast inverse square root to approximate the normalized vector considerably
+	 * 			more quickly, without losing a lot of accuracy.
+	 */
+	SSE_VEC_CALL FastVec3Normalize(const SseVec& vec)
+	{
+		SseVec result;
+		SseVec tmp0 = _mm_dp_ps(vec, vec, 0x7F);
+		tmp0 = _mm_rsqrt_ps(tmp0);
+		result = VecMul(vec, tmp0);
+		result = VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(result, UNIT_0001);
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Calculates a fast approximation of the normalized form of a given 4D vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	vec	The 4D vector to find the approximate normalized form of.
+	 *
+	 * \return	The approimate normalized form of the given 4D vector.
+	 *
+	 * \remarks	Uses the fast inverse square root to approximate the normalized vector considerably
+	 * 			more quickly, without losing a lot of accuracy.
+	 */
+	SSE_VEC_CALL FastVec4Normalize(const SseVec& vec)
+	{
+		SseVec tmp0 = _mm_dp_ps(vec, vec, 0xFF);
+		tmp0 = _mm_rsqrt_ps(tmp0);
+		return VecMul(vec, tmp0);
+	}
+
+	/*!
+	 * \brief	Calculates the cross product of the two given 3D vectors.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	v0	The first 3D vector in the cross product.
+	 * \param	v1	The second 3D vector in the cross product.
+	 *
+	 * \return	The cross product of the two given 3D vectors.
+	 */
+	SSE_VEC_CALL Vec3Cross(const SseVec& v0, const SseVec& v1)
+	{
+		SseVec tmp0, tmp1, tmp2, tmp3;
+		SseVec result;
+
+		tmp0 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::NA>(v0);
+		tmp1 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::NA>(v1);
+		tmp2 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::NA>(v0);
+		tmp3 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::NA>(v1);
+
+		tmp0 = VecMul(tmp0, tmp1);
+		tmp2 = VecMul(tmp2, tmp3);
+
+		result = VecSub(tmp0, tmp2);
+		result = VecOr(result, UNIT_0001);
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Normalizes the given angles (assumed radians) to (-PI,PI).
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	angles	The angles (assumed radians).
+	 *
+	 * \return	A SSE_VEC_CALL.
+	 */
+	SSE_VEC_CALL NormalizeAngles(const SseVec& angles)
+	{
+		SseVec tmp0, tmp1;
+
+		tmp0 = VecAdd(angles, F_PI_1111);
+		tmp0 = VecMul(tmp0, F_1_2PI_1111);
+		tmp1 = _mm_floor_ps(tmp0);
+		tmp0 = VecMul(F_2PI_1111, tmp1);
+		tmp0 = VecSub(angles, tmp0);
+
+		return tmp0;
+	}
+
+	/*!
+	 * \brief	Reduces the given angles (assumed radians) to %%[-\\frac{\\pi}{4},\\frac{\\pi}{4}]%% with
+	 * 			Cody-Waite range reduction.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	angles				The angles (assumed radians).
+	 * \param [out]	quadrants	The quadrant each angle fell in: the nearest multiple of
+	 * 								%%\\frac{\\pi}{2}%%, modulo 4, as 32-bit integers.
+	 *
+	 * \return	The angles minus their nearest multiples of %%\\frac{\\pi}{2}%%.
+	 *
+	 * \remarks	Gives the same quadrants as ReduceAngleCodyWaite, and the same reduced angles up to
+	 *			rounding (where the compiler contracts the scalar version into FMAs), with the same
+	 *			supported range.  The quadrant is taken from k modulo 4 while k is still a float, so it
+	 *			stays correct where k itself would not fit in an int.
+	 *
+	 * \sa ReduceAngleCodyWaite
+	 */
+	SSE_VEC_CALL ReduceAnglesCodyWaite(const SseVec& angles, __m128i& quadrants)
+	{
+		const SseVec F_2_PI_1111 = SetSseVec4(F_2_PI);
+		const SseVec FOUR_1111 = SetSseVec4(4.0f);
+		const SseVec QUARTER_1111 = SetSseVec4(0.25f);
+		const SseVec F_PI_2_HI_1111 = SetSseVec4(F_PI_2_HI);
+		const SseVec F_PI_2_MID_1111 = SetSseVec4(F_PI_2_MID);
+		const SseVec F_PI_2_LO_1111 = SetSseVec4(F_PI_2_LO);
+
+		SseVec k, reduced;
+
+		k = _mm_round_ps(VecMul(angles, F_2_PI_1111), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+		// k - 4 floor(k / 4) is exact and in [0, 4); non-finite k gives NaN, which converts to 0x80000000 (quadrant 0)
+		SseVec kMod4 = VecSub(k, VecMul(FOUR_1111, _mm_floor_ps(VecMul(k, QUARTER_1111))));
+		quadrants = _mm_and_si128(_mm_cvtps_epi32(kMod4), _mm_set1_epi32(3));
+
+		reduced = VecSub(angles, VecMul(k, F_PI_2_HI_1111));
+		reduced = VecSub(reduced, VecMul(k, F_PI_2_MID_1111));
+		reduced = VecSub(reduced, VecMul(k, F_PI_2_LO_1111));
+
+		return reduced;
+	}
+
+	/*!
+	 * \brief	Calculates a fast approximation of the cosine of the various angles in the given
+	 * 			column vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective calculated cosine approximations from the
+	 * 			angles in the original column vector.
+	 *
+	 * \remarks	Approximates the cosine of the given angles within an error of about 0.001.
+	 */
+	SSE_VEC_CALL FastCosSseVec(const SseVec& angles)
+	{
+		static constexpr SseVecConst F_9_40_1111 = SseVecConstSplat(0.225f);
+		SseVec tmp0, tmp1;
+		tmp0 = VecAdd(angles, F_PI_2_1111);
+		tmp0 = NormalizeAngles(tmp0);
+
+		tmp1 = Vec4Abs(tmp0);
+		tmp1 = VecMul(tmp1, tmp0);
+		tmp0 = VecMul(tmp0, F_4_PI_1111);
+		tmp1 = VecMul(tmp1, F_NEG4_PI2_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		tmp1 = Vec4Abs(tmp0);
+		tmp1 = VecMul(tmp1, tmp0);
+		tmp1 = VecSub(tmp1, tmp0);
+		tmp1 = VecMul(tmp1, F_9_40_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		return tmp0;
+	}
+
+	/*!
+	 * \brief	Calculates a fast approximation of the sine of the various angles in the given column
+	 * 			vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective calculated sine approximations from the
+	 * 			angles in the original column vector.
+	 *
+	 * \remarks	Approximates the sine of the given angles within an error of about 0.001.
+	 */
+	SSE_VEC_CALL FastSinSseVec(const SseVec& angles)
+	{
+		static constexpr SseVecConst F_9_40_1111 = SseVecConstSplat(0.225f);
+
+		SseVec tmp0, tmp1, norm;
+		norm = NormalizeAngles(angles);
+		tmp1 = Vec4Abs(norm);
+		tmp1 = VecMul(tmp1, norm);
+		tmp0 = VecMul(norm, F_4_PI_1111);
+		tmp1 = VecMul(tmp1, F_NEG4_PI2_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		tmp1 = Vec4Abs(tmp0);
+		tmp1 = VecMul(tmp1, tmp0);
+		tmp1 = VecSub(tmp1, tmp0);
+		tmp1 = VecMul(tmp1, F_9_40_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		return tmp0;
+	}
+
+	/*!
+	 * \brief	Calculates a rougher (but generally much faster) approximation of the sine and/or
+	 * 			cosine of the various angles in the given column vector.
+	 *
+	 * \date	2/21/2015
+	 * 
+	 * \tparam	xFlag The x-coordinate index
+	 * \tparam	yFlag The y-coordinate index
+	 * \tparam	zFlag The z-coordinate index
+	 * \tparam	wFlag The w-coordinate index
+	 * 
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective calculated sine and/or cosine
+	 * 			approximations from the angles in the original column vector.
+	 *
+	 * \remarks	Approximates the sine of the given angles using a parabolic approximation.  Is
+	 * 			generally "accurate enough" and will more often than not run considerably faster than
+	 * 			the Taylor approximation.
+	 * 			
+	 * 			This function generally calculates within 0.001 radians of the standard sine and
+	 * 			cosine functions.
+	 */
+	template<SinCosFlag xFlag, SinCosFlag yFlag, SinCosFlag zFlag, SinCosFlag wFlag>
+	SSE_VEC_CALL FastSinCosSseVec(const SseVec& angles)
+	{
+		static constexpr SseVecConst F_9_40_1111 = SseVecConstSplat(0.225f);
+		SseVec tmp0, tmp1;
+		tmp0 = VecAdd(angles, F_PI_2_1111);
+		tmp0 = VecSinCosBlend<xFlag, yFlag, zFlag, wFlag>(angles, tmp0);
+		tmp0 = NormalizeAngles(tmp0);
+
+		tmp1 = Vec4Abs(tmp0);
+		tmp1 = VecMul(tmp1, tmp0);
+        tmp0 = VecMul(tmp0, F_4_PI_1111);
+        tmp1 = VecMul(tmp1, F_NEG4_PI2_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		tmp1 = Vec4Abs(tmp0);
+        tmp1 = VecMul(tmp1, tmp0);
+		tmp1 = VecSub(tmp1, tmp0);
+		tmp1 = VecMul(tmp1, F_9_40_1111);
+		tmp0 = VecAdd(tmp0, tmp1);
+
+		return tmp0;
+	}
+	
+	/*!
+	 * \brief	Calculates approximations of both the sine and the cosine of the various angles in
+	 * 			the given column vector, sharing a single range reduction.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \tparam	reduction		Type of the range reduction.
+	 * \param	angles		  	The angles in radians.
+	 * \param [out]	sines  	The respective sine approximations.
+	 * \param [out]	cosines	The respective cosine approximations.
+	 *
+	 * \remarks	Reduces the angles to %%[0,\\frac{\\pi}{4}]%% by reflection, evaluates the sine and cosine
+	 * 			minimax polynomials once each, and swaps them back into place per lane.  Both results
+	 * 			keep their relative accuracy near their roots, which is what TanSseVec and CotSseVec
+	 * 			rely on.
+	 * 			
+	 * 			With gofxmath::AngleReduction::CODY_WAITE the angles go through ReduceAnglesCodyWaite
+	 * 			instead, and each lane's quadrant picks the polynomial and the sign.  The quadrant
+	 * 			polynomials need one term fewer each, and the results stay accurate for large angles.
+	 *
+	 * \sa SinMinimaxCoef
+	 * \sa CosMinimaxCoef
+	 * \sa SinQuadrantMinimaxCoef
+	 * \sa CosQuadrantMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	inline void SinAndCosSseVec(const SseVec& angles, SseVec& sines, SseVec& cosines)
+	{
+		const SseVec SIGN_BITS_1111 = SetSseVec4(-0.0f);
+
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			const int SIN_QUADRANT_TERMS = SinQuadrantMinimaxTerms<precisionLevel>();
+			const int COS_QUADRANT_TERMS = CosQuadrantMinimaxTerms<precisionLevel>();
+
+			SseVec reduced, reducedSqr, swapMask, sinPoly, cosPoly;
+			__m128i quadrants;
+
+			reduced = ReduceAnglesCodyWaite(angles, quadrants);
+			reducedSqr = VecMul(reduced, reduced);
+
+			sinPoly = SetSseVec4(SinQuadrantMinimaxCoef<precisionLevel>(SIN_QUADRANT_TERMS - 1));
+			cosPoly = SetSseVec4(CosQuadrantMinimaxCoef<precisionLevel>(COS_QUADRANT_TERMS - 1));
+
+			for (int i = SIN_QUADRANT_TERMS - 1; i-- > 0;)
+			{
+				sinPoly = VecMul(sinPoly, reducedSqr);
+				sinPoly = VecAdd(sinPoly, SetSseVec4(SinQuadrantMinimaxCoef<precisionLevel>(i)));
+			}
+
+			for (int i = COS_QUADRANT_TERMS - 1; i-- > 0;)
+			{
+				cosPoly = VecMul(cosPoly, reducedSqr);
+				cosPoly = VecAdd(cosPoly, SetSseVec4(CosQuadrantMinimaxCoef<precisionLevel>(i)));
+			}
+
+			sinPoly = VecMul(sinPoly, reduced);
+
+			// Odd quadrants swap sine and cosine; quadrants 2,3 negate the sine and 1,2 the cosine
+			swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrants, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+
+			sines = _mm_blendv_ps(sinPoly, cosPoly, swapMask);
+			cosines = _mm_blendv_ps(cosPoly, sinPoly, swapMask);
+
+			sines = VecXOr(sines, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrants, _mm_set1_epi32(2)), 30)));
+			cosines = VecXOr(cosines, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrants, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30)));
+
+			return;
+		}
+
+		const int SIN_TERMS = SinMinimaxTerms<precisionLevel>();
+		const int COS_TERMS = CosMinimaxTerms<precisionLevel>();
+
+		SseVec norm, normSqr, signBits, flipMask, swapMask, sinPoly, cosPoly;
+
+		norm = NormalizeAngles(angles);
+		signBits = VecAnd(norm, SIGN_BITS_1111);
+		norm = VecXOr(norm, signBits);
+
+		// sin(x) = sin(PI - x), cos(x) = -cos(PI - x) for x in (PI/2, PI]
+		flipMask = _mm_cmpgt_ps(norm, F_PI_2_1111);
+		norm = _mm_min_ps(norm, VecSub(F_PI_1111, norm));
+
+		// sin(x) = cos(PI/2 - x) for x in (PI/4, PI/2], and vice versa
+		swapMask = _mm_cmpgt_ps(norm, F_PI_4_1111);
+		norm = _mm_min_ps(norm, VecSub(F_PI_2_1111, norm));
+
+		normSqr = VecMul(norm, norm);
+		sinPoly = SetSseVec4(SinMinimaxCoef<precisionLevel>(SIN_TERMS - 1));
+		cosPoly = SetSseVec4(CosMinimaxCoef<precisionLevel>(COS_TERMS - 1));
+
+		for (int i = SIN_TERMS - 1; i-- > 0;)
+		{
+			sinPoly = VecMul(sinPoly, normSqr);
+			sinPoly = VecAdd(sinPoly, SetSseVec4(SinMinimaxCoef<precisionLevel>(i)));
+		}
+
+		for (int i = COS_TERMS - 1; i-- > 0;)
+		{
+			cosPoly = VecMul(cosPoly, normSqr);
+			cosPoly = VecAdd(cosPoly, SetSseVec4(CosMinimaxCoef<precisionLevel>(i)));
+		}
+
+		sinPoly = VecMul(sinPoly, norm);
+
+		sines = _mm_blendv_ps(sinPoly, cosPoly, swapMask);
+		cosines = _mm_blendv_ps(cosPoly, sinPoly, swapMask);
+
+		sines = VecXOr(sines, signBits);
+		cosines = VecXOr(cosines, VecAnd(flipMask, SIGN_BITS_1111));
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the cosine of the various angles in the given column
+	 * 			vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \tparam	reduction		Type of the range reduction.
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective calculated cosine approximations from the
+	 * 			angles in the original column vector.
+	 *
+	 * \remarks	Reduces the angles to %%[0,\\frac{\\pi}{2}]%% with %%\\cos(x) = -\\cos(\\pi - |x|)%%,
+	 * 			then evaluates the minimax polynomial for the given precision level.  Agrees
+	 * 			with CosApprox to within the precision level.
+	 * 			
+	 * 			It is usually more accurate than FastCosSseVec, and at HIGH precision costs five
+	 * 			multiply-adds after the range reduction.
+	 *
+	 * \sa CosMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	SSE_VEC_CALL CosSseVec(const SseVec& angles)
+	{
+		SseVec tmp0, normSqr, norm, flipMask;
+
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			SinAndCosSseVec<precisionLevel, reduction>(angles, tmp0, norm);
+			return norm;
+		}
+
+		const int TERMS = CosMinimaxTerms<precisionLevel>();
+
+		norm = Vec4Abs(NormalizeAngles(angles));
+
+		// cos(x) = -cos(PI - x) for x in (PI/2, PI]
+		flipMask = _mm_cmpgt_ps(norm, F_PI_2_1111);
+		norm = _mm_blendv_ps(norm, VecSub(F_PI_1111, norm), flipMask);
+
+		normSqr = VecMul(norm, norm);
+		tmp0 = SetSseVec4(CosMinimaxCoef<precisionLevel>(TERMS - 1));
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			tmp0 = VecMul(tmp0, normSqr);
+			tmp0 = VecAdd(tmp0, SetSseVec4(CosMinimaxCoef<precisionLevel>(i)));
+		}
+
+		return VecXOr(tmp0, VecAnd(flipMask, SetSseVec4(-0.0f)));
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the sine of the various angles in the given column
+	 * 			vector.
+	 *
+	 * \date	2/21/2015
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \tparam	reduction		Type of the range reduction.
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective calculated sine approximations from the
+	 * 			angles in the original column vector.
+	 *
+	 * \remarks	Reduces the angles to %%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%% with
+	 * 			%%\\sin(x) = \\sin(\\pm\\pi - x)%%, then evaluates the minimax polynomial for the
+	 * 			given precision level.  Agrees with SinApprox to within the precision level.
+	 * 			
+	 * 			It is usually more accurate than FastSinSseVec, and at HIGH precision costs five
+	 * 			multiply-adds after the range reduction.
+	 *
+	 * \sa SinMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	SSE_VEC_CALL SinSseVec(const SseVec& angles)
+	{
+		SseVec tmp0, normSqr, norm, signBits;
+
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			SinAndCosSseVec<precisionLevel, reduction>(angles, tmp0, norm);
+			return tmp0;
+		}
+
+		const int TERMS = SinMinimaxTerms<precisionLevel>();
+		const SseVec SIGN_BITS_1111 = SetSseVec4(-0.0f);
+
+		norm = NormalizeAngles(angles);
+		signBits = VecAnd(norm, SIGN_BITS_1111);
+		norm = VecXOr(norm, signBits);
+
+		// sin(x) = sin(PI - x) for x in (PI/2, PI], with the sign restored afterwards
+		norm = _mm_min_ps(norm, VecSub(F_PI_1111, norm));
+
+		normSqr = VecMul(norm, norm);
+		tmp0 = SetSseVec4(SinMinimaxCoef<precisionLevel>(TERMS - 1));
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			tmp0 = VecMul(tmp0, normSqr);
+			tmp0 = VecAdd(tmp0, SetSseVec4(SinMinimaxCoef<precisionLevel>(i)));
+		}
+
+		tmp0 = VecMul(tmp0, norm);
+
+		return VecXOr(tmp0, signBits);
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the sine and/or cosine of the various angles in the
+	 * 			given column vector.
+	 *
+	 * \date	2/21/2015
+	 * 
+	 * \tparam	xFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
+	 *							for the x-coordinate of the given SseVec containing the angles.
+	 * 
+	 * \tparam	yFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
+	 *							for the y-coordinate of the given SseVec containing the angles.
+	 * 
+	 * \tparam	zFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
+	 *							for the z-coordinate of the given SseVec containing the angles.
+	 * 
+	 * \tparam	wFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
+	 *							for the w-coordinate of the given SseVec containing the angles.
+	 * 
+	 * \tparam	precisionLevel	Level of precision to use in the approximation.
+	 * \tparam	reduction		Type of the range reduction.
+	 * 
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective calculated sine and/or cosine
+	 * 			approximations from the angles in the original column vector.
+	 *
+	 * \remarks	Shifts the sine lanes by %%-\\frac{\\pi}{2}%% and evaluates all four lanes with
+	 * 			CosSseVec, so the cost is that of a single CosSseVec call.
+	 */
+    template<SinCosFlag xFlag, SinCosFlag yFlag, SinCosFlag zFlag, SinCosFlag wFlag, FloatPrecision precisionLevel = FloatPrecision::HIGH, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	SSE_VEC_CALL SinCosSseVec(const SseVec& angles)
+	{
+		SseVec tmp0;
+
+		if (reduction == AngleReduction::CODY_WAITE)
+		{
+			SseVec cosines;
+
+			SinAndCosSseVec<precisionLevel, reduction>(angles, tmp0, cosines);
+			return VecSinCosBlend<xFlag, yFlag, zFlag, wFlag>(tmp0, cosines);
+		}
+
+		tmp0 = VecSub(angles, F_PI_2_1111);
+
+		tmp0 = VecSinCosBlend<xFlag, yFlag, zFlag, wFlag>(tmp0, angles);
+		return CosSseVec<precisionLevel>(tmp0);
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the tangent of the various angles in the given column
+	 * 			vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	 	Type of the precision level.
+	 * \tparam	divisionPolicy	How the division is calculated (see VecDiv).  A refined reciprocal adds
+	 * 							up to about %%2^{-22}%% of relative error.
+	 * \tparam	reduction		Type of the range reduction.
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective tangent approximations.  Lanes at the poles
+	 * 			come out as large values or %%\\pm\\infty%%.
+	 *
+	 * \remarks	Divides the sine by the cosine from a single SinAndCosSseVec evaluation.
+	 * 			Measured over %%[-1.5,1.5]%% in single precision with a full division, the maximum
+	 * 			relative error is %%7.9*10^{-7}%% at gofxmath::FloatPrecision::HIGH and %%7.5*10^{-6}%% at
+	 * 			gofxmath::FloatPrecision::MEDIUM_HIGH.  Closer to the poles the error is dominated by
+	 * 			the rounding of %%\\frac{\\pi}{2}%% in single precision.
+	 *
+	 * \sa SinAndCosSseVec
+	 * \sa TanApprox
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, PrecisionPolicy divisionPolicy = PrecisionPolicy::EXACT, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	SSE_VEC_CALL TanSseVec(const SseVec& angles)
+	{
+		SseVec sines, cosines;
+
+		SinAndCosSseVec<precisionLevel, reduction>(angles, sines, cosines);
+
+		return VecDiv<divisionPolicy>(sines, cosines);
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the cotangent of the various angles in the given column
+	 * 			vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	 	Type of the precision level.
+	 * \tparam	divisionPolicy	How the division is calculated (see VecDiv).  A refined reciprocal adds
+	 * 							up to about %%2^{-22}%% of relative error.
+	 * \tparam	reduction		Type of the range reduction.
+	 * \param	angles	The angles in radians.
+	 *
+	 * \return	A column vector containing the respective cotangent approximations.  Lanes at the poles
+	 * 			come out as large values or %%\\pm\\infty%%.
+	 *
+	 * \remarks	Divides the cosine by the sine from a single SinAndCosSseVec evaluation, with the same
+	 * 			error bounds as TanSseVec.
+	 *
+	 * \sa SinAndCosSseVec
+	 * \sa CotApprox
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, PrecisionPolicy divisionPolicy = PrecisionPolicy::EXACT, AngleReduction reduction = AngleReduction::SINGLE_STEP>
+	SSE_VEC_CALL CotSseVec(const SseVec& angles)
+	{
+		SseVec sines, cosines;
+
+		SinAndCosSseVec<precisionLevel, reduction>(angles, sines, cosines);
+
+		return VecDiv<divisionPolicy>(cosines, sines);
+	}
+
+	/*!
+	 * \brief	Calculates the tangent approximation of every angle in the given array.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	 	Type of the precision level.
+	 * \tparam	divisionPolicy		How the division is calculated.
+	 * \param	angles 	The angles in radians.
+	 * \param	results	The array receiving the results.  May alias angles.
+	 * \param	count  	The number of angles.
+	 *
+	 * \remarks	Processes four angles at a time with TanSseVec, using unaligned loads and stores.
+	 * 			The remaining angles are padded out to a full SseVec.
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, PrecisionPolicy divisionPolicy = PrecisionPolicy::EXACT>
+	inline void TanBatch(const float* angles, float* results, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, TanSseVec<precisionLevel, divisionPolicy>(_mm_loadu_ps(angles + i)));
+		}
+
+		if (i < count)
+		{
+			float tail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			std::copy(angles + i, angles + count, tail);
+
+			_mm_storeu_ps(tail, TanSseVec<precisionLevel, divisionPolicy>(_mm_loadu_ps(tail)));
+			std::copy(tail, tail + (count - i), results + i);
+		}
+	}
+
+	/*!
+	 * \brief	Calculates the cotangent approximation of every angle in the given array.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	 	Type of the precision level.
+	 * \tparam	divisionPolicy		How the division is calculated.
+	 * \param	angles 	The angles in radians.
+	 * \param	results	The array receiving the results.  May alias angles.
+	 * \param	count  	The number of angles.
+	 *
+	 * \remarks	Processes four angles at a time with CotSseVec, using unaligned loads and stores.
+	 * 			The remaining angles are padded out to a full SseVec.
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH, PrecisionPolicy divisionPolicy = PrecisionPolicy::EXACT>
+	inline void CotBatch(const float* angles, float* results, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, CotSseVec<precisionLevel, divisionPolicy>(_mm_loadu_ps(angles + i)));
+		}
+
+		if (i < count)
+		{
+			float tail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			std::copy(angles + i, angles + count, tail);
+
+			_mm_storeu_ps(tail, CotSseVec<precisionLevel, divisionPolicy>(_mm_loadu_ps(tail)));
+			std::copy(tail, tail + (count - i), results + i);
+		}
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the arctangent of the various values in the given
+	 * 			column vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values	The values.
+	 *
+	 * \return	A column vector containing the respective arctangent approximations, in the range
+	 * 			%%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%.  NaN lanes are passed through.
+	 *
+	 * \remarks	Uses the same reduction and minimax polynomial as AtanApprox, with the three
+	 * 			reduction branches selected by blending, so it agrees with AtanApprox to within HIGH
+	 * 			precision (the two may round differently where the compiler contracts the polynomial
+	 * 			into FMAs).
+	 *
+	 * \sa AtanMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL AtanSseVec(const SseVec& values)
+	{
+		static constexpr SseVecMaskConst SIGN_MASK_1111 = { { 0x80000000, 0x80000000, 0x80000000, 0x80000000 } };
+		static constexpr SseVecConst NEG_ONE_1111 = SseVecConstSplat(-1.0f);
+
+		SseVec tmp0, absVals, signBits, midMask, bigMask;
+		SseVec numerator, denominator, offset, reducedSqr;
+
+		const int TERMS = AtanMinimaxTerms<precisionLevel>();
+
+		signBits = VecAnd(values, SIGN_MASK_1111);
+		absVals = VecXOr(values, signBits);
+
+		midMask = _mm_cmpgt_ps(absVals, F_TAN_PI_8_1111);
+		bigMask = _mm_cmpgt_ps(absVals, F_TAN_3PI_8_1111);
+
+		// x, (x - 1) / (x + 1), or -1 / x
+		numerator = _mm_blendv_ps(absVals, VecSub(absVals, SSE_VEC_ONE), midMask);
+		numerator = _mm_blendv_ps(numerator, NEG_ONE_1111, bigMask);
+		denominator = _mm_blendv_ps(SSE_VEC_ONE, VecAdd(absVals, SSE_VEC_ONE), midMask);
+		denominator = _mm_blendv_ps(denominator, absVals, bigMask);
+
+		offset = VecAnd(midMask, F_PI_4_1111);
+		offset = _mm_blendv_ps(offset, F_PI_2_1111, bigMask);
+
+		numerator = VecDiv(numerator, denominator);
+		reducedSqr = VecMul(numerator, numerator);
+		tmp0 = SetSseVec4(AtanMinimaxCoef<precisionLevel>(TERMS - 1));
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			tmp0 = VecMul(tmp0, reducedSqr);
+			tmp0 = VecAdd(tmp0, SetSseVec4(AtanMinimaxCoef<precisionLevel>(i)));
+		}
+
+		tmp0 = VecMul(tmp0, numerator);
+		tmp0 = VecAdd(offset, tmp0);
+
+		return VecOr(tmp0, signBits);
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the two-argument arctangent of the respective
+	 * 			components of the given column vectors.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	y	The y-coordinates of the points.
+	 * \param	x	The x-coordinates of the points.
+	 *
+	 * \return	A column vector containing the respective angles between the positive x-axis and
+	 * 			the points, in the range %%[-\\pi,\\pi]%%.
+	 *
+	 * \remarks	Follows the quadrant conventions of std::atan2, including signed zeros and infinite
+	 * 			arguments.  Lanes where either argument is NaN are NaN.  Agrees with Atan2Approx to
+	 * 			within HIGH precision.
+	 *
+	 * \sa AtanSseVec
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL Atan2SseVec(const SseVec& y, const SseVec& x)
+	{
+		static constexpr SseVecMaskConst SIGN_MASK_1111 = { { 0x80000000, 0x80000000, 0x80000000, 0x80000000 } };
+
+		SseVec tmp0, absX, absY, ratio;
+
+		absX = Vec4Abs(x);
+		absY = Vec4Abs(y);
+
+		// Keeps 0/0 and inf/inf out of the ratio
+		ratio = VecDiv(absY, absX);
+		ratio = _mm_blendv_ps(ratio, SSE_VEC_ONE, _mm_cmpeq_ps(absY, absX));
+		ratio = _mm_andnot_ps(_mm_cmpeq_ps(absY, _mm_setzero_ps()), ratio);
+
+		tmp0 = AtanSseVec<precisionLevel>(ratio);
+
+		// Mirrors into the left half-plane when the sign bit of x is set
+		tmp0 = _mm_blendv_ps(tmp0, VecSub(F_PI_1111, tmp0), x);
+		tmp0 = VecOr(tmp0, VecAnd(y, SIGN_MASK_1111));
+
+		return VecOr(tmp0, _mm_cmpunord_ps(x, y));
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the arcsine of the various values in the given
+	 * 			column vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values	The values.
+	 *
+	 * \return	A column vector containing the respective arcsine approximations, in the range
+	 * 			%%[-\\frac{\\pi}{2},\\frac{\\pi}{2}]%%.  Lanes outside of %%[-1,1]%% are NaN.
+	 *
+	 * \remarks	Evaluated as %%\\arctan2(x, \\sqrt{(1 - x)(1 + x)})%%.  Agrees with AsinApprox to
+	 *			within HIGH precision.
+	 *
+	 * \sa Atan2SseVec
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL AsinSseVec(const SseVec& values)
+	{
+		SseVec tmp0;
+
+		tmp0 = VecMul(VecSub(SSE_VEC_ONE, values), VecAdd(SSE_VEC_ONE, values));
+		tmp0 = VecSqrt(tmp0);
+
+		return Atan2SseVec<precisionLevel>(values, tmp0);
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of the arccosine of the various values in the given
+	 * 			column vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values	The values.
+	 *
+	 * \return	A column vector containing the respective arccosine approximations, in the range
+	 * 			%%[0,\\pi]%%.  Lanes outside of %%[-1,1]%% are NaN.
+	 *
+	 * \remarks	Evaluated as %%\\arctan2(\\sqrt{(1 - x)(1 + x)}, x)%%.  Agrees with AcosApprox to
+	 *			within HIGH precision.
+	 *
+	 * \sa Atan2SseVec
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL AcosSseVec(const SseVec& values)
+	{
+		SseVec tmp0;
+
+		tmp0 = VecMul(VecSub(SSE_VEC_ONE, values), VecAdd(SSE_VEC_ONE, values));
+		tmp0 = VecSqrt(tmp0);
+
+		return Atan2SseVec<precisionLevel>(tmp0, values);
+	}
+
+	/*!
+	 * \brief	Calculates the arctangent approximation of every value in the given array.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values 	The values.
+	 * \param	results	The array receiving the results.  May alias values.
+	 * \param	count  	The number of values.
+	 *
+	 * \remarks	Processes four values at a time with AtanSseVec, using unaligned loads and stores.
+	 * 			The remaining values are handled by AtanApprox, which agrees to within HIGH precision.
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline void AtanBatch(const float* values, float* results, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, AtanSseVec<precisionLevel>(_mm_loadu_ps(values + i)));
+		}
+
+		for (; i < count; ++i)
+		{
+			results[i] = AtanApprox<precisionLevel>(values[i]);
+		}
+	}
+
+	/*!
+	 * \brief	Calculates the two-argument arctangent approximation of every pair of values in
+	 * 			the given arrays.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	ys     	The y-coordinates of the points.
+	 * \param	xs     	The x-coordinates of the points.
+	 * \param	results	The array receiving the results.  May alias either input.
+	 * \param	count  	The number of points.
+	 *
+	 * \remarks	Processes four points at a time with Atan2SseVec, using unaligned loads and stores.
+	 * 			The remaining points are handled by Atan2Approx, which agrees to within HIGH precision.
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline void Atan2Batch(const float* ys, const float* xs, float* results, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, Atan2SseVec<precisionLevel>(_mm_loadu_ps(ys + i), _mm_loadu_ps(xs + i)));
+		}
+
+		for (; i < count; ++i)
+		{
+			results[i] = Atan2Approx<precisionLevel>(ys[i], xs[i]);
+		}
+	}
+
+	/*!
+	 * \brief	Calculates the arcsine approximation of every value in the given array.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values 	The values.
+	 * \param	results	The array receiving the results.  May alias values.
+	 * \param	count  	The number of values.
+	 *
+	 * \remarks	Processes four values at a time with AsinSseVec, using unaligned loads and stores.
+	 * 			The remaining values are handled by AsinApprox, which agrees to within HIGH precision.
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline void AsinBatch(const float* values, float* results, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, AsinSseVec<precisionLevel>(_mm_loadu_ps(values + i)));
+		}
+
+		for (; i < count; ++i)
+		{
+			results[i] = AsinApprox<precisionLevel>(values[i]);
+		}
+	}
+
+	/*!
+	 * \brief	Calculates the arccosine approximation of every value in the given array.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values 	The values.
+	 * \param	results	The array receiving the results.  May alias values.
+	 * \param	count  	The number of values.
+	 *
+	 * \remarks	Processes four values at a time with AcosSseVec, using unaligned loads and stores.
+	 * 			The remaining values are handled by AcosApprox, which agrees to within HIGH precision.
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline void AcosBatch(const float* values, float* results, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, AcosSseVec<precisionLevel>(_mm_loadu_ps(values + i)));
+		}
+
+		for (; i < count; ++i)
+		{
+			results[i] = AcosApprox<precisionLevel>(values[i]);
+		}
+	}
+
+	/*!
+	 * \brief	Multiplies the components of the given SseVec by two raised to the respective
+	 * 			components of the given exponents.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec		 	The SseVec to scale.
+	 * \param	exponents	The whole-numbered exponents, in the range %%[-252,254]%%.
+	 *
+	 * \return	The scaled SseVec, overflowing to %%\\pm\\infty%% and underflowing gradually to zero.
+	 *
+	 * \remarks	Builds the powers of two directly in the exponent bits.  The scale is split into
+	 * 			two normal factors, so results near the ends of the float range are rounded
+	 * 			by the multiply rather than wrapping the exponent.
+	 */
+	SSE_VEC_CALL VecMulPow2(const SseVec& vec, const SseVec& exponents)
+	{
+		const __m128i EXPONENT_BIAS = _mm_set1_epi32(127);
+
+		__m128i n0, n1;
+
+		n0 = _mm_cvtps_epi32(exponents);
+		n1 = _mm_srai_epi32(n0, 1);
+		n0 = _mm_sub_epi32(n0, n1);
+
+		n0 = _mm_slli_epi32(_mm_add_epi32(n0, EXPONENT_BIAS), 23);
+		n1 = _mm_slli_epi32(_mm_add_epi32(n1, EXPONENT_BIAS), 23);
+
+		return VecMul(VecMul(vec, _mm_castsi128_ps(n0)), _mm_castsi128_ps(n1));
+	}
+
+	/*!
+	 * \brief	Evaluates %%e^r 2^n%% for the given reduced arguments and whole-numbered exponents.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	reduced  	The reduced arguments, in %%[-\\frac{\\ln(2)}{2},\\frac{\\ln(2)}{2}]%%.
+	 * \param	exponents	The whole-numbered exponents.
+	 *
+	 * \return	The approximation of %%e^r 2^n%%.
+	 *
+	 * \sa ExpMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL ExpReducedSseVec(const SseVec& reduced, const SseVec& exponents)
+	{
+		SseVec tmp0;
+
+		const int TERMS = ExpMinimaxTerms<precisionLevel>();
+
+		tmp0 = SetSseVec4(ExpMinimaxCoef<precisionLevel>(TERMS - 1));
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			tmp0 = VecMul(tmp0, reduced);
+			tmp0 = VecAdd(tmp0, SetSseVec4(ExpMinimaxCoef<precisionLevel>(i)));
+		}
+
+		return VecMulPow2(tmp0, exponents);
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of two raised to the various values in the given column
+	 * 			vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values	The exponents.
+	 *
+	 * \return	A column vector containing the respective approximations of %%2^x%%.  Overflows to
+	 * 			%%\\infty%%, underflows to zero, and passes NaN lanes through.
+	 *
+	 * \remarks	Splits %%x = n + f%% with %%n%% the nearest whole number, evaluates %%2^f = e^{f\\ln(2)}%%
+	 * 			with the exponential minimax polynomial, and applies %%2^n%% through the exponent bits.
+	 *
+	 * \sa ExpMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL Exp2SseVec(const SseVec& values)
+	{
+		const SseVec MIN_EXPONENT_1111 = SetSseVec4(-151.0f);
+		const SseVec MAX_EXPONENT_1111 = SetSseVec4(129.0f);
+		const SseVec LN2_1111 = SetSseVec4(F_LN2);
+
+		SseVec tmp0, whole;
+
+		tmp0 = _mm_min_ps(_mm_max_ps(values, MIN_EXPONENT_1111), MAX_EXPONENT_1111);
+		whole = VecRound(tmp0);
+		tmp0 = VecMul(VecSub(tmp0, whole), LN2_1111);
+
+		tmp0 = ExpReducedSseVec<precisionLevel>(tmp0, whole);
+
+		return VecOr(tmp0, _mm_cmpunord_ps(values, values));
+	}
+
+	/*!
+	 * \brief	Calculates an approximation of %%e%% raised to the various values in the given column
+	 * 			vector.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values	The exponents.
+	 *
+	 * \return	A column vector containing the respective approximations of %%e^x%%.  Overflows to
+	 * 			%%\\infty%%, underflows to zero, and passes NaN lanes through.
+	 *
+	 * \remarks	Splits %%x = n\\ln(2) + r%% with a two-part (Cody-Waite) %%\\ln(2)%% so that %%r%% is
+	 * 			exact, evaluates %%e^r%% with the exponential minimax polynomial, and applies %%2^n%%
+	 * 			through the exponent bits.
+	 *
+	 * \sa ExpMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL ExpSseVec(const SseVec& values)
+	{
+		const SseVec MIN_ARG_1111 = SetSseVec4(-151.0f * F_LN2);
+		const SseVec MAX_ARG_1111 = SetSseVec4(129.0f * F_LN2);
+		const SseVec LOG2E_1111 = SetSseVec4(F_LOG2E);
+		const SseVec LN2_HI_1111 = SetSseVec4(F_LN2_HI);
+		const SseVec LN2_LO_1111 = SetSseVec4(F_LN2_LO);
+
+		SseVec tmp0, whole;
+
+		tmp0 = _mm_min_ps(_mm_max_ps(values, MIN_ARG_1111), MAX_ARG_1111);
+		whole = VecRound(VecMul(tmp0, LOG2E_1111));
+		tmp0 = VecSub(tmp0, VecMul(whole, LN2_HI_1111));
+		tmp0 = VecSub(tmp0, VecMul(whole, LN2_LO_1111));
+
+		tmp0 = ExpReducedSseVec<precisionLevel>(tmp0, whole);
+
+		return VecOr(tmp0, _mm_cmpunord_ps(values, values));
+	}
+
+	/*!
+	 * \brief	Splits the given positive values into %%2^e m%% and approximates %%\\ln(m)%%.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values			The values to split.  Denormal values are handled.
+	 * \param [out]	exponents	The whole-numbered exponents %%e%%.
+	 *
+	 * \return	The approximation of %%\\ln(m)%%, with %%m%% in %%[\\frac{\\sqrt{2}}{2},\\sqrt{2})%%.
+	 *
+	 * \remarks	Zero, negative, infinite and NaN values are left to LogSpecialCases.
+	 *
+	 * \sa LogMinimaxCoef
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL LogMantissaSseVec(const SseVec& values, SseVec& exponents)
+	{
+		const SseVec FLOAT_MIN_1111 = SetSseVec4(1.17549435e-38f);
+		const SseVec DENORMAL_SCALE_1111 = SetSseVec4(8388608.0f);
+		const SseVec DENORMAL_EXPONENT_1111 = SetSseVec4(23.0f);
+		const SseVec MANTISSA_MASK_1111 = Set1SseVecMask(0x007FFFFF);
+		const SseVec SQRT2_1111 = SetSseVec4(F_SQRT2);
+		const SseVec HALF_1111 = SetSseVec4(0.5f);
+		const __m128i EXPONENT_BIAS = _mm_set1_epi32(127);
+
+		SseVec tmp0, mantissa, denormalMask, bigMask, sVal, sSqr;
+
+		const int TERMS = LogMinimaxTerms<precisionLevel>();
+
+		// Denormals are scaled by 2^23 into the normal range first
+		denormalMask = _mm_cmplt_ps(values, FLOAT_MIN_1111);
+		tmp0 = _mm_blendv_ps(values, VecMul(values, DENORMAL_SCALE_1111), denormalMask);
+
+		exponents = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(tmp0), 23), EXPONENT_BIAS));
+		exponents = VecSub(exponents, VecAnd(denormalMask, DENORMAL_EXPONENT_1111));
+
+		// m in [1, 2), then folded to [sqrt(2)/2, sqrt(2))
+		mantissa = VecOr(VecAnd(tmp0, MANTISSA_MASK_1111), SSE_VEC_ONE);
+		bigMask = _mm_cmpgt_ps(mantissa, SQRT2_1111);
+		mantissa = _mm_blendv_ps(mantissa, VecMul(mantissa, HALF_1111), bigMask);
+		exponents = VecAdd(exponents, VecAnd(bigMask, SSE_VEC_ONE));
+
+		sVal = VecDiv(VecSub(mantissa, SSE_VEC_ONE), VecAdd(mantissa, SSE_VEC_ONE));
+		sSqr = VecMul(sVal, sVal);
+		tmp0 = SetSseVec4(LogMinimaxCoef<precisionLevel>(TERMS - 1));
+
+		for (int i = TERMS - 1; i-- > 0;)
+		{
+			tmp0 = VecMul(tmp0, sSqr);
+			tmp0 = VecAdd(tmp0, SetSseVec4(LogMinimaxCoef<precisionLevel>(i)));
+		}
+
+		sVal = VecAdd(sVal, sVal);
+
+		return VecMul(tmp0, sVal);
+	}
+
+	/*!
+	 * \brief	Replaces the lanes of a logarithm result whose arguments were zero, negative,
+	 * 			infinite, or NaN.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	values	The original arguments of the logarithm.
+	 * \param	result	The logarithm result computed for the positive finite lanes.
+	 *
+	 * \return	The result with %%-\\infty%% for zeros, %%\\infty%% for %%\\infty%%, and NaN for negative
+	 * 			or NaN arguments.
+	 */
+	SSE_VEC_CALL LogSpecialCases(const SseVec& values, const SseVec& result)
+	{
+		const SseVec INF_1111 = SetSseVec4(Infinity());
+		const SseVec NEG_INF_1111 = SetSseVec4(-Infinity());
+
+		SseVec tmp0;
+
+		tmp0 = _mm_blendv_ps(result, NEG_INF_1111, _mm_cmpeq_ps(values, _mm_setzero_ps()));
+		tmp0 = _mm_blendv_ps(tmp0, INF_1111, _mm_cmpeq_ps(values, INF_1111));
+
+		return VecOr(tmp0, _mm_cmpnge_ps(values, _mm_setzero_ps()));
 	}
 
 	/*!
-	 * \brief	Calculates the cross product of the two given 3D vectors.
+	 * \brief	Calculates an approximation of the base-2 logarithm of the various values in the
+	 * 			given column vector.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	v0	The first 3D vector in the cross product.
-	 * \param	v1	The second 3D vector in the cross product.
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values	The values.
 	 *
-	 * \return	The cross product of the two given 3D vectors.
+	 * \return	A column vector containing the respective approximations of %%\\log_2(x)%%.
+	 *
+	 * \remarks	Reads the exponent straight from the float bits and approximates the logarithm of the
+	 * 			mantissa with the logarithm minimax polynomial.  Follows std::log2 for zero, negative,
+	 * 			infinite and NaN arguments.
+	 *
+	 * \sa LogMinimaxCoef
 	 */
-	SSE_VEC_CALL Vec3Cross(const SseVec& v0, const SseVec& v1)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL Log2SseVec(const SseVec& values)
 	{
-		SseVec tmp0, tmp1, tmp2, tmp3;
-		SseVec result;
-
-		tmp0 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::NA>(v0);
-		tmp1 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::NA>(v1);
-		tmp2 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::NA>(v0);
-		tmp3 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::NA>(v1);
+		const SseVec LOG2E_1111 = SetSseVec4(F_LOG2E);
 
-		tmp0 = VecMul(tmp0, tmp1);
-		tmp2 = VecMul(tmp2, tmp3);
+		SseVec tmp0, exponents;
 
-		result = VecSub(tmp0, tmp2);
-		result = VecOr(result, UNIT_0001);
+		tmp0 = LogMantissaSseVec<precisionLevel>(values, exponents);
+		tmp0 = VecAdd(VecMul(tmp0, LOG2E_1111), exponents);
 
-		return result;
+		return LogSpecialCases(values, tmp0);
 	}
 
 	/*!
-	 * \brief	Normalizes the given angles (assumed radians) to (-PI,PI).
+	 * \brief	Calculates an approximation of the natural logarithm of the various values in the
+	 * 			given column vector.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	angles	The angles (assumed radians).
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values	The values.
 	 *
-	 * \return	A SSE_VEC_CALL.
+	 * \return	A column vector containing the respective approximations of %%\\ln(x)%%.
+	 *
+	 * \remarks	Reads the exponent straight from the float bits, approximates the logarithm of the
+	 * 			mantissa with the logarithm minimax polynomial, and adds back %%e\\ln(2)%% in two
+	 * 			parts.  Follows std::log for zero, negative, infinite and NaN arguments.
+	 *
+	 * \sa LogMinimaxCoef
 	 */
-	SSE_VEC_CALL NormalizeAngles(const SseVec& angles)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL LogSseVec(const SseVec& values)
 	{
-		SseVec tmp0, tmp1;
+		const SseVec LN2_HI_1111 = SetSseVec4(F_LN2_HI);
+		const SseVec LN2_LO_1111 = SetSseVec4(F_LN2_LO);
 
-		tmp0 = VecAdd(angles, F_PI_1111);
-		tmp0 = VecMul(tmp0, F_1_2PI_1111);
-		tmp1 = _mm_floor_ps(tmp0);
-		tmp0 = VecMul(F_2PI_1111, tmp1);
-		tmp0 = VecSub(angles, tmp0);
+		SseVec tmp0, exponents;
 
-		return tmp0;
+		tmp0 = LogMantissaSseVec<precisionLevel>(values, exponents);
+		tmp0 = VecAdd(tmp0, VecMul(exponents, LN2_LO_1111));
+		tmp0 = VecAdd(tmp0, VecMul(exponents, LN2_HI_1111));
+
+		return LogSpecialCases(values, tmp0);
 	}
 
 	/*!
-	 * \brief	Calculates a fast approximation of the cosine of the various angles in the given
-	 * 			column vector.
+	 * \brief	Calculates an approximation of the respective components of the given bases raised
+	 * 			to the given exponents.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
-	 * \param	angles	The angles in radians.
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	bases	 	The bases.  Must not be negative.
+	 * \param	exponents	The exponents.
 	 *
-	 * \return	A column vector containing the respective calculated cosine approximations from the
-	 * 			angles in the original column vector.
+	 * \return	A column vector containing the respective approximations of %%x^y%%.
 	 *
-	 * \remarks	Approximates the cosine of the given angles within an error of about 0.001.
+	 * \remarks	Evaluated as %%2^{y\\log_2(x)}%%, so the relative error grows with %%|y\\log_2(x)|%%.
+	 * 			A zero exponent or a base of one gives exactly one, as with std::pow.  Unlike std::pow,
+	 * 			negative bases give NaN even for whole-numbered exponents.
+	 *
+	 * \sa Exp2SseVec
+	 * \sa Log2SseVec
 	 */
-	SSE_VEC_CALL FastCosSseVec(const SseVec& angles)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	SSE_VEC_CALL PowSseVec(const SseVec& bases, const SseVec& exponents)
 	{
-		static const SseVec F_9_40_1111 = SetSseVec4(0.225f);
-		SseVec tmp0, tmp1;
-		tmp0 = VecAdd(angles, F_PI_2_1111);
-		tmp0 = NormalizeAngles(tmp0);
+		SseVec tmp0, oneMask;
 
-		tmp1 = Vec4Abs(tmp0);
-		tmp1 = VecMul(tmp1, tmp0);
-		tmp0 = VecMul(tmp0, F_4_PI_1111);
-		tmp1 = VecMul(tmp1, F_NEG4_PI2_1111);
-		tmp0 = VecAdd(tmp0, tmp1);
+		tmp0 = Log2SseVec<precisionLevel>(bases);
+		tmp0 = Exp2SseVec<precisionLevel>(VecMul(exponents, tmp0));
 
-		tmp1 = Vec4Abs(tmp0);
-		tmp1 = VecMul(tmp1, tmp0);
-		tmp1 = VecSub(tmp1, tmp0);
-		tmp1 = VecMul(tmp1, F_9_40_1111);
-		tmp0 = VecAdd(tmp0, tmp1);
+		oneMask = VecOr(_mm_cmpeq_ps(exponents, _mm_setzero_ps()), _mm_cmpeq_ps(bases, SSE_VEC_ONE));
 
-		return tmp0;
+		return _mm_blendv_ps(tmp0, SSE_VEC_ONE, oneMask);
 	}
 
 	/*!
-	 * \brief	Calculates a fast approximation of the sine of the various angles in the given column
-	 * 			vector.
+	 * \brief	Calculates the base-2 exponential approximation of every value in the given array.
 	 *
-	 * \date	2/21/2015
-	 *
-	 * \param	angles	The angles in radians.
+	 * \date	10/18/2026
 	 *
-	 * \return	A column vector containing the respective calculated sine approximations from the
-	 * 			angles in the original column vector.
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values 	The values.
+	 * \param	results	The array receiving the results.  May alias values.
+	 * \param	count  	The number of values.
 	 *
-	 * \remarks	Approximates the sine of the given angles within an error of about 0.001.
+	 * \remarks	Processes four values at a time with Exp2SseVec, using unaligned loads and stores.
+	 * 			The remaining values are padded out to a full SseVec.
 	 */
-	SSE_VEC_CALL FastSinSseVec(const SseVec& angles)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline void Exp2Batch(const float* values, float* results, size_t count)
 	{
-		static const SseVec F_9_40_1111 = SetSseVec4(0.225f);
+		size_t i = 0;
 
-		SseVec tmp0, tmp1, norm;
-		norm = NormalizeAngles(angles);
-		tmp1 = Vec4Abs(norm);
-		tmp1 = VecMul(tmp1, norm);
-		tmp0 = VecMul(norm, F_4_PI_1111);
-		tmp1 = VecMul(tmp1, F_NEG4_PI2_1111);
-		tmp0 = VecAdd(tmp0, tmp1);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, Exp2SseVec<precisionLevel>(_mm_loadu_ps(values + i)));
+		}
 
-		tmp1 = Vec4Abs(tmp0);
-		tmp1 = VecMul(tmp1, tmp0);
-		tmp1 = VecSub(tmp1, tmp0);
-		tmp1 = VecMul(tmp1, F_9_40_1111);
-		tmp0 = VecAdd(tmp0, tmp1);
+		if (i < count)
+		{
+			float tail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			std::copy(values + i, values + count, tail);
 
-		return tmp0;
+			_mm_storeu_ps(tail, Exp2SseVec<precisionLevel>(_mm_loadu_ps(tail)));
+			std::copy(tail, tail + (count - i), results + i);
+		}
 	}
 
 	/*!
-	 * \brief	Calculates a rougher (but generally much faster) approximation of the sine and/or
-	 * 			cosine of the various angles in the given column vector.
+	 * \brief	Calculates the natural exponential approximation of every value in the given array.
 	 *
-	 * \date	2/21/2015
-	 * 
-	 * \tparam	xFlag The x-coordinate index
-	 * \tparam	yFlag The y-coordinate index
-	 * \tparam	zFlag The z-coordinate index
-	 * \tparam	wFlag The w-coordinate index
-	 * 
-	 * \param	angles	The angles in radians.
+	 * \date	10/18/2026
 	 *
-	 * \return	A column vector containing the respective calculated sine and/or cosine
-	 * 			approximations from the angles in the original column vector.
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	values 	The values.
+	 * \param	results	The array receiving the results.  May alias values.
+	 * \param	count  	The number of values.
 	 *
-	 * \remarks	Approximates the sine of the given angles using a parabolic approximation.  Is
-	 * 			generally "accurate enough" and will more often than not run considerably faster than
-	 * 			the Taylor approximation.
-	 * 			
-	 * 			This function generally calculates within 0.001 radians of the standard sine and
-	 * 			cosine functions.
+	 * \remarks	Processes four values at a time with ExpSseVec, using unaligned loads and stores.
+	 * 			The remaining values are padded out to a full SseVec.
 	 */
-	template<SinCosFlag xFlag, SinCosFlag yFlag, SinCosFlag zFlag, SinCosFlag wFlag>
-	SSE_VEC_CALL FastSinCosSseVec(const SseVec& angles)
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline void ExpBatch(const float* values, float* results, size_t count)
 	{
-		static const SseVec F_9_40_1111 = SetSseVec4(0.225f);
-		SseVec tmp0, tmp1;
-		tmp0 = VecAdd(angles, F_PI_2_1111);
-		tmp0 = VecSinCosBlend<xFlag, yFlag, zFlag, wFlag>(angles, tmp0);
-		tmp0 = NormalizeAngles(tmp0);
+		size_t i = 0;
 
-		tmp1 = Vec4Abs(tmp0);
-		tmp1 = VecMul(tmp1, tmp0);
-        tmp0 = VecMul(tmp0, F_4_PI_1111);
-        tmp1 = VecMul(tmp1, F_NEG4_PI2_1111);
-		tmp0 = VecAdd(tmp0, tmp1);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, ExpSseVec<precisionLevel>(_mm_loadu_ps(values + i)));
+		}
 
-		tmp1 = Vec4Abs(tmp0);
-        tmp1 = VecMul(tmp1, tmp0);
-		tmp1 = VecSub(tmp1, tmp0);
-		tmp1 = VecMul(tmp1, F_9_40_1111);
-		tmp0 = VecAdd(tmp0, tmp1);
+		if (i < count)
+		{
+			float tail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			std::copy(values + i, values + count, tail);
 
-		return tmp0;
+			_mm_storeu_ps(tail, ExpSseVec<precisionLevel>(_mm_loadu_ps(tail)));
+			std::copy(tail, tail + (count - i), results + i);
+		}
 	}
-	
+
 	/*!
-	 * \brief	Calculates an approximation of the cosine of the various angles in the given column
-	 * 			vector.
+	 * \brief	Calculates the base-2 logarithm approximation of every value in the given array.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
 	 * \tparam	precisionLevel	Type of the precision level.
-	 * \param	angles	The angles in radians.
-	 *
-	 * \return	A column vector containing the respective calculated cosine approximations from the
-	 * 			angles in the original column vector.
+	 * \param	values 	The values.
+	 * \param	results	The array receiving the results.  May alias values.
+	 * \param	count  	The number of values.
 	 *
-	 * \remarks	Approximates the cosine of the given angles using a taylor aproximation with a
-	 * 			variable number of iterations.
-	 * 			
-	 * 			It is usually more accurate than FastCosSseVec, though it also ranges significantly
-	 * 			in relative computational complexity.  At lower levels of precision, it can be only
-	 * 			very slightly more expensive than the fast version, but at its highest precision
-	 * 			levels, it is quite a bit more expensive.
+	 * \remarks	Processes four values at a time with Log2SseVec, using unaligned loads and stores.
+	 * 			The remaining values are padded out to a full SseVec.
 	 */
 	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
-	SSE_VEC_CALL CosSseVec(const SseVec& angles)
+	inline void Log2Batch(const float* values, float* results, size_t count)
 	{
-		SseVec tmp0, tmp1, tmp2, norm;
-
-		static const size_t PRECISION = TrigPrecisionValue<precisionLevel>();
-
-		norm = NormalizeAngles(angles);
-
-		tmp1 = VecMul(norm, norm);
-		tmp2 = VecMul(tmp1, CosCoefSseVec(PRECISION));
+		size_t i = 0;
 
-		for (size_t i = PRECISION - 1; i-- > 0;)
+		for (; i + 4 <= count; i += 4)
 		{
-			tmp2 = VecAdd(tmp2, CosCoefSseVec((int)i));
-			tmp2 = VecMul(tmp1, tmp2);
+			_mm_storeu_ps(results + i, Log2SseVec<precisionLevel>(_mm_loadu_ps(values + i)));
 		}
 
-		tmp0 = VecAdd(tmp2, SSE_VEC_ONE);
+		if (i < count)
+		{
+			float tail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			std::copy(values + i, values + count, tail);
 
-		return tmp0;
+			_mm_storeu_ps(tail, Log2SseVec<precisionLevel>(_mm_loadu_ps(tail)));
+			std::copy(tail, tail + (count - i), results + i);
+		}
 	}
 
 	/*!
-	 * \brief	Calculates an approximation of the sine of the various angles in the given column
-	 * 			vector.
+	 * \brief	Calculates the natural logarithm approximation of every value in the given array.
 	 *
-	 * \date	2/21/2015
+	 * \date	10/18/2026
 	 *
 	 * \tparam	precisionLevel	Type of the precision level.
-	 * \param	angles	The angles in radians.
-	 *
-	 * \return	A column vector containing the respective calculated sine approximations from the
-	 * 			angles in the original column vector.
+	 * \param	values 	The values.
+	 * \param	results	The array receiving the results.  May alias values.
+	 * \param	count  	The number of values.
 	 *
-	 * \remarks	Approximates the sine of the given angles using a taylor aproximation with a variable
-	 * 			number of iterations.
-	 * 			
-	 * 			It is usually more accurate than FastSinSseVec, though it also ranges significantly
-	 * 			in relative computational complexity.  At lower levels of precision, it can be only
-	 * 			very slightly more expensive than the fast version, though the fast version is
-	 * 			typically more accurate at these levels, anyway, but at its highest precision levels,
-	 * 			it is quite a bit more expensive, but also quite a bit more accurate.
+	 * \remarks	Processes four values at a time with LogSseVec, using unaligned loads and stores.
+	 * 			The remaining values are padded out to a full SseVec.
 	 */
 	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
-	SSE_VEC_CALL SinSseVec(const SseVec& angles)
+	inline void LogBatch(const float* values, float* results, size_t count)
 	{
-		SseVec tmp0 = VecSub(angles, F_PI_2_1111);
+		size_t i = 0;
 
-		return CosSseVec<precisionLevel>(tmp0);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, LogSseVec<precisionLevel>(_mm_loadu_ps(values + i)));
+		}
+
+		if (i < count)
+		{
+			float tail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			std::copy(values + i, values + count, tail);
+
+			_mm_storeu_ps(tail, LogSseVec<precisionLevel>(_mm_loadu_ps(tail)));
+			std::copy(tail, tail + (count - i), results + i);
+		}
 	}
 
 	/*!
-	 * \brief	Calculates an approximation of the sine and/or cosine of the various angles in the
-	 * 			given column vector.
+	 * \brief	Calculates the power approximation of every pair of values in the given arrays.
 	 *
-	 * \date	2/21/2015
-	 * 
-	 * \tparam	xFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
-	 *							for the x-coordinate of the given SseVec containing the angles.
-	 * 
-	 * \tparam	yFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
-	 *							for the y-coordinate of the given SseVec containing the angles.
-	 * 
-	 * \tparam	zFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
-	 *							for the z-coordinate of the given SseVec containing the angles.
-	 * 
-	 * \tparam	wFlag		  	The SinCosFlag used to decide between calculating the sine or the cosine 
-	 *							for the w-coordinate of the given SseVec containing the angles.
-	 * 
-	 * \tparam	precisionLevel	Level of precision to use in the approximation.
-	 * 
-	 * \param	angles	The angles in radians.
+	 * \date	10/18/2026
 	 *
-	 * \return	A column vector containing the respective calculated sine and/or cosine
-	 * 			approximations from the angles in the original column vector.
+	 * \tparam	precisionLevel	Type of the precision level.
+	 * \param	bases	 	The bases.
+	 * \param	exponents	The exponents.
+	 * \param	results  	The array receiving the results.  May alias either input.
+	 * \param	count	 	The number of values.
 	 *
-	 * \remarks	Approximates the sine and/or cosine of the given angles using a Taylor approximation
-	 * 			with a variable number of iterations (depending on the FloatPrecision template
-	 * 			setting used to call it).
-	 * 
-	 * 			It is usually more accurate than FastSinCosSseVec, though it becomes relatively more
-	 *			expensive as the precision level is raised.  At lower levels of precision, it
-	 * 			can be only very slightly more expensive than the fast version, though the fast
-	 * 			version is typically more accurate at these levels, anyway. At its highest
-	 * 			precision levels, however, it is quite a bit more expensive, but also quite a bit more
-	 * 			accurate.
-	 */
-    template<SinCosFlag xFlag, SinCosFlag yFlag, SinCosFlag zFlag, SinCosFlag wFlag, FloatPrecision precisionLevel = FloatPrecision::HIGH>
-	SSE_VEC_CALL SinCosSseVec(const SseVec& angles)
+	 * \remarks	Processes four values at a time with PowSseVec, using unaligned loads and stores.
+	 * 			The remaining values are padded out to a full SseVec.
+	 */
+	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
+	inline void PowBatch(const float* bases, const float* exponents, float* results, size_t count)
 	{
-		SseVec tmp0;
-		tmp0 = VecSub(angles, F_PI_2_1111);
+		size_t i = 0;
 
-		tmp0 = VecSinCosBlend<xFlag, yFlag, zFlag, wFlag>(tmp0, angles);
-		return CosSseVec<precisionLevel>(tmp0);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(results + i, PowSseVec<precisionLevel>(_mm_loadu_ps(bases + i), _mm_loadu_ps(exponents + i)));
+		}
+
+		if (i < count)
+		{
+			float baseTail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			float exponentTail[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			std::copy(bases + i, bases + count, baseTail);
+			std::copy(exponents + i, exponents + count, exponentTail);
+
+			_mm_storeu_ps(baseTail, PowSseVec<precisionLevel>(_mm_loadu_ps(baseTail), _mm_loadu_ps(exponentTail)));
+			std::copy(baseTail, baseTail + (count - i), results + i);
+		}
 	}
 	
 	/*!
@@ -1374,7 +3204,7 @@ namespace gofxmath
 		SseVec tmp0, tmp1, tmp2, tmp3;
 
 		//w0x1 + x0w1 + y0z1 - z0y1
-		//w0y1 + y0w1 + x0z1 - z0x1
+		//w0y1 + y0w1 + z0x1 - x0z1
 		//w0z1 + z0w1 + x0y1 - y0x1
 		//w0w1 - x0x1 - y0y1 - z0z1
 
@@ -1385,20 +3215,162 @@ namespace gofxmath
 		tmp2 = VecSwizzle<VecCoord::W, VecCoord::W, VecCoord::W, VecCoord::X>(quat1);// w1 w1 w1 x1
 		tmp1 = VecMul(tmp1, tmp2);// x0w1 y0w1 z0w1 x0x1
 
-		tmp2 = VecSwizzle<VecCoord::Y, VecCoord::X, VecCoord::X, VecCoord::Y>(quat0);// y0 x0 x0 y0
-		tmp3 = VecSwizzle<VecCoord::Z, VecCoord::Z, VecCoord::Y, VecCoord::Y>(quat1);// z1 z1 y1 y1
-		tmp2 = VecMul(tmp2, tmp3);// y0z1 x0z1 x0y1 y0y1
+		tmp2 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::Y>(quat0);// y0 z0 x0 y0
+		tmp3 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::Y>(quat1);// z1 x1 y1 y1
+		tmp2 = VecMul(tmp2, tmp3);// y0z1 z0x1 x0y1 y0y1
+
+		tmp1 = VecAdd(tmp1, tmp2);// (x0w1 + y0z1) (y0w1 + z0x1) (z0w1 + x0y1) (x0x1 + y0y1)
+		tmp1 = Vec4Negate<false, false, false, true>(tmp1);// (x0w1 + y0z1) (y0w1 + z0x1) (z0w1 + x0y1) -(x0x1 + y0y1)
+
+		tmp0 = VecAdd(tmp0, tmp1);// (w0x1 + x0w1 + y0z1) (w0y1 + y0w1 + z0x1) (w0z1 + z0w1 + x0y1) (w0w1 - x0x1 - y0y1)
+
+		tmp1 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::Z>(quat0);// z0 x0 y0 z0
+		tmp2 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::Z>(quat1);// y1 z1 x1 z1
+		tmp1 = VecMul(tmp1, tmp2);// z0y1 x0z1 y0x1 z0z1
+
+		return VecSub(tmp0, tmp1);// (w0x1 + x0w1 + y0z1 - z0y1) (w0y1 + y0w1 + z0x1 - x0z1) (w0z1 + z0w1 + x0y1 - y0x1) (w0w1 - x0x1 - y0y1 - z0z1)
+	}
+
+	/*!
+	 * \brief	Rotates the given 3D vector by the given unit quaternion.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	quat	The unit quaternion SseVec.
+	 * \param	vec 	The 3D vector to rotate.
+	 *
+	 * \return	The rotated vector; the w component of vec is passed through unchanged.
+	 *
+	 * \remarks Uses %%v + 2w(\mathbf{q} \times v) + 2\mathbf{q} \times (\mathbf{q} \times v)%%,
+	 *			evaluated as %%v + w\mathbf{t} + \mathbf{q} \times \mathbf{t}%% with
+	 *			%%\mathbf{t} = 2(\mathbf{q} \times v)%%: two cross products, against the two
+	 *			quaternion products of %%qvq^*%% or building a rotation matrix first.
+	 */
+	SSE_VEC_CALL QuaternionRotateVec3(const SseVec& quat, const SseVec& vec)
+	{
+		SseVec tmp0, result;
+
+		tmp0 = Vec3Cross(quat, vec);
+		tmp0 = VecAdd(tmp0, tmp0);// 2(q x v)
+
+		result = VecMul(VecSplat<VecCoord::W>(quat), tmp0);// 2w(q x v)
+		result = VecAdd(result, Vec3Cross(quat, tmp0));// 2w(q x v) + 2q x (q x v)
+		result = VecAdd(result, vec);
+
+		return VecBlend<LEFT, LEFT, LEFT, RIGHT>(result, vec);
+	}
+
+	/*!
+	 * \brief	Rotates every 3D vector in the given array by the given unit quaternion.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	quat   	The unit quaternion SseVec.
+	 * \param	vecs   	The 3D vectors to rotate.
+	 * \param	results	The array receiving the rotated vectors.  May alias vecs.
+	 * \param	count  	The number of vectors.
+	 *
+	 * \remarks	The quaternion and its splatted w stay in registers for the whole loop.
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void QuaternionRotateVec3Batch(const SseVec& quat, const SseVec* vecs, SseVec* results, size_t count)
+	{
+		const SseVec local = quat;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+			BatchStore<storePolicy>(results + i, QuaternionRotateVec3(local, vecs[i]));
+		}
+
+		BatchStoreFence<storePolicy>();
+	}
+
+	/*!
+	 * \brief	Rotates every packed 3D vector in the given array by the given unit quaternion.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	storePolicy	  	How the results are written (see StorePolicy).
+	 * \tparam	prefetchDistance	How many elements ahead to prefetch the input (see BatchPrefetch).
+	 * \param	quat   	The unit quaternion SseVec.
+	 * \param	vecs   	The packed 3D vectors to rotate.
+	 * \param	results	The array receiving the rotated vectors.  May alias vecs.
+	 * \param	count  	The number of vectors.
+	 *
+	 * \remarks	Streams the packed array four vectors at a time (see LoadSseVec3PQuad), with no
+	 *			intermediate SseVec array.
+	 *
+	 *			With STREAMING, the blocks of four are streamed when results is 16-byte aligned (and
+	 *			written normally otherwise); the last count % 4 vectors are always written normally.
+	 */
+	template<StorePolicy storePolicy = StorePolicy::CACHED, size_t prefetchDistance = 0>
+	inline void QuaternionRotateVec3PBatch(const SseVec& quat, const Vec3P* vecs, Vec3P* results, size_t count)
+	{
+		const SseVec local = quat;
+		const bool stream = storePolicy == StorePolicy::STREAMING && (reinterpret_cast<uintptr_t>(results) & 0xF) == 0;
+		SseVec tmp[4];
+		size_t i = 0;
 
-		tmp1 = VecAdd(tmp1, tmp2);// (x0w1 + y0z1) (y0w1 + x0z1) (z0w1 + x0y1) (x0x1 + y0y1)
-		tmp1 = Vec4Negate<false, false, false, true>(tmp1);// (x0w1 + y0z1) (y0w1 + x0z1) (z0w1 + x0y1) -(x0x1 + y0y1)
+		for (; i + 4 <= count; i += 4)
+		{
+			BatchPrefetch<prefetchDistance>(vecs, i, count);
+			LoadSseVec3PQuad(vecs + i, tmp);
+
+			for (int j = 0; j < 4; ++j)
+			{
+				tmp[j] = QuaternionRotateVec3(local, tmp[j]);
+			}
+
+			if (stream)
+			{
+				StoreSseVec3PQuad<StorePolicy::STREAMING>(tmp, results + i);
+			}
+			else
+			{
+				StoreSseVec3PQuad(tmp, results + i);
+			}
+		}
 
-		tmp0 = VecAdd(tmp0, tmp1);// (w0x1 + x0w1 + y0z1) (w0y1 + y0w1 + x0z1) (w0z1 + z0w1 + x0y1) (w0w1 - x0x1 - y0y1)
+		for (; i < count; ++i)
+		{
+			results[i] = StoreSseVec3P(QuaternionRotateVec3(local, LoadSseVec3P(vecs[i])));
+		}
 
-		tmp1 = VecSwizzle<VecCoord::Z, VecCoord::Z, VecCoord::Y, VecCoord::Z>(quat0);// z0 z0 y0 z0
-		tmp2 = VecSwizzle<VecCoord::Y, VecCoord::X, VecCoord::X, VecCoord::Z>(quat1);// y1 x1 x1 z1
-		tmp1 = VecMul(tmp1, tmp2);// z0y1 z0x1 y0x1 z0z1
+		BatchStoreFence<storePolicy>();
+	}
 
-		return VecSub(tmp0, tmp1);// (w0x1 + x0w1 + y0z1 - z0y1) (w0y1 + y0w1 + x0z1 - z0x1) (w0z1 + z0w1 + x0y1 - y0x1) (w0w1 - x0x1 - y0y1 - z0z1)
+	/*!
+	 * \brief	Normalizes one packed 3D attribute (such as the normal) of every vertex in an interleaved
+	 *			vertex buffer.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	policy	How the length is calculated and divided out (see Vec3Normalize).
+	 * \param	src	   	The start of the source buffer.
+	 * \param	srcStride	The size of one source vertex, in bytes.
+	 * \param	srcOffset	The offset of the Vec3P attribute within a source vertex, in bytes.
+	 * \param	dst	   	The start of the destination buffer.  May be src, to normalize in place.
+	 * \param	dstStride	The size of one destination vertex, in bytes.
+	 * \param	dstOffset	The offset of the Vec3P attribute within a destination vertex, in bytes.
+	 * \param	count  	The number of vertices.
+	 *
+	 * \remarks	Only the 12 bytes of each attribute are read and written, so the other attributes of the
+	 *			vertices are untouched and no separate Vec3 array is needed.
+	 *
+	 * \sa StridedAttribute
+	 */
+	template<PrecisionPolicy policy = PrecisionPolicy::EXACT>
+	inline void Vec3PNormalizeStrided(const void* src, size_t srcStride, size_t srcOffset,
+		void* dst, size_t dstStride, size_t dstOffset, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			SseVec vec = LoadSseVec3P(*StridedAttribute<Vec3P>(src, srcStride, srcOffset, i));
+			*StridedAttribute<Vec3P>(dst, dstStride, dstOffset, i) = StoreSseVec3P(Vec3Normalize<policy>(vec));
+		}
 	}
 
 	/*!
@@ -1455,7 +3427,7 @@ namespace gofxmath
 	 */
 	SSE_VEC_CALL QuaternionLerp(const SseVec& start, const SseVec& end, float weight)
 	{
-		static const SseVec NEGATE_MASK_1111 = SetSseVecMask(0x80000000, 0x80000000, 0x80000000, 0x80000000);
+		static constexpr SseVecMaskConst NEGATE_MASK_1111 = { { 0x80000000, 0x80000000, 0x80000000, 0x80000000 } };
 		SseVec tmp0, tmp1, tmp2;
 		SseVec result;
 		SseVec weightVecEnd = SetSseVec4(weight);
@@ -1489,7 +3461,7 @@ namespace gofxmath
 	 */
 	SSE_VEC_CALL FastQuaternionLerp(const SseVec& start, const SseVec& end, float weight)
 	{
-		static const SseVec SIGN_MASK_1111 = SetSseVecMask(0x80000000, 0x80000000, 0x80000000, 0x80000000);
+		static constexpr SseVecMaskConst SIGN_MASK_1111 = { { 0x80000000, 0x80000000, 0x80000000, 0x80000000 } };
 
 		SseVec tmp0, tmp1, tmp2;
 		SseVec result;
@@ -1520,7 +3492,7 @@ namespace gofxmath
 	template<FloatPrecision precisionLevel = FloatPrecision::HIGH>
 	SSE_VEC_CALL QuaternionFromEuler(const SseVec& angles)
 	{
-		static const SseVec HALF = SetSseVec4(0.5f);
+		static constexpr SseVecConst HALF = SseVecConstSplat(0.5f);
 
 		SseVec tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
 		SseVec sinCosXY, sinCosZW;
@@ -1543,8 +3515,8 @@ namespace gofxmath
 		tmp3 = VecAnd(tmp3, MASK_0101);// 0  sy 0  cy
 		tmp4 = VecAnd(tmp4, MASK_0011);// 0  0  sz cz
 
-		result = QuaternionMultiply(tmp3, tmp2);
-		result = QuaternionMultiply(result, tmp4);
+		result = QuaternionMultiply(tmp4, tmp3);
+		result = QuaternionMultiply(result, tmp2);
 
 		return result;
 	}
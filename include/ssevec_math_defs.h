@@ -90,6 +90,38 @@ namespace gofxmath
 											 */
 	};
 
+	/*!
+	* \enum	PrecisionPolicy
+	*
+	* \brief	Values that represent how divisions, square roots and their reciprocals are calculated.
+	*
+	* \remarks Used as a template argument by VecRcp, VecRSqrt, VecDiv, VecSqrt, the normalize
+	*			functions, MatrixInverse and PerspectiveProjectionMatrix, so a call site can pick one
+	*			accuracy/throughput trade-off for all of them.
+	*/
+	enum PrecisionPolicy
+	{
+		EXACT = 0,		/*!< Full-precision <CODE>_mm_div_ps</CODE> and <CODE>_mm_sqrt_ps</CODE>. */
+		REFINED = 1,	/*!< The hardware <CODE>_mm_rcp_ps</CODE> / <CODE>_mm_rsqrt_ps</CODE> estimate, plus one Newton-Raphson step (about 22 bits). */
+		ESTIMATE = 2	/*!< The raw hardware estimate (about 12 bits). */
+	};
+
+	/*!
+	* \enum	StorePolicy
+	*
+	* \brief	Values that represent how the batch functions write their results.
+	*
+	* \remarks Used as a template argument by the SseVec, SseMat33 and SseMat44 batch functions.  Streaming
+	*			pays off once the output is much larger than the last-level cache and will not be read
+	*			again soon (such as geometry that is about to be uploaded); below that, cached stores are
+	*			faster, since the results are still in the cache for whoever reads them next.
+	*/
+	enum StorePolicy
+	{
+		CACHED = 0,		/*!< Ordinary stores, which read the destination lines into the cache first. */
+		STREAMING = 1	/*!< Non-temporal <CODE>_mm_stream_ps</CODE> stores that bypass the cache, with an <CODE>_mm_sfence</CODE> at the end of the batch. */
+	};
+
 /*!
  * \def	SSE_VEC_CALL();
  *
@@ -233,96 +265,227 @@ namespace gofxmath
 		return _mm_castsi128_ps(_mm_set1_epi32(xyzw));
 	}
 
-	const SseVec UNIT_0001 = SetSseVec4(0.0f, 0.0f, 0.0f, 1.0f);/*!< The unit SseVec <0 0 0 1> */
-	const SseVec UNIT_0010 = SetSseVec4(0.0f, 0.0f, 1.0f, 0.0f);/*!< The unit SseVec <0 0 1 0> */
-	const SseVec UNIT_0100 = SetSseVec4(0.0f, 1.0f, 0.0f, 0.0f);/*!< The unit SseVec <0 1 0 0> */
-	const SseVec UNIT_1000 = SetSseVec4(1.0f, 0.0f, 0.0f, 0.0f);/*!< The unit SseVec <1 0 0 0> */
+	/*!
+	 * \struct	SseVecConst
+	 *
+	 * \brief	A 16-byte aligned table of four floats that converts to an SseVec with a single
+	 *			<CODE>_mm_load_ps</CODE>.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	SseVec constants are declared <CODE>constexpr</CODE> with this type rather than
+	 *			built with <CODE>_mm_set_ps</CODE>. They are therefore initialized statically (placed
+	 *			in read-only data by the compiler) instead of by a dynamic initializer in every
+	 *			translation unit, and function-local <CODE>static constexpr</CODE> tables need no
+	 *			thread-safe guard check on each call.
+	 */
+	ALIGNED_STRUCT(16) SseVecConst
+	{
+		float vals[4];/*!< The four components, in x y z w order. */
 
-	const SseVec F_NEG4_PI2_1111 = SetSseVec4(F_NEG4_PI2);/*!< SseVec of the form <\\(\\frac{-4}{\\pi^2} \\frac{-4}{\\pi^2} \\frac{-4}{\\pi^2} \\frac{-4}{\\pi^2})> */
-	const SseVec F_4_PI_1111 = SetSseVec4(F_4_PI);/*!< SseVec of the form <\\(\\frac{4}{\\pi} \\frac{4}{\\pi} \\frac{4}{\\pi} \\frac{4}{\\pi}\\)> */
-	const SseVec F_1_2PI_1111 = SetSseVec4(F_1_2PI);/*!< SseVec of the form <\\(\\frac{1}{2\\pi} \\frac{1}{2\\pi} \\frac{1}{2\\pi} \\frac{1}{2\\pi}\\)> */
+		/*!
+		 * \brief	Loads the table into an SseVec.
+		 */
+		operator SseVec() const { return _mm_load_ps(vals); }
+	};
 
-	const SseVec F_PI_2_1111 = SetSseVec4(F_PI_2);/*!< SseVec of the form <\\(\\frac{\\pi}{2} \\frac{\\pi}{2} \\frac{\\pi}{2} \\frac{\\pi}{2})> */
-	const SseVec F_PI_1111 = SetSseVec4(F_PI);/*!< SseVec of the form <\\(\\pi \\pi \\pi \\pi\\)>*/
-	const SseVec F_2PI_1111 = SetSseVec4(F_2PI);/*!< SseVec of the form <\\(2\\pi 2\\pi 2\\pi 2\\pi\\)> */
+	/*!
+	 * \struct	SseVecMaskConst
+	 *
+	 * \brief	A 16-byte aligned table of four MaskVals that converts to an SseVec mask with a
+	 *			single aligned load.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \sa SseVecConst
+	 */
+	ALIGNED_STRUCT(16) SseVecMaskConst
+	{
+		MaskVal bits[4];/*!< The four component masks, in x y z w order. */
 
-	const SseVec MASK_1000 = SetSseVecMask(0xFFFFFFFF, 0x0,		  0x0,			  0x0);			/*!< SseVec mask that will match any bit in the x-coordinate position. Takes the form < 0xFFFFFFFF 0x0 0x0 0x0>*/
-	const SseVec MASK_0100 = SetSseVecMask(0x0,		   0xFFFFFFFF, 0x0,			  0x0);			/*!< SseVec mask that will match any bit in the y-coordinate position. Takes the form < 0x0 0xFFFFFFFF 0x0 0x0> */
-	const SseVec MASK_0010 = SetSseVecMask(0x0,		   0x0,		  0xFFFFFFFF,	  0x0);			/*!< SseVec mask that will match any bit in the z-coordinate position. Takes the form < 0x0 0x0 0xFFFFFFFF 0x0> */
-	const SseVec MASK_0001 = SetSseVecMask(0x0,		   0x0,		  0x0,			  0xFFFFFFFF);	/*!< SseVec mask that will match any bit in the w-coordinate position. Takes the form < 0x0 0x0 0x0 0xFFFFFFFF> */
-	
-	const SseVec MASK_1100 = SetSseVecMask(0xFFFFFFFF,	0xFFFFFFFF, 0x0,		0x0);			/*!< SseVec mask that will match any bit in the x or y-coordinate positions. Takes the form <0xFFFFFFFF 0xFFFFFFFF 0x0 0x0> */
-	const SseVec MASK_1010 = SetSseVecMask(0xFFFFFFFF,	0x0,		0xFFFFFFFF, 0x0);			/*!< SseVec mask that will match any bit in the x or z-coordinate positions. Takes the form <0xFFFFFFFF 0x0 0xFFFFFFFF 0x0> */
-	const SseVec MASK_1001 = SetSseVecMask(0xFFFFFFFF,	0x0,		0x0,		0xFFFFFFFF);	/*!< SseVec mask that will match any bit in the x or w-coordinate positions. Takes the form <0xFFFFFFFF 0x0 0x0 0xFFFFFFFF> */
-	const SseVec MASK_0110 = SetSseVecMask(0x0,			0xFFFFFFFF, 0xFFFFFFFF, 0x0);			/*!< SseVec mask that will match any bit in the y or z-coordinate positions. Takes the form <0x0 0xFFFFFFFF 0xFFFFFFFF 0x0> */
-	const SseVec MASK_0101 = SetSseVecMask(0x0,			0xFFFFFFFF, 0x0,		0xFFFFFFFF);	/*!< SseVec mask that will match any bit in the y or w-coordinate positions. Takes the form <0x0 0xFFFFFFFF 0x0 0xFFFFFFFF> */
-	const SseVec MASK_0011 = SetSseVecMask(0x0,			0x0,		0xFFFFFFFF, 0xFFFFFFFF);	/*!< SseVec mask that will match any bit in the z or w-coordinate positions. Takes the form <0x0 0x0 0xFFFFFFFF 0xFFFFFFFF> */
+		/*!
+		 * \brief	Loads the table into an SseVec mask.
+		 */
+		operator SseVec() const { return _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(bits))); }
+	};
 
-	const SseVec MASK_0111 = SetSseVecMask(0x0,			0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF);	/*!< SseVec mask that will match any bit in the y, z, or w-coordinate positions. Takes the form <0x0 0xFFFFFFFF 0xFFFFFFFF 0xFFFFFFFF> */
-	const SseVec MASK_1011 = SetSseVecMask(0xFFFFFFFF,	0x0,		0xFFFFFFFF, 0xFFFFFFFF);	/*!< SseVec mask that will match any bit in the x, z, or w-coordinate positions. Takes the form <0xFFFFFFFF 0x0 0xFFFFFFFF 0xFFFFFFFF> */
-	const SseVec MASK_1101 = SetSseVecMask(0xFFFFFFFF,	0xFFFFFFFF, 0x0,		0xFFFFFFFF);	/*!< SseVec mask that will match any bit in the x, y, or w-coordinate positions. Takes the form <0xFFFFFFFF 0xFFFFFFFF 0x0 0xFFFFFFFF> */
-	const SseVec MASK_1110 = SetSseVecMask(0xFFFFFFFF,	0xFFFFFFFF, 0xFFFFFFFF, 0x0);			/*!< SseVec mask that will match any bit in the x, y, or z-coordinate positions. Takes the form <0xFFFFFFFF 0xFFFFFFFF 0xFFFFFFFF 0x0> */
+	/*!
+	 * \brief	Builds an SseVecConst with the given value in all four components.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xyzw	The value to place in all four components.
+	 *
+	 * \return	The constant table.
+	 */
+	constexpr SseVecConst SseVecConstSplat(float xyzw)
+	{
+		return SseVecConst{ { xyzw, xyzw, xyzw, xyzw } };
+	}
+
+	/*!
+	 * \brief	Builds an SseVecMaskConst with the given value in all four components.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xyzw	The mask value to place in all four components.
+	 *
+	 * \return	The constant mask table.
+	 */
+	constexpr SseVecMaskConst SseVecMaskConstSplat(MaskVal xyzw)
+	{
+		return SseVecMaskConst{ { xyzw, xyzw, xyzw, xyzw } };
+	}
+
+	/*!
+	 * \struct	SseVecConstTables
+	 *
+	 * \brief	Holds the one definition of each namespace-scope SseVec constant table (UNIT_0001,
+	 *			MASK_1110, SSE_VEC_ONE, ...).
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	A namespace-scope <CODE>constexpr</CODE> object has internal linkage, so every
+	 *			translation unit that used one would get its own copy of the table.  A static data
+	 *			member of a class template is instead defined once for the whole program (the C++11
+	 *			equivalent of a C++17 <CODE>inline constexpr</CODE> variable), and the namespace-scope
+	 *			names are <CODE>static constexpr</CODE> references to these members, which optimized
+	 *			builds resolve at compile time (unoptimized ones keep at most a statically initialized
+	 *			pointer per translation unit).  Use the namespace-scope names rather than this struct.
+	 */
+	template<typename Unused = void>
+	struct SseVecConstTables
+	{
+		//! \cond
+		static constexpr SseVecConst UNIT_0001 = { { 0.0f, 0.0f, 0.0f, 1.0f } };
+		static constexpr SseVecConst UNIT_0010 = { { 0.0f, 0.0f, 1.0f, 0.0f } };
+		static constexpr SseVecConst UNIT_0100 = { { 0.0f, 1.0f, 0.0f, 0.0f } };
+		static constexpr SseVecConst UNIT_1000 = { { 1.0f, 0.0f, 0.0f, 0.0f } };
+
+		static constexpr SseVecConst F_NEG4_PI2_1111 = SseVecConstSplat(F_NEG4_PI2);
+		static constexpr SseVecConst F_4_PI_1111 = SseVecConstSplat(F_4_PI);
+		static constexpr SseVecConst F_1_2PI_1111 = SseVecConstSplat(F_1_2PI);
 
-	const SseVec SSE_VEC_ONE = SetSseVec4(1.0f);/*!< SseVec of the form <1.0f 1.0f 1.0f 1.0f> */
-	const SseVec EPSILON_1111 = SetSseVec4(Epsilon());/*!< SseVec of the form <%%\\epsilon \\epsilon \\epsilon \\epsilon%%> where %%\\epsilon%% is the smallest value such that %%1.0f + \\epsilon 	\\not= 1.0f%% */
+		static constexpr SseVecConst F_TAN_PI_8_1111 = SseVecConstSplat(F_TAN_PI_8);
+		static constexpr SseVecConst F_TAN_3PI_8_1111 = SseVecConstSplat(F_TAN_3PI_8);
+		static constexpr SseVecConst F_PI_4_1111 = SseVecConstSplat(F_PI_4);
+		static constexpr SseVecConst F_PI_2_1111 = SseVecConstSplat(F_PI_2);
+		static constexpr SseVecConst F_PI_1111 = SseVecConstSplat(F_PI);
+		static constexpr SseVecConst F_2PI_1111 = SseVecConstSplat(F_2PI);
+
+		static constexpr SseVecMaskConst MASK_1000 = { { 0xFFFFFFFF, 0x0,		  0x0,			  0x0 } };
+		static constexpr SseVecMaskConst MASK_0100 = { { 0x0,		   0xFFFFFFFF, 0x0,			  0x0 } };
+		static constexpr SseVecMaskConst MASK_0010 = { { 0x0,		   0x0,		  0xFFFFFFFF,	  0x0 } };
+		static constexpr SseVecMaskConst MASK_0001 = { { 0x0,		   0x0,		  0x0,			  0xFFFFFFFF } };
+
+		static constexpr SseVecMaskConst MASK_1100 = { { 0xFFFFFFFF,	0xFFFFFFFF, 0x0,		0x0 } };
+		static constexpr SseVecMaskConst MASK_1010 = { { 0xFFFFFFFF,	0x0,		0xFFFFFFFF, 0x0 } };
+		static constexpr SseVecMaskConst MASK_1001 = { { 0xFFFFFFFF,	0x0,		0x0,		0xFFFFFFFF } };
+		static constexpr SseVecMaskConst MASK_0110 = { { 0x0,			0xFFFFFFFF, 0xFFFFFFFF, 0x0 } };
+		static constexpr SseVecMaskConst MASK_0101 = { { 0x0,			0xFFFFFFFF, 0x0,		0xFFFFFFFF } };
+		static constexpr SseVecMaskConst MASK_0011 = { { 0x0,			0x0,		0xFFFFFFFF, 0xFFFFFFFF } };
+
+		static constexpr SseVecMaskConst MASK_0111 = { { 0x0,			0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF } };
+		static constexpr SseVecMaskConst MASK_1011 = { { 0xFFFFFFFF,	0x0,		0xFFFFFFFF, 0xFFFFFFFF } };
+		static constexpr SseVecMaskConst MASK_1101 = { { 0xFFFFFFFF,	0xFFFFFFFF, 0x0,		0xFFFFFFFF } };
+		static constexpr SseVecMaskConst MASK_1110 = { { 0xFFFFFFFF,	0xFFFFFFFF, 0xFFFFFFFF, 0x0 } };
+
+		static constexpr SseVecConst SSE_VEC_ONE = SseVecConstSplat(1.0f);
+		static constexpr SseVecConst EPSILON_1111 = SseVecConstSplat(Epsilon());
+		//! \endcond
+	};
+
+#if __cplusplus < 201703L && !(defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+	//! \cond
+	// Before C++17, constexpr static data members still need a definition outside the class
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::UNIT_0001;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::UNIT_0010;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::UNIT_0100;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::UNIT_1000;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_NEG4_PI2_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_4_PI_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_1_2PI_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_TAN_PI_8_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_TAN_3PI_8_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_PI_4_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_PI_2_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_PI_1111;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::F_2PI_1111;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_1000;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_0100;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_0010;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_0001;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_1100;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_1010;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_1001;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_0110;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_0101;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_0011;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_0111;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_1011;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_1101;
+	template<typename Unused> constexpr SseVecMaskConst SseVecConstTables<Unused>::MASK_1110;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::SSE_VEC_ONE;
+	template<typename Unused> constexpr SseVecConst SseVecConstTables<Unused>::EPSILON_1111;
+	//! \endcond
+#endif
+
+	static constexpr const SseVecConst& UNIT_0001 = SseVecConstTables<>::UNIT_0001;/*!< The unit SseVec <0 0 0 1> */
+	static constexpr const SseVecConst& UNIT_0010 = SseVecConstTables<>::UNIT_0010;/*!< The unit SseVec <0 0 1 0> */
+	static constexpr const SseVecConst& UNIT_0100 = SseVecConstTables<>::UNIT_0100;/*!< The unit SseVec <0 1 0 0> */
+	static constexpr const SseVecConst& UNIT_1000 = SseVecConstTables<>::UNIT_1000;/*!< The unit SseVec <1 0 0 0> */
+
+	static constexpr const SseVecConst& F_NEG4_PI2_1111 = SseVecConstTables<>::F_NEG4_PI2_1111;/*!< SseVec of the form <\\(\\frac{-4}{\\pi^2} \\frac{-4}{\\pi^2} \\frac{-4}{\\pi^2} \\frac{-4}{\\pi^2})> */
+	static constexpr const SseVecConst& F_4_PI_1111 = SseVecConstTables<>::F_4_PI_1111;/*!< SseVec of the form <\\(\\frac{4}{\\pi} \\frac{4}{\\pi} \\frac{4}{\\pi} \\frac{4}{\\pi}\\)> */
+	static constexpr const SseVecConst& F_1_2PI_1111 = SseVecConstTables<>::F_1_2PI_1111;/*!< SseVec of the form <\\(\\frac{1}{2\\pi} \\frac{1}{2\\pi} \\frac{1}{2\\pi} \\frac{1}{2\\pi}\\)> */
+
+	static constexpr const SseVecConst& F_TAN_PI_8_1111 = SseVecConstTables<>::F_TAN_PI_8_1111;/*!< SseVec of the form <\\(\\tan(\\frac{\\pi}{8}) \\tan(\\frac{\\pi}{8}) \\tan(\\frac{\\pi}{8}) \\tan(\\frac{\\pi}{8})\\)> */
+	static constexpr const SseVecConst& F_TAN_3PI_8_1111 = SseVecConstTables<>::F_TAN_3PI_8_1111;/*!< SseVec of the form <\\(\\tan(\\frac{3\\pi}{8}) \\tan(\\frac{3\\pi}{8}) \\tan(\\frac{3\\pi}{8}) \\tan(\\frac{3\\pi}{8})\\)> */
+	static constexpr const SseVecConst& F_PI_4_1111 = SseVecConstTables<>::F_PI_4_1111;/*!< SseVec of the form <\\(\\frac{\\pi}{4} \\frac{\\pi}{4} \\frac{\\pi}{4} \\frac{\\pi}{4}\\)> */
+	static constexpr const SseVecConst& F_PI_2_1111 = SseVecConstTables<>::F_PI_2_1111;/*!< SseVec of the form <\\(\\frac{\\pi}{2} \\frac{\\pi}{2} \\frac{\\pi}{2} \\frac{\\pi}{2})> */
+	static constexpr const SseVecConst& F_PI_1111 = SseVecConstTables<>::F_PI_1111;/*!< SseVec of the form <\\(\\pi \\pi \\pi \\pi\\)>*/
+	static constexpr const SseVecConst& F_2PI_1111 = SseVecConstTables<>::F_2PI_1111;/*!< SseVec of the form <\\(2\\pi 2\\pi 2\\pi 2\\pi\\)> */
+
+	static constexpr const SseVecMaskConst& MASK_1000 = SseVecConstTables<>::MASK_1000;/*!< SseVec mask that will match any bit in the x-coordinate position. Takes the form < 0xFFFFFFFF 0x0 0x0 0x0>*/
+	static constexpr const SseVecMaskConst& MASK_0100 = SseVecConstTables<>::MASK_0100;/*!< SseVec mask that will match any bit in the y-coordinate position. Takes the form < 0x0 0xFFFFFFFF 0x0 0x0> */
+	static constexpr const SseVecMaskConst& MASK_0010 = SseVecConstTables<>::MASK_0010;/*!< SseVec mask that will match any bit in the z-coordinate position. Takes the form < 0x0 0x0 0xFFFFFFFF 0x0> */
+	static constexpr const SseVecMaskConst& MASK_0001 = SseVecConstTables<>::MASK_0001;/*!< SseVec mask that will match any bit in the w-coordinate position. Takes the form < 0x0 0x0 0x0 0xFFFFFFFF> */
+
+	static constexpr const SseVecMaskConst& MASK_1100 = SseVecConstTables<>::MASK_1100;/*!< SseVec mask that will match any bit in the x or y-coordinate positions. Takes the form <0xFFFFFFFF 0xFFFFFFFF 0x0 0x0> */
+	static constexpr const SseVecMaskConst& MASK_1010 = SseVecConstTables<>::MASK_1010;/*!< SseVec mask that will match any bit in the x or z-coordinate positions. Takes the form <0xFFFFFFFF 0x0 0xFFFFFFFF 0x0> */
+	static constexpr const SseVecMaskConst& MASK_1001 = SseVecConstTables<>::MASK_1001;/*!< SseVec mask that will match any bit in the x or w-coordinate positions. Takes the form <0xFFFFFFFF 0x0 0x0 0xFFFFFFFF> */
+	static constexpr const SseVecMaskConst& MASK_0110 = SseVecConstTables<>::MASK_0110;/*!< SseVec mask that will match any bit in the y or z-coordinate positions. Takes the form <0x0 0xFFFFFFFF 0xFFFFFFFF 0x0> */
+	static constexpr const SseVecMaskConst& MASK_0101 = SseVecConstTables<>::MASK_0101;/*!< SseVec mask that will match any bit in the y or w-coordinate positions. Takes the form <0x0 0xFFFFFFFF 0x0 0xFFFFFFFF> */
+	static constexpr const SseVecMaskConst& MASK_0011 = SseVecConstTables<>::MASK_0011;/*!< SseVec mask that will match any bit in the z or w-coordinate positions. Takes the form <0x0 0x0 0xFFFFFFFF 0xFFFFFFFF> */
+
+	static constexpr const SseVecMaskConst& MASK_0111 = SseVecConstTables<>::MASK_0111;/*!< SseVec mask that will match any bit in the y, z, or w-coordinate positions. Takes the form <0x0 0xFFFFFFFF 0xFFFFFFFF 0xFFFFFFFF> */
+	static constexpr const SseVecMaskConst& MASK_1011 = SseVecConstTables<>::MASK_1011;/*!< SseVec mask that will match any bit in the x, z, or w-coordinate positions. Takes the form <0xFFFFFFFF 0x0 0xFFFFFFFF 0xFFFFFFFF> */
+	static constexpr const SseVecMaskConst& MASK_1101 = SseVecConstTables<>::MASK_1101;/*!< SseVec mask that will match any bit in the x, y, or w-coordinate positions. Takes the form <0xFFFFFFFF 0xFFFFFFFF 0x0 0xFFFFFFFF> */
+	static constexpr const SseVecMaskConst& MASK_1110 = SseVecConstTables<>::MASK_1110;/*!< SseVec mask that will match any bit in the x, y, or z-coordinate positions. Takes the form <0xFFFFFFFF 0xFFFFFFFF 0xFFFFFFFF 0x0> */
+
+	static constexpr const SseVecConst& SSE_VEC_ONE = SseVecConstTables<>::SSE_VEC_ONE;/*!< SseVec of the form <1.0f 1.0f 1.0f 1.0f> */
+	static constexpr const SseVecConst& EPSILON_1111 = SseVecConstTables<>::EPSILON_1111;/*!< SseVec of the form <%%\\epsilon \\epsilon \\epsilon \\epsilon%%> where %%\\epsilon%% is the smallest value such that %%1.0f + \\epsilon 	\\not= 1.0f%% */
 
 	/*!
-	 * \brief First 16 taylor series sine approximation coefficients loaded into all four components of their respective SseVecs.
+	 * \brief	The (i+1)th taylor series sine approximation coefficient, loaded into all four components of an SseVec.
+	 *
+	 * \remarks	Broadcast from the statically initialized table behind SinCoef, so there is no
+	 *			guarded table of SseVecs to initialize.
 	 */
 	inline SseVec SinCoefSseVec(int i)
 	{
-		static const std::array<SseVec, NUM_TRIG_COEFS> SIN_COEFFICIENT_SSEVECS =
-		{
-			SetSseVec4(SinCoef(0)),  // 1/(1+2*1)!  = 1/3!
-			SetSseVec4(SinCoef(1)),  // 1/(1+2*2)!  = 1/5!
-			SetSseVec4(SinCoef(2)),  // 1/(1+2*3)!  = 1/7!
-			SetSseVec4(SinCoef(3)),  // 1/(1+2*4)!  = 1/9!
-			SetSseVec4(SinCoef(4)),  // 1/(1+2*5)!  = 1/11!
-			SetSseVec4(SinCoef(5)),  // 1/(1+2*6)!  = 1/13!
-			SetSseVec4(SinCoef(6)),  // 1/(1+2*7)!  = 1/15!
-			SetSseVec4(SinCoef(7)),  // 1/(1+2*8)!  = 1/17!
-			SetSseVec4(SinCoef(8)),  // 1/(1+2*9)!  = 1/19!
-			SetSseVec4(SinCoef(9)),  // 1/(1+2*10)! = 1/21!
-			SetSseVec4(SinCoef(10)), // 1/(1+2*11)! = 1/23!
-			SetSseVec4(SinCoef(11)), // 1/(1+2*12)! = 1/25!
-			SetSseVec4(SinCoef(12)), // 1/(1+2*13)! = 1/27!
-			SetSseVec4(SinCoef(13)), // 1/(1+2*14)! = 1/29!
-			SetSseVec4(SinCoef(14)), // 1/(1+2*15)! = 1/31!
-			SetSseVec4(SinCoef(15)), // 1/(1+2*16)! = 1/33!
-		};
-
-		return SIN_COEFFICIENT_SSEVECS[i];
+		return _mm_set1_ps(SinCoef(i));
 	}
-	
 
 	/*! 
-	 * \brief First 16 taylor series cosine approximation coefficients loaded into all four components of their respective SseVecs. 
+	 * \brief	The (i+1)th taylor series cosine approximation coefficient, loaded into all four components of an SseVec.
+	 *
+	 * \remarks	Broadcast from the statically initialized table behind CosCoef.
 	 */
 	inline SseVec CosCoefSseVec(int i)
 	{
-		static const std::array<SseVec, NUM_TRIG_COEFS> COS_COEFFICIENT_SSEVECS =
-		{
-			SetSseVec4(CosCoef(0)),  // 1/(2*1)!  = 1/2!
-			SetSseVec4(CosCoef(1)),  // 1/(2*2)!  = 1/4!
-			SetSseVec4(CosCoef(2)),  // 1/(2*3)!  = 1/6!
-			SetSseVec4(CosCoef(3)),  // 1/(2*4)!  = 1/8!
-			SetSseVec4(CosCoef(4)),  // 1/(2*5)!  = 1/10!
-			SetSseVec4(CosCoef(5)),  // 1/(2*6)!  = 1/12!
-			SetSseVec4(CosCoef(6)),  // 1/(2*7)!  = 1/14!
-			SetSseVec4(CosCoef(7)),  // 1/(2*8)!  = 1/16!
-			SetSseVec4(CosCoef(8)),  // 1/(2*9)!  = 1/18!
-			SetSseVec4(CosCoef(9)),  // 1/(2*10)! = 1/20!
-			SetSseVec4(CosCoef(10)), // 1/(2*11)! = 1/22!
-			SetSseVec4(CosCoef(11)), // 1/(2*12)! = 1/24!
-			SetSseVec4(CosCoef(12)), // 1/(2*13)! = 1/26!
-			SetSseVec4(CosCoef(13)), // 1/(2*14)! = 1/28!
-			SetSseVec4(CosCoef(14)), // 1/(2*15)! = 1/30!
-			SetSseVec4(CosCoef(15)), // 1/(2*16)! = 1/32!
-		};
-
-		return COS_COEFFICIENT_SSEVECS[i];
+		return _mm_set1_ps(CosCoef(i));
 	}
-	
 
 	/*!
 	 * \enum	VecCoord
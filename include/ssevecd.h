@@ -0,0 +1,760 @@
+#ifndef SSE_VECD_DOT_H
+#define SSE_VECD_DOT_H
+#include "ssevec_math_defs.h"
+#include "sisd_defns.h"
+#include <stdint.h>
+
+/*!
+ * \file
+ */
+
+/*!
+ * \defgroup SIMDVecDMath SIMD Double-Precision Vector Math
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SIMDVecDMath
+	 * @{
+	 */
+
+#if defined(__AVX2__)
+/*!
+ * \def	SSE_VECD_AVX
+ *
+ * \brief	Defined when SseVecD is backed by a single 256-bit AVX register.
+ *
+ * \remarks	The full lane permutes used for swizzling and shuffling (<CODE>_mm256_permute4x64_pd</CODE>)
+ *			are only available with AVX2, so anything less falls back to a pair of SSE2 registers.
+ */
+#define SSE_VECD_AVX
+
+	/*!
+	 * \typedef	__m256d SseVecD
+	 *
+	 * \brief	Defines an alias representing the double-precision SseVecD.
+	 *
+	 * \remarks	Follows the same [x y z w] ordering conventions as SseVec.
+	 */
+	typedef __m256d SseVecD;
+#else
+	/*!
+	 * \struct	SseVecD
+	 *
+	 * \brief	A double-precision 4-component vector held in two SSE2 registers.
+	 *
+	 * \remarks	Used when AVX2 is not available.  The x and y components live in the
+	 *			first register, and the z and w components live in the second.  Follows
+	 *			the same [x y z w] ordering conventions as SseVec.
+	 */
+	ALIGNED_STRUCT(16) SseVecD
+	{
+		__m128d xy;/*!< The x and y components */
+		__m128d zw;/*!< The z and w components */
+	};
+#endif
+
+	/*!
+	 * \typedef	uint64_t MaskValD
+	 *
+	 * \brief	Defines an alias representing a 64-bit mask value, used to build SseVecD masks.
+	 */
+	typedef uint64_t MaskValD;
+
+/*!
+ * \def	SSE_VECD_CALL();
+ *
+ * \brief The calling convention for most SseVecD functions.
+ */
+#define SSE_VECD_CALL inline SseVecD
+
+#ifndef SSE_VECD_AVX
+	/*!
+	 * \brief	Selects the SSE2 register half of the given SseVecD that holds the given coordinate.
+	 *
+	 * \tparam	c	The coordinate being looked up.
+	 * \param	vec	The SseVecD to select the register from.
+	 *
+	 * \return	The xy register for the x and y coordinates, and the zw register otherwise.
+	 */
+	template<VecCoord c>
+	inline __m128d SelectSseVecDHalf(const SseVecD& vec)
+	{
+		return c < VecCoord::Z ? vec.xy : vec.zw;
+	}
+#endif
+
+	/*!
+	 * \brief	Sets the SseVecD to represent a 4-component vector, with the given double-precision components.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	x	The x component.
+	 * \param	y	The y component.
+	 * \param	z	The z component.
+	 * \param	w	The w component.
+	 *
+	 * \return	A SseVecD representation of a 4-component vector, using the given components.
+	 */
+	SSE_VECD_CALL SetSseVecD4(double x, double y, double z, double w)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_set_pd(w, z, y, x);
+#else
+		SseVecD result;
+		result.xy = _mm_set_pd(y, x);
+		result.zw = _mm_set_pd(w, z);
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Sets the SseVecD with all four components set to the given value.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xyzw	The double value to load in all four components.
+	 *
+	 * \return	A SseVecD with the given value in all four components.
+	 */
+	SSE_VECD_CALL SetSseVecD4(double xyzw)
+	{
+		return SetSseVecD4(xyzw, xyzw, xyzw, xyzw);
+	}
+
+	/*!
+	 * \brief	Sets the SseVecD to represent a 3-component vector, with the given double-precision components.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	x	The x component.
+	 * \param	y	The y component.
+	 * \param	z	The z component.
+	 *
+	 * \return	A SseVecD representation of a 3-component vector, using the given components.
+	 *
+	 * \remarks	Sets the fourth component value of the SseVecD to 1.0.
+	 */
+	SSE_VECD_CALL SetSseVecD3(double x, double y, double z)
+	{
+		return SetSseVecD4(x, y, z, 1.0);
+	}
+
+	/*!
+	 * \brief	Sets the SseVecD to represent a 2-component vector, with the given double-precision components.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	x	The x component.
+	 * \param	y	The y component.
+	 *
+	 * \return	A SseVecD representation of a 2-component vector, using the given components.
+	 *
+	 * \remarks	Sets the third and fourth components of the SseVecD to 0.0 and 1.0, respectively.
+	 */
+	SSE_VECD_CALL SetSseVecD2(double x, double y)
+	{
+		return SetSseVecD4(x, y, 0.0, 1.0);
+	}
+
+	/*!
+	 * \brief	Creates a "masking" SseVecD, using the bits from x, y, z, and w.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	x	The x-coordinate mask value.
+	 * \param	y	The y-coordinate mask value.
+	 * \param	z	The z-coordinate mask value.
+	 * \param	w	The w-coordinate mask value.
+	 *
+	 * \return	An SseVecD with the bits copied into its components from the four given MaskValDs.
+	 */
+	SSE_VECD_CALL SetSseVecDMask(MaskValD x, MaskValD y, MaskValD z, MaskValD w)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_castsi256_pd(_mm256_set_epi64x(w, z, y, x));
+#else
+		SseVecD result;
+		result.xy = _mm_castsi128_pd(_mm_set_epi64x(y, x));
+		result.zw = _mm_castsi128_pd(_mm_set_epi64x(w, z));
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Sets and returns an SseVecD with all 0 values.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	An SseVecD containing all 0 values.
+	 */
+	SSE_VECD_CALL SetVecDZero()
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_setzero_pd();
+#else
+		SseVecD result;
+		result.xy = result.zw = _mm_setzero_pd();
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Loads four doubles into an SseVecD.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vals	Pointer to the four doubles to load, in [x y z w] order.  Need not be aligned.
+	 *
+	 * \return	A SseVecD loaded with the given values.
+	 */
+	SSE_VECD_CALL LoadSseVecD4(const double* vals)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_loadu_pd(vals);
+#else
+		SseVecD result;
+		result.xy = _mm_loadu_pd(vals);
+		result.zw = _mm_loadu_pd(vals + 2);
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Stores the four components of the given SseVecD.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param [out]	vals	Pointer to the four doubles to store into, in [x y z w] order.  Need not be aligned.
+	 * \param	vec	The SseVecD to store.
+	 */
+	inline void StoreSseVecD4(double* vals, const SseVecD& vec)
+	{
+#ifdef SSE_VECD_AVX
+		_mm256_storeu_pd(vals, vec);
+#else
+		_mm_storeu_pd(vals, vec.xy);
+		_mm_storeu_pd(vals + 2, vec.zw);
+#endif
+	}
+
+	/*!
+	 * \brief	Gets the x component of the given SseVecD.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVecD to read from.
+	 *
+	 * \return	The x component, as a scalar double.
+	 */
+	inline double SseVecDGetX(const SseVecD& vec)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm_cvtsd_f64(_mm256_castpd256_pd128(vec));
+#else
+		return _mm_cvtsd_f64(vec.xy);
+#endif
+	}
+
+	/*!
+	 * \brief	Widens the given single-precision SseVec into an SseVecD.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVec to widen.
+	 *
+	 * \return	The SseVecD holding the same four values in double precision.
+	 */
+	SSE_VECD_CALL ToSseVecD(const SseVec& vec)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_cvtps_pd(vec);
+#else
+		SseVecD result;
+		result.xy = _mm_cvtps_pd(vec);
+		result.zw = _mm_cvtps_pd(_mm_movehl_ps(vec, vec));
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Narrows the given SseVecD into a single-precision SseVec.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The SseVecD to narrow.
+	 *
+	 * \return	The SseVec holding the four values rounded to single precision.
+	 */
+	SSE_VEC_CALL ToSseVec(const SseVecD& vec)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_cvtpd_ps(vec);
+#else
+		return _mm_movelh_ps(_mm_cvtpd_ps(vec.xy), _mm_cvtpd_ps(vec.zw));
+#endif
+	}
+
+	/*!
+	 * \brief	Shuffles two values from the left SseVecD into the lower two positions of the result,
+	 *			and two values from the right SseVecD into the upper two positions of the result.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	cX	The index of the coordinate to take from v0 for the x-coordinate of the result.
+	 * \tparam	cY	The index of the coordinate to take from v0 for the y-coordinate of the result.
+	 * \tparam	cZ	The index of the coordinate to take from v1 for the z-coordinate of the result.
+	 * \tparam	cW	The index of the coordinate to take from v1 for the w-coordinate of the result.
+	 *
+	 * \param	v0	The first SseVecD to shuffle values from.
+	 * \param	v1	The second SseVecD to shuffle values from.
+	 *
+	 * \return	An SseVecD containing the values shuffled in from the two respective SseVecDs.
+	 *
+	 * \sa VecShuffle(const SseVec&, const SseVec&)
+	 */
+	template<VecCoord cX, VecCoord cY, VecCoord cZ, VecCoord cW>
+	SSE_VECD_CALL VecShuffle(const SseVecD& v0, const SseVecD& v1)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_blend_pd(
+			_mm256_permute4x64_pd(v0, _MM_SHUFFLE(cW, cZ, cY, cX)),
+			_mm256_permute4x64_pd(v1, _MM_SHUFFLE(cW, cZ, cY, cX)), 0xC);
+#else
+		SseVecD result;
+		result.xy = _mm_shuffle_pd(SelectSseVecDHalf<cX>(v0), SelectSseVecDHalf<cY>(v0), (cX & 1) | ((cY & 1) << 1));
+		result.zw = _mm_shuffle_pd(SelectSseVecDHalf<cZ>(v1), SelectSseVecDHalf<cW>(v1), (cZ & 1) | ((cW & 1) << 1));
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Swizzles the given SseVecD into itself, allowing for mixing and matching of
+	 *			coordinate values.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	cX	The index of the coordinate to put into the x-coordinate of the result.
+	 * \tparam	cY	The index of the coordinate to put into the y-coordinate of the result.
+	 * \tparam	cZ	The index of the coordinate to put into the z-coordinate of the result.
+	 * \tparam	cW	The index of the coordinate to put into the w-coordinate of the result.
+	 *
+	 * \param	vec	The SseVecD being swizzled.
+	 *
+	 * \return	An SseVecD containing the swizzled values.
+	 *
+	 * \sa VecSwizzle(const SseVec&)
+	 */
+	template<VecCoord cX, VecCoord cY, VecCoord cZ, VecCoord cW>
+	SSE_VECD_CALL VecSwizzle(const SseVecD& vec)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_permute4x64_pd(vec, _MM_SHUFFLE(cW, cZ, cY, cX));
+#else
+		return VecShuffle<cX, cY, cZ, cW>(vec, vec);
+#endif
+	}
+
+	/*!
+	 * \brief	Splats one coordinate of the given SseVecD into all four positions of the result.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	c	The index of the coordinate to splat.
+	 * \param	vec	The SseVecD being splatted.
+	 *
+	 * \return	An SseVecD containing four copies of the chosen coordinate.
+	 */
+	template<VecCoord c>
+	SSE_VECD_CALL VecSplat(const SseVecD& vec)
+	{
+		return VecSwizzle<c, c, c, c>(vec);
+	}
+
+	/*!
+	 * \brief	Blends the two given SseVecDs together, selecting values from the left or right
+	 *			arguments depending on the chosen template arguments.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	bX	Whether the x-coordinate comes from the left or right argument.
+	 * \tparam	bY	Whether the y-coordinate comes from the left or right argument.
+	 * \tparam	bZ	Whether the z-coordinate comes from the left or right argument.
+	 * \tparam	bW	Whether the w-coordinate comes from the left or right argument.
+	 *
+	 * \param	left	The left SseVecD argument to blend.
+	 * \param	right	The right SseVecD argument to blend.
+	 *
+	 * \return	An SseVecD containing the blended values.
+	 */
+	template<BlendOrder bX, BlendOrder bY, BlendOrder bZ, BlendOrder bW>
+	SSE_VECD_CALL VecBlend(const SseVecD& left, const SseVecD& right)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_blend_pd(left, right, (((bW) << 3) | ((bZ) << 2) | ((bY) << 1) | ((bX))));
+#else
+		SseVecD result;
+		result.xy = _mm_blend_pd(left.xy, right.xy, (((bY) << 1) | ((bX))));
+		result.zw = _mm_blend_pd(left.zw, right.zw, (((bW) << 1) | ((bZ))));
+		return result;
+#endif
+	}
+
+#ifdef SSE_VECD_AVX
+/*! \cond */
+#define SSE_VECD_BINARY_OP(avxOp, sseOp) return avxOp(v0, v1);
+#define SSE_VECD_UNARY_OP(avxOp, sseOp) return avxOp(vec);
+/*! \endcond */
+#else
+/*! \cond */
+#define SSE_VECD_BINARY_OP(avxOp, sseOp) SseVecD result; result.xy = sseOp(v0.xy, v1.xy); result.zw = sseOp(v0.zw, v1.zw); return result;
+#define SSE_VECD_UNARY_OP(avxOp, sseOp) SseVecD result; result.xy = sseOp(vec.xy); result.zw = sseOp(vec.zw); return result;
+/*! \endcond */
+#endif
+
+	/*!
+	 * \brief	Performs a bitwise "and" on the two given SseVecDs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecAnd(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_and_pd, _mm_and_pd)
+	}
+
+	/*!
+	 * \brief	Performs a bitwise "or" on the two given SseVecDs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecOr(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_or_pd, _mm_or_pd)
+	}
+
+	/*!
+	 * \brief	Performs a bitwise "exclusive or" on the two given SseVecDs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecXOr(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_xor_pd, _mm_xor_pd)
+	}
+
+	/*!
+	 * \brief	Adds two given SseVecDs and returns the sum SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecAdd(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_add_pd, _mm_add_pd)
+	}
+
+	/*!
+	 * \brief	Subtracts two given SseVecDs and returns the difference SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecSub(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_sub_pd, _mm_sub_pd)
+	}
+
+	/*!
+	 * \brief	Subtracts even-indexed positions and adds on odd-indexed positions.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecAddSub(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_addsub_pd, _mm_addsub_pd)
+	}
+
+	/*!
+	 * \brief	Multiplies the two given SseVecDs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecMul(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_mul_pd, _mm_mul_pd)
+	}
+
+	/*!
+	 * \brief	Divides the two given SseVecDs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecDiv(const SseVecD& v0, const SseVecD& v1)
+	{
+		SSE_VECD_BINARY_OP(_mm256_div_pd, _mm_div_pd)
+	}
+
+	/*!
+	 * \brief	Calculates and returns the square root of the given SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecSqrt(const SseVecD& vec)
+	{
+		SSE_VECD_UNARY_OP(_mm256_sqrt_pd, _mm_sqrt_pd)
+	}
+
+	/*!
+	 * \brief	Rounds the components of the given SseVecD toward %%-\\infty%%.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecFloor(const SseVecD& vec)
+	{
+		SSE_VECD_UNARY_OP(_mm256_floor_pd, _mm_floor_pd)
+	}
+
+	/*!
+	 * \brief	Rounds the components of the given SseVecD toward %%\\infty%%.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecCeil(const SseVecD& vec)
+	{
+		SSE_VECD_UNARY_OP(_mm256_ceil_pd, _mm_ceil_pd)
+	}
+
+	/*!
+	 * \brief	Rounds the components of the given SseVecD toward the closest whole number.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecRound(const SseVecD& vec)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_round_pd(vec, _MM_FROUND_TO_NEAREST_INT);
+#else
+		SseVecD result;
+		result.xy = _mm_round_pd(vec.xy, _MM_FROUND_TO_NEAREST_INT);
+		result.zw = _mm_round_pd(vec.zw, _MM_FROUND_TO_NEAREST_INT);
+		return result;
+#endif
+	}
+
+	/*!
+	 * \brief	Compares the two given SseVecDs for "not less-than-or-equal."
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	A mask with all bits set in the positions where v0 is not less than or equal to v1.
+	 */
+	SSE_VECD_CALL VecCmpNLE(const SseVecD& v0, const SseVecD& v1)
+	{
+#ifdef SSE_VECD_AVX
+		return _mm256_cmp_pd(v0, v1, _CMP_NLE_UQ);
+#else
+		SSE_VECD_BINARY_OP(_mm256_cmp_pd, _mm_cmpnle_pd)
+#endif
+	}
+
+#undef SSE_VECD_BINARY_OP
+#undef SSE_VECD_UNARY_OP
+
+	/*!
+	 * \brief	Multiplies two SseVecDs then adds a third.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec4MulAdd(const SseVecD& v0, const SseVecD& v1, const SseVecD& v2)
+	{
+		return VecAdd(VecMul(v0, v1), v2);
+	}
+
+	/*!
+	 * \brief	Adds two SseVecDs representing 3D vectors, keeping the w-coordinate of the second.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec3Add(const SseVecD& v0, const SseVecD& v1)
+	{
+		return VecAdd(VecAnd(v0, SetSseVecDMask(~0ULL, ~0ULL, ~0ULL, 0x0)), v1);
+	}
+
+	/*!
+	 * \brief	Subtracts two SseVecDs representing 3D vectors, keeping the w-coordinate of the first.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec3Sub(const SseVecD& v0, const SseVecD& v1)
+	{
+		return VecSub(v0, VecAnd(v1, SetSseVecDMask(~0ULL, ~0ULL, ~0ULL, 0x0)));
+	}
+
+	/*!
+	 * \brief	Multiplies the given SseVecD representing a 3D vector by the given scalar.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec3MulScalar(const SseVecD& vec, double scalar)
+	{
+		return VecMul(vec, SetSseVecD3(scalar, scalar, scalar));
+	}
+
+	/*!
+	 * \brief	Multiplies the given SseVecD representing a 4D vector by the given scalar.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec4MulScalar(const SseVecD& vec, double scalar)
+	{
+		return VecMul(vec, SetSseVecD4(scalar));
+	}
+
+	/*!
+	 * \brief	Negates the 3D components of the given SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec3Negate(const SseVecD& vec)
+	{
+		return VecXOr(vec, SetSseVecDMask(0x8000000000000000ULL, 0x8000000000000000ULL, 0x8000000000000000ULL, 0x0));
+	}
+
+	/*!
+	 * \brief	Negates the 4D components of the given SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec4Negate(const SseVecD& vec)
+	{
+		return VecXOr(vec, SetSseVecDMask(0x8000000000000000ULL, 0x8000000000000000ULL, 0x8000000000000000ULL, 0x8000000000000000ULL));
+	}
+
+	/*!
+	 * \brief	Calculates the absolute value of the 4D components of the given SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec4Abs(const SseVecD& vec)
+	{
+		return VecAnd(vec, SetSseVecDMask(0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL));
+	}
+
+	/*!
+	 * \brief	Sums all four components of the given SseVecD into all four positions of the result.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL VecSumD(const SseVecD& vec)
+	{
+		SseVecD tmp0 = VecAdd(vec, VecSwizzle<VecCoord::Y, VecCoord::X, VecCoord::W, VecCoord::Z>(vec));
+		return VecAdd(tmp0, VecSwizzle<VecCoord::Z, VecCoord::W, VecCoord::X, VecCoord::Y>(tmp0));
+	}
+
+	/*!
+	 * \brief	Takes the dot product of the two given 2D SseVecDs and loads the resulting value into
+	 *			all four positions in the returned SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec2Dot(const SseVecD& v0, const SseVecD& v1)
+	{
+		SseVecD tmp0 = VecMul(v0, v1);
+		tmp0 = VecAnd(tmp0, SetSseVecDMask(~0ULL, ~0ULL, 0x0, 0x0));
+		return VecSumD(tmp0);
+	}
+
+	/*!
+	 * \brief	Takes the dot product of the two given 3D SseVecDs and loads the resulting value into
+	 *			all four positions in the returned SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec3Dot(const SseVecD& v0, const SseVecD& v1)
+	{
+		SseVecD tmp0 = VecMul(v0, v1);
+		tmp0 = VecAnd(tmp0, SetSseVecDMask(~0ULL, ~0ULL, ~0ULL, 0x0));
+		return VecSumD(tmp0);
+	}
+
+	/*!
+	 * \brief	Takes the dot product of the two given 4D SseVecDs and loads the resulting value into
+	 *			all four positions in the returned SseVecD.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECD_CALL Vec4Dot(const SseVecD& v0, const SseVecD& v1)
+	{
+		return VecSumD(VecMul(v0, v1));
+	}
+
+	/*!
+	 * \brief	Calculates the cross product of the two given 3D SseVecDs.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	v0	The first 3D vector in the cross product.
+	 * \param	v1	The second 3D vector in the cross product.
+	 *
+	 * \return	The cross product of the two given 3D vectors, with a w-coordinate of 1.0.
+	 */
+	SSE_VECD_CALL Vec3Cross(const SseVecD& v0, const SseVecD& v1)
+	{
+		SseVecD tmp0, tmp1, tmp2, tmp3;
+
+		tmp0 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::NA>(v0);
+		tmp1 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::NA>(v1);
+		tmp2 = VecSwizzle<VecCoord::Z, VecCoord::X, VecCoord::Y, VecCoord::NA>(v0);
+		tmp3 = VecSwizzle<VecCoord::Y, VecCoord::Z, VecCoord::X, VecCoord::NA>(v1);
+
+		tmp0 = VecMul(tmp0, tmp1);
+		tmp2 = VecMul(tmp2, tmp3);
+
+		tmp0 = VecSub(tmp0, tmp2);
+
+		return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(tmp0, SetSseVecD4(0.0, 0.0, 0.0, 1.0));
+	}
+
+	/*!
+	 * \brief	Calculates the normalized form of the given 3D SseVecD.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The 3D vector to find the normalized form of.
+	 *
+	 * \return	The normalized form of the given 3D vector, or the zero vector if its length is zero.
+	 */
+	SSE_VECD_CALL Vec3Normalize(const SseVecD& vec)
+	{
+		SseVecD length = VecSqrt(Vec3Dot(vec, vec));
+		SseVecD zeroMask = VecCmpNLE(length, SetVecDZero());
+		SseVecD result = VecAnd(zeroMask, VecDiv(vec, length));
+
+		return VecBlend<BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::LEFT, BlendOrder::RIGHT>(result, SetSseVecD4(0.0, 0.0, 0.0, 1.0));
+	}
+
+	/*!
+	 * \brief	Calculates the normalized form of the given 4D SseVecD.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The 4D vector to find the normalized form of.
+	 *
+	 * \return	The normalized form of the given 4D vector, or the zero vector if its length is zero.
+	 */
+	SSE_VECD_CALL Vec4Normalize(const SseVecD& vec)
+	{
+		SseVecD length = VecSqrt(Vec4Dot(vec, vec));
+		SseVecD zeroMask = VecCmpNLE(length, SetVecDZero());
+
+		return VecAnd(zeroMask, VecDiv(vec, length));
+	}
+
+	/*! @} */
+}
+
+#endif // SSE_VECD_DOT_H
@@ -0,0 +1,445 @@
+#ifndef SSE_VECI_DOT_H
+#define SSE_VECI_DOT_H
+#include "ssevec_math_defs.h"
+#include "ssevec.h"
+#include <stdint.h>
+
+/*!
+ * \file
+ */
+
+/*!
+ * \defgroup SIMDVecIMath SIMD Integer Vector Math
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SIMDVecIMath
+	 * @{
+	 */
+
+	/*!
+	 * \typedef	__m128i SseVecI
+	 *
+	 * \brief	Defines an alias representing four signed 32-bit integers in an SSE register.
+	 *
+	 * \remarks	Follows the same [x y z w] ordering conventions as SseVec.
+	 */
+	typedef __m128i SseVecI;
+
+/*!
+ * \def	SSE_VECI_CALL();
+ *
+ * \brief The calling convention for most SseVecI functions.
+ */
+#define SSE_VECI_CALL inline SseVecI
+
+	/*!
+	 * \brief	Sets the SseVecI to represent a 4-component vector, with the given integer components.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	x	The x component.
+	 * \param	y	The y component.
+	 * \param	z	The z component.
+	 * \param	w	The w component.
+	 *
+	 * \return	A SseVecI representation of a 4-component vector, using the given components.
+	 */
+	SSE_VECI_CALL SetSseVecI4(int32_t x, int32_t y, int32_t z, int32_t w)
+	{
+		return _mm_set_epi32(w, z, y, x);
+	}
+
+	/*!
+	 * \brief	Sets the SseVecI with all four components set to the given value.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	xyzw	The integer value to load in all four components.
+	 *
+	 * \return	A SseVecI with the given value in all four components.
+	 */
+	SSE_VECI_CALL SetSseVecI4(int32_t xyzw)
+	{
+		return _mm_set1_epi32(xyzw);
+	}
+
+	/*!
+	 * \brief	Sets and returns an SseVecI with all 0 values.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	An SseVecI containing all 0 values.
+	 */
+	SSE_VECI_CALL SetVecIZero()
+	{
+		return _mm_setzero_si128();
+	}
+
+	/*!
+	 * \brief	Loads four 32-bit integers into an SseVecI.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vals	Pointer to the four integers to load, in [x y z w] order.  Need not be aligned.
+	 *
+	 * \return	A SseVecI loaded with the given values.
+	 */
+	SSE_VECI_CALL LoadSseVecI4(const int32_t* vals)
+	{
+		return _mm_loadu_si128((const __m128i*)vals);
+	}
+
+	/*!
+	 * \brief	Stores the four components of the given SseVecI.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param [out]	vals	Pointer to the four integers to store into, in [x y z w] order.  Need not be aligned.
+	 * \param	vec	The SseVecI to store.
+	 */
+	inline void StoreSseVecI4(int32_t* vals, const SseVecI& vec)
+	{
+		_mm_storeu_si128((__m128i*)vals, vec);
+	}
+
+	/*!
+	 * \brief	Swizzles the given SseVecI into itself, allowing for mixing and matching of
+	 *			coordinate values.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	cX	The index of the coordinate to put into the x-coordinate of the result.
+	 * \tparam	cY	The index of the coordinate to put into the y-coordinate of the result.
+	 * \tparam	cZ	The index of the coordinate to put into the z-coordinate of the result.
+	 * \tparam	cW	The index of the coordinate to put into the w-coordinate of the result.
+	 *
+	 * \param	vec	The SseVecI being swizzled.
+	 *
+	 * \return	An SseVecI containing the swizzled values.
+	 */
+	template<VecCoord cX, VecCoord cY, VecCoord cZ, VecCoord cW>
+	SSE_VECI_CALL VecSwizzle(const SseVecI& vec)
+	{
+		return _mm_shuffle_epi32(vec, _MM_SHUFFLE(cW, cZ, cY, cX));
+	}
+
+	/*!
+	 * \brief	Splats one coordinate of the given SseVecI into all four positions of the result.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	c	The index of the coordinate to splat.
+	 * \param	vec	The SseVecI being splatted.
+	 *
+	 * \return	An SseVecI containing four copies of the chosen coordinate.
+	 */
+	template<VecCoord c>
+	SSE_VECI_CALL VecSplat(const SseVecI& vec)
+	{
+		return _mm_shuffle_epi32(vec, _MM_SHUFFLE(c, c, c, c));
+	}
+
+	/*!
+	 * \brief	Performs a bitwise "and" on the two given SseVecIs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecAnd(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_and_si128(v0, v1);
+	}
+
+	/*!
+	 * \brief	Performs a bitwise "or" on the two given SseVecIs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecOr(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_or_si128(v0, v1);
+	}
+
+	/*!
+	 * \brief	Performs a bitwise "exclusive or" on the two given SseVecIs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecXOr(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_xor_si128(v0, v1);
+	}
+
+	/*!
+	 * \brief	Adds two given SseVecIs, wrapping on overflow.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecAdd(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_add_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Subtracts two given SseVecIs, wrapping on overflow.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecSub(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_sub_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Multiplies two given SseVecIs, keeping the low 32 bits of each product.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecMul(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_mullo_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Calculates the component-wise minimum of the two given SseVecIs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecMin(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_min_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Calculates the component-wise maximum of the two given SseVecIs.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL VecMax(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_max_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Shifts each component of the given SseVecI left by a constant number of bits.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	count	The number of bits to shift by.
+	 */
+	template<int count>
+	SSE_VECI_CALL VecShiftLeft(const SseVecI& vec)
+	{
+		return _mm_slli_epi32(vec, count);
+	}
+
+	/*!
+	 * \brief	Shifts each component of the given SseVecI right by a constant number of bits,
+	 *			copying the sign bit in (arithmetic shift).
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	count	The number of bits to shift by.
+	 */
+	template<int count>
+	SSE_VECI_CALL VecShiftRight(const SseVecI& vec)
+	{
+		return _mm_srai_epi32(vec, count);
+	}
+
+	/*!
+	 * \brief	Shifts each component of the given SseVecI right by a constant number of bits,
+	 *			shifting zeros in (logical shift).
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	count	The number of bits to shift by.
+	 */
+	template<int count>
+	SSE_VECI_CALL VecShiftRightLogical(const SseVecI& vec)
+	{
+		return _mm_srli_epi32(vec, count);
+	}
+
+	/*!
+	 * \brief	Compares the two given SseVecIs for equality.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	A mask with all bits set in the positions where v0 equals v1.
+	 */
+	SSE_VECI_CALL VecCmpEQ(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_cmpeq_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Compares the two given SseVecIs for "greater-than."
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	A mask with all bits set in the positions where v0 is greater than v1.
+	 */
+	SSE_VECI_CALL VecCmpGT(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_cmpgt_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Compares the two given SseVecIs for "less-than."
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	A mask with all bits set in the positions where v0 is less than v1.
+	 */
+	SSE_VECI_CALL VecCmpLT(const SseVecI& v0, const SseVecI& v1)
+	{
+		return _mm_cmplt_epi32(v0, v1);
+	}
+
+	/*!
+	 * \brief	Reinterprets the bits of the given SseVec as an SseVecI, without conversion.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VECI_CALL AsSseVecI(const SseVec& vec)
+	{
+		return _mm_castps_si128(vec);
+	}
+
+	/*!
+	 * \brief	Reinterprets the bits of the given SseVecI as an SseVec, without conversion.
+	 *
+	 * \remarks	Useful for using SseVecI comparison masks with the SseVec bitwise functions.
+	 *
+	 * \date	10/18/2026
+	 */
+	SSE_VEC_CALL AsSseVec(const SseVecI& vec)
+	{
+		return _mm_castsi128_ps(vec);
+	}
+
+	/*!
+	 * \brief	Converts the given SseVecI into an SseVec.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The integer vector to convert.
+	 *
+	 * \return	The SseVec holding the four integers as floats.
+	 */
+	SSE_VEC_CALL ToSseVec(const SseVecI& vec)
+	{
+		return _mm_cvtepi32_ps(vec);
+	}
+
+	/*!
+	 * \brief	Converts the given SseVec into an SseVecI, truncating toward zero.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The float vector to convert.
+	 *
+	 * \return	The SseVecI holding the four truncated values.
+	 *
+	 * \remarks	Out-of-range values and NaNs produce 0x80000000.
+	 */
+	SSE_VECI_CALL ToSseVecI(const SseVec& vec)
+	{
+		return _mm_cvttps_epi32(vec);
+	}
+
+	/*!
+	 * \brief	Rounds the components of the given SseVec toward %%-\\infty%%, and converts them to integers.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The float vector to convert.
+	 *
+	 * \return	The SseVecI holding the same values as ToSseVec(VecFloor(vec)) would.
+	 *
+	 * \sa VecFloor(const SseVec&)
+	 */
+	SSE_VECI_CALL VecFloorToInt(const SseVec& vec)
+	{
+		return _mm_cvttps_epi32(VecFloor(vec));
+	}
+
+	/*!
+	 * \brief	Rounds the components of the given SseVec toward %%\\infty%%, and converts them to integers.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The float vector to convert.
+	 *
+	 * \return	The SseVecI holding the same values as ToSseVec(VecCeil(vec)) would.
+	 *
+	 * \sa VecCeil(const SseVec&)
+	 */
+	SSE_VECI_CALL VecCeilToInt(const SseVec& vec)
+	{
+		return _mm_cvttps_epi32(VecCeil(vec));
+	}
+
+	/*!
+	 * \brief	Rounds the components of the given SseVec toward the closest whole number, and
+	 *			converts them to integers.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	vec	The float vector to convert.
+	 *
+	 * \return	The SseVecI holding the same values as ToSseVec(VecRound(vec)) would.
+	 *
+	 * \sa VecRound(const SseVec&)
+	 */
+	SSE_VECI_CALL VecRoundToInt(const SseVec& vec)
+	{
+		return _mm_cvttps_epi32(VecRound(vec));
+	}
+
+	/*!
+	 * \brief	Calculates the integer grid cell that contains the given position.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	pos	The position to look up.
+	 * \param	invCellSize	The reciprocal of the cell size along each axis.
+	 *
+	 * \return	The integer coordinates of the grid cell containing the given position.
+	 */
+	SSE_VECI_CALL GridCellFromPosition(const SseVec& pos, const SseVec& invCellSize)
+	{
+		return VecFloorToInt(VecMul(pos, invCellSize));
+	}
+
+	/*!
+	 * \brief	Hashes the given 3D integer grid cell coordinates.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	cell	The grid cell coordinates to hash.  The w-coordinate is ignored.
+	 *
+	 * \return	An SseVecI holding the hash value in all four positions.
+	 *
+	 * \remarks	Uses the spatial hash of Teschner et al., <CODE>(x * p1) xor (y * p2) xor (z * p3)</CODE>.
+	 *			The caller reduces the result to a table index, e.g. by masking with a power of two minus one.
+	 */
+	SSE_VECI_CALL Vec3GridHash(const SseVecI& cell)
+	{
+		SseVecI tmp0 = VecMul(cell, SetSseVecI4(73856093, 19349663, 83492791, 0));
+		tmp0 = VecXOr(tmp0, VecSwizzle<VecCoord::Z, W, X, Y>(tmp0));// (x ^ z) y (x ^ z) y
+		return VecXOr(tmp0, VecSwizzle<VecCoord::Y, X, W, Z>(tmp0));
+	}
+
+	/*! @} */
+}
+
+#endif // SSE_VECI_DOT_H
@@ -39,7 +39,7 @@ namespace gofxmath
 		 *
 		 * \date	2/21/2015
 		 */
-		Vec2();
+		constexpr Vec2() : x(0.0f), y(0.0f) {}
 
 		/*!
 		 * \brief	Constructor taking a single float argument that will be copied into both component values.
@@ -48,7 +48,7 @@ namespace gofxmath
 		 *
 		 * \param	xy	The value of the x and y-coordinate components of this Vec3.
 		 */
-		Vec2(float xy);
+		constexpr Vec2(float xy) : x(xy), y(xy) {}
 
 		/*!
 		 * \brief	Constructs a Vec2 with the given x and y values assigned to their respective
@@ -59,7 +59,7 @@ namespace gofxmath
 		 * \param	x	The x coordinate of the resulting Vec2.
 		 * \param	y	The y coordinate of the resulting Vec2.
 		 */
-		Vec2(float x, float y);
+		constexpr Vec2(float x, float y) : x(x), y(y) {}
 
 		/*!
 		 * \brief	A function that writes the given 2D vector to the given output stream.
@@ -166,15 +166,15 @@ namespace gofxmath
 		};
 		//! \endcond
 
-		static Vec2 Right();	/*!< The right direction Vec2 */
-		static Vec2 Up();   /*!< The up direction Vec2 */
-		static Vec2 Left(); /*!< The left direction Vec2 */
-		static Vec2 Down(); /*!< The down direction Vec2 */
+		static constexpr Vec2 Right() { return Vec2(1.0f, 0.0f); }	/*!< The right direction Vec2 */
+		static constexpr Vec2 Up() { return Vec2(0.0f, 1.0f); }	/*!< The up direction Vec2 */
+		static constexpr Vec2 Left() { return Vec2(-1.0f, 0.0f); }	/*!< The left direction Vec2 */
+		static constexpr Vec2 Down() { return Vec2(0.0f, -1.0f); }	/*!< The down direction Vec2 */
 
-		static Vec2 One();  /*!< The Vec2 with both components set to 1.0f */
-		static Vec2 NegOne();  /*!< The Vec2 with both components set to -1.0f */
+		static constexpr Vec2 One() { return Vec2(1.0f); }	/*!< The Vec2 with both components set to 1.0f */
+		static constexpr Vec2 NegOne() { return Vec2(-1.0f); }	/*!< The Vec2 with both components set to -1.0f */
 
-		static Vec2 Zero(); /*!< The zero Vec2 */
+		static constexpr Vec2 Zero() { return Vec2(0.0f); }	/*!< The zero Vec2 */
 	};
 
 	/*! @} */
@@ -4,6 +4,7 @@
 #include <array>
 #include <iostream>
 #include "sisd_defns.h"
+#include "vec2.h"
 
 /*! \file 
  */
@@ -15,7 +16,6 @@
  */
 namespace gofxmath
 {
-	class Vec2;
 	class Vec4;
 
 
@@ -38,7 +38,7 @@ namespace gofxmath
 		 *
 		 * \date	2/22/2015
 		 */
-		Vec3();
+		constexpr Vec3() : x(0.0f), y(0.0f), z(0.0f) {}
 
 		/*!
 		 * \brief	Constructs a Vec3 with the given x, y, and z values assigned to their respective
@@ -50,7 +50,7 @@ namespace gofxmath
 		 * \param	y	The y coordinate to load into this Vec3.
 		 * \param	z	The z coordinate to load into this Vec3.
 		 */
-		Vec3(float x, float y, float z);
+		constexpr Vec3(float x, float y, float z) : x(x), y(y), z(z) {}
 
 		/*!
 		 * \brief	Constructor.
@@ -60,7 +60,7 @@ namespace gofxmath
 		 * \param	xy	The value of the x and y-coordinate components of this Vec3.
 		 * \param	z 	The value to load into the z-cordinate of this Vec3.
 		 */
-		Vec3(const Vec2& xy, float z);
+		constexpr Vec3(const Vec2& xy, float z) : x(xy.x), y(xy.y), z(z) {}
 
 		/*!
 		 * \brief	Constructor.
@@ -70,7 +70,7 @@ namespace gofxmath
 		 * \param	x 	The x-coordinate of this Vec3.
 		 * \param	yz	The value of the y and z-coordinate components of this Vec3.
 		 */
-		Vec3(float x, const Vec2& yz);
+		constexpr Vec3(float x, const Vec2& yz) : x(x), y(yz.x), z(yz.y) {}
 
 		/*!
 		 * \brief	Constructor taking a single float argument that will be copied into all three component values.
@@ -79,7 +79,7 @@ namespace gofxmath
 		 *
 		 * \param	xyz	The value of the x, y, and z-coordinate components of this Vec3.
 		 */
-		Vec3(float xyz);
+		constexpr Vec3(float xyz) : x(xyz), y(xyz), z(xyz) {}
 
 		/*!
 		 * \brief	A function that writes the given 3D vector to the given output stream.
@@ -194,17 +194,17 @@ namespace gofxmath
 		};
 		//! \endcond
 
-		static Vec3 Right();	/*!< The Vec3 right direction vector*/
-		static Vec3 Up();   /*!< The Vec3 up direction vector */
-		static Vec3 Forward();  /*!< The forward Vec3 direction vector */
-		static Vec3 Left(); /*!< The Vec3 left direction vector */
-		static Vec3 Down(); /*!< The Vec3 down direction vector */
-		static Vec3 Back(); /*!< The Vec3 back direction vector */
+		static constexpr Vec3 Right() { return Vec3(1.0f, 0.0f, 0.0f); }	/*!< The Vec3 right direction vector*/
+		static constexpr Vec3 Up() { return Vec3(0.0f, 1.0f, 0.0f); }	/*!< The Vec3 up direction vector */
+		static constexpr Vec3 Forward() { return Vec3(0.0f, 0.0f, 1.0f); }	/*!< The forward Vec3 direction vector */
+		static constexpr Vec3 Left() { return Vec3(-1.0f, 0.0f, 0.0f); }	/*!< The Vec3 left direction vector */
+		static constexpr Vec3 Down() { return Vec3(0.0f, -1.0f, 0.0f); }	/*!< The Vec3 down direction vector */
+		static constexpr Vec3 Back() { return Vec3(0.0f, 0.0f, -1.0f); }	/*!< The Vec3 back direction vector */
 
-		static Vec3 One();  /*!< The Vec3 one vector (all components are 1.0f) */
-		static Vec3 NegOne();  /*!< The Vec3 negative one vector (all components are -1.0f) */
+		static constexpr Vec3 One() { return Vec3(1.0f); }	/*!< The Vec3 one vector (all components are 1.0f) */
+		static constexpr Vec3 NegOne() { return Vec3(-1.0f); }	/*!< The Vec3 negative one vector (all components are -1.0f) */
 
-		static Vec3 Zero(); /*!< The Vec3 zero vector (all components are 0.0f) */
+		static constexpr Vec3 Zero() { return Vec3(0.0f); }	/*!< The Vec3 zero vector (all components are 0.0f) */
 	};
 
 	/*! @} */
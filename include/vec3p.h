@@ -0,0 +1,194 @@
+#ifndef VEC3P_DOT_H
+#define VEC3P_DOT_H
+
+#include "sisd_defns.h"
+#include "vec3.h"
+#include <cstddef>
+
+/*! \file
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup SISDVecMath
+	 * @{
+	 */
+
+	/*!
+	 * \class Vec3P
+	 *
+	 * \brief	A packed 3-component vector, for storage in vertex and point buffers.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	Vec3 is 16-byte aligned, so an array of them spends a quarter of its memory (and of the
+	 *			bandwidth to stream it) on padding.  Vec3P is exactly 12 bytes with no alignment
+	 *			requirement beyond that of a float, so arrays of it match the tightly packed layouts that
+	 *			GPU vertex formats and file formats expect.
+	 *
+	 *			It converts implicitly to Vec3 for the SISD functions, and explicitly back.  Use
+	 *			LoadSseVec3P and StoreSseVec3P for single vectors, and the Vec3P batch functions (such as
+	 *			LoadSseVec3PBatch and TransformVec3PBatch) to stream whole arrays.
+	 */
+	class Vec3P
+	{
+	public:
+
+		/*!
+		 * \brief	Constructs a Vec3P with all three components being initialized to 0.0f.
+		 *
+		 * \date	10/18/2026
+		 */
+		constexpr Vec3P() : x(0.0f), y(0.0f), z(0.0f) {}
+
+		/*!
+		 * \brief	Constructs a Vec3P with the given x, y, and z values assigned to their respective
+		 * 			components.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	x	The x coordinate to load into this Vec3P.
+		 * \param	y	The y coordinate to load into this Vec3P.
+		 * \param	z	The z coordinate to load into this Vec3P.
+		 */
+		constexpr Vec3P(float x, float y, float z) : x(x), y(y), z(z) {}
+
+		/*!
+		 * \brief	Constructs a Vec3P with the components of the given Vec3.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	vec	The Vec3 to pack.
+		 */
+		constexpr explicit Vec3P(const Vec3& vec) : x(vec.x), y(vec.y), z(vec.z) {}
+
+		/*!
+		 * \brief	Implicit cast that unpacks this Vec3P into a Vec3.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \return	The Vec3 with the same components.
+		 */
+		constexpr operator Vec3() const
+		{
+			return Vec3(x, y, z);
+		}
+
+		/*!
+		 * \brief	Equality operator.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	left 	The first instance to compare.
+		 * \param	right	The second instance to compare.
+		 *
+		 * \return	true if the parameters are considered equivalent (as Vec3s).
+		 */
+		friend bool operator==(const Vec3P& left, const Vec3P& right)
+		{
+			return Vec3(left) == Vec3(right);
+		}
+
+		/*!
+		 * \brief	Inequality operator.
+		 *
+		 * \date	10/18/2026
+		 *
+		 * \param	left 	The first instance to compare.
+		 * \param	right	The second instance to compare.
+		 *
+		 * \return	true if the parameters are not considered equivalent.
+		 */
+		friend bool operator!=(const Vec3P& left, const Vec3P& right)
+		{
+			return !(left == right);
+		}
+
+		//! \cond
+		union {
+		//! \endcond
+
+			float vals[3];  /*!< The 3 components of the Vec3P
+							 *
+							 *	 \remarks Points to the same values as the x, y
+							 *			  and z components (at indices 0, 1,
+							 *			  and 2, respectively).
+							 */
+
+			//! \cond
+			struct {
+			//! \endcond
+
+				float x;	/*!< The x-coordinate
+							 *
+							 * \remarks Equivalent to <B>vals[0]</B>.
+							 */
+
+				float y;	/*!< The y-coordinate
+							 *
+							 *	\remarks Equivalent to <B>vals[1]</B>.
+							 */
+
+				float z;	/*!< The z-coordinate
+							 *
+							 * \remarks Equivalent to <B>vals[2]</B>.
+							 */
+
+			//! \cond
+			};
+		};
+		//! \endcond
+	};
+
+	static_assert(sizeof(Vec3P) == 3 * sizeof(float), "Vec3P must pack into 12 bytes");
+
+	/*!
+	 * \brief	Gets the address of one attribute of one vertex in an interleaved vertex buffer.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	T	The type of the attribute (such as Vec3P for a position or normal).
+	 * \param	base  	The start of the buffer.
+	 * \param	stride	The size of one vertex, in bytes.
+	 * \param	offset	The offset of the attribute within a vertex, in bytes.
+	 * \param	index 	The index of the vertex.
+	 *
+	 * \return	The address of the attribute, %%base + offset + index * stride%%.
+	 *
+	 * \remarks	The same base/stride/offset triple that glVertexAttribPointer takes, so a vertex class such
+	 *			as the demo's ColorVertexNorm is described with sizeof and offsetof.
+	 */
+	template<typename T>
+	inline T* StridedAttribute(void* base, size_t stride, size_t offset, size_t index)
+	{
+		return reinterpret_cast<T*>(static_cast<char*>(base) + offset + index * stride);
+	}
+
+	/*!
+	 * \brief	Gets the address of one attribute of one vertex in a read-only interleaved vertex buffer.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	T	The type of the attribute (such as Vec3P for a position or normal).
+	 * \param	base  	The start of the buffer.
+	 * \param	stride	The size of one vertex, in bytes.
+	 * \param	offset	The offset of the attribute within a vertex, in bytes.
+	 * \param	index 	The index of the vertex.
+	 *
+	 * \return	The address of the attribute, %%base + offset + index * stride%%.
+	 */
+	template<typename T>
+	inline const T* StridedAttribute(const void* base, size_t stride, size_t offset, size_t index)
+	{
+		return reinterpret_cast<const T*>(static_cast<const char*>(base) + offset + index * stride);
+	}
+
+	/*! @} */
+}
+#endif // VEC3P_DOT_H
@@ -4,6 +4,8 @@
 #include <array>
 #include <iostream>
 #include "sisd_defns.h"
+#include "vec2.h"
+#include "vec3.h"
 
 /*! 
  * \file 
@@ -16,8 +18,6 @@
  */
 namespace gofxmath
 {
-	class Vec2;
-	class Vec3;
 	class Quaternion;
 
 	/*!
@@ -40,7 +40,7 @@ namespace gofxmath
 		 *
 		 * \date	2/22/2015
 		 */
-		Vec4();
+		constexpr Vec4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
 
 		/*!
 		 * \fn	Vec4(float xyzw);
@@ -51,7 +51,7 @@ namespace gofxmath
 		 *
 		 * \param	xyzw	The value that will be copied into the x, y, z, and w components.
 		 */
-		Vec4(float xyzw);
+		constexpr Vec4(float xyzw) : x(xyzw), y(xyzw), z(xyzw), w(xyzw) {}
 
 		/*!
 		 * \fn	Vec4(float x, float y, float z, float w);
@@ -65,7 +65,7 @@ namespace gofxmath
 		 * \param	z	The z-coordinate component value  of this Vec4.
 		 * \param	w	The w-coordinate component value  of this Vec4.
 		 */
-		Vec4(float x, float y, float z, float w);
+		constexpr Vec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
 
 		/*!
 		 * \fn	Vec4(const Vec2& xy, const Vec2& zw);
@@ -77,7 +77,7 @@ namespace gofxmath
 		 * \param	xy	The Vec2 that will contribute its components to the x and y-coordinate components of this Vec4.
 		 * \param	zw	The Vec2 that will contribute its components to the z and w-coordinate components of this Vec4.
 		 */
-		Vec4(const Vec2& xy, const Vec2& zw);
+		constexpr Vec4(const Vec2& xy, const Vec2& zw) : x(xy.x), y(xy.y), z(zw.x), w(zw.y) {}
 
 		/*!
 		 * \fn	Vec4(const Vec2& xy, float z, float w);
@@ -90,7 +90,7 @@ namespace gofxmath
 		 * \param	z 	The z-coordinate component value of this Vec4.
 		 * \param	w 	The w-coordinate component value of this Vec4.
 		 */
-		Vec4(const Vec2& xy, float z, float w);
+		constexpr Vec4(const Vec2& xy, float z, float w) : x(xy.x), y(xy.y), z(z), w(w) {}
 
 		/*!
 		 * \fn	Vec4(float x, const Vec2& yz, float w);
@@ -103,7 +103,7 @@ namespace gofxmath
 		 * \param	yz	The Vec2 that will contribute its components to the y and z-coordinate components of this Vec4.
 		 * \param	w 	The w-coordinate component value of this Vec4.
 		 */
-		Vec4(float x, const Vec2& yz, float w);
+		constexpr Vec4(float x, const Vec2& yz, float w) : x(x), y(yz.x), z(yz.y), w(w) {}
 
 		/*!
 		 * \fn	Vec4(float x, float y, const Vec2& zw);
@@ -116,7 +116,7 @@ namespace gofxmath
 		 * \param	y 	The y-coordinate component value of this Vec4.
 		 * \param	zw	The Vec2 that will contribute its components to the z and w-coordinate components of this Vec4.
 		 */
-		Vec4(float x, float y, const Vec2& zw);
+		constexpr Vec4(float x, float y, const Vec2& zw) : x(x), y(y), z(zw.x), w(zw.y) {}
 
 		/*!
 		 * \fn	Vec4(const Vec3& xyz, float w);
@@ -128,7 +128,7 @@ namespace gofxmath
 		 * \param	xyz	The Vec3 that will contribute its components to the x, y and z-coordinate components of this Vec4.
 		 * \param	w  	The w-coordinate component value of this Vec4.
 		 */
-		Vec4(const Vec3& xyz, float w);
+		constexpr Vec4(const Vec3& xyz, float w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
 
 		/*!
 		 * \fn	Vec4(float x, const Vec3& yzw);
@@ -140,7 +140,7 @@ namespace gofxmath
 		 * \param	x  	The x-coordinate component value of this Vec4.
 		 * \param	yzw	The Vec3 that will contribute its components to the y, z and w-coordinate components of this Vec4.
 		 */
-		Vec4(float x, const Vec3& yzw);
+		constexpr Vec4(float x, const Vec3& yzw) : x(x), y(yzw.x), z(yzw.y), w(yzw.z) {}
 
 		/*!
 		 * \fn	friend std::ostream &operator<< (std::ostream& stream, const Vec4& vec);
@@ -273,22 +273,22 @@ namespace gofxmath
 		};
 		//! \endcond
 
-		static Vec4 E0();   /*!< The elementary vector with components <1 0 0 0> */
-		static Vec4 E1();   /*!< The elementary vector with components <0 1 0 0> */
-		static Vec4 E2();   /*!< The elementary vector with components <0 0 1 0> */
-		static Vec4 E3();   /*!< The elementary vector with components <0 0 0 1> */
-		static Vec4 E(int i); /*!< The array of elementary 4-component vectors */
+		static constexpr Vec4 E0() { return Vec4(1.0f, 0.0f, 0.0f, 0.0f); }	/*!< The elementary vector with components <1 0 0 0> */
+		static constexpr Vec4 E1() { return Vec4(0.0f, 1.0f, 0.0f, 0.0f); }	/*!< The elementary vector with components <0 1 0 0> */
+		static constexpr Vec4 E2() { return Vec4(0.0f, 0.0f, 1.0f, 0.0f); }	/*!< The elementary vector with components <0 0 1 0> */
+		static constexpr Vec4 E3() { return Vec4(0.0f, 0.0f, 0.0f, 1.0f); }	/*!< The elementary vector with components <0 0 0 1> */
+		static constexpr Vec4 E(int i) { return i == 0 ? E0() : i == 1 ? E1() : i == 2 ? E2() : E3(); }	/*!< The ith elementary 4-component vector */
 
-		static Vec4 NegE0();   /*!< The negative form of the first elementary vector (takes the form <-1 0 0 0>) */
-		static Vec4 NegE1();   /*!< The negative form of the second elementary vector (takes the form <0 -1 0 0>) */
-		static Vec4 NegE2();   /*!< The negative form of the third elementary vector (takes the form < 0 0 -1 0>) */
-		static Vec4 NegE3();   /*!< The negative form of the fourth elementary vector (takes the form <0 0 0 -1>) */
-		static Vec4 NegE(int i); /*!< The array of negated elementary 4-component vectors */
+		static constexpr Vec4 NegE0() { return Vec4(-1.0f, 0.0f, 0.0f, 0.0f); }	/*!< The negative form of the first elementary vector (takes the form <-1 0 0 0>) */
+		static constexpr Vec4 NegE1() { return Vec4(0.0f, -1.0f, 0.0f, 0.0f); }	/*!< The negative form of the second elementary vector (takes the form <0 -1 0 0>) */
+		static constexpr Vec4 NegE2() { return Vec4(0.0f, 0.0f, -1.0f, 0.0f); }	/*!< The negative form of the third elementary vector (takes the form < 0 0 -1 0>) */
+		static constexpr Vec4 NegE3() { return Vec4(0.0f, 0.0f, 0.0f, -1.0f); }	/*!< The negative form of the fourth elementary vector (takes the form <0 0 0 -1>) */
+		static constexpr Vec4 NegE(int i) { return i == 0 ? NegE0() : i == 1 ? NegE1() : i == 2 ? NegE2() : NegE3(); }	/*!< The ith negated elementary 4-component vector */
 
-		static Vec4 One();  /*!< The 4-component vector containing the values <1 1 1 1> */
-		static Vec4 NegOne();  /*!< The 4-component vector containing the values <-1 -1 -1 -1> */
+		static constexpr Vec4 One() { return Vec4(1.0f); }	/*!< The 4-component vector containing the values <1 1 1 1> */
+		static constexpr Vec4 NegOne() { return Vec4(-1.0f); }	/*!< The 4-component vector containing the values <-1 -1 -1 -1> */
 
-		static Vec4 Zero(); /*!< The 4-component zero vector (takes the form <0 0 0 0> */
+		static constexpr Vec4 Zero() { return Vec4(0.0f); }	/*!< The 4-component zero vector (takes the form <0 0 0 0> */
 	};
 
 	/*! @} */
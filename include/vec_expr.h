@@ -0,0 +1,684 @@
+#ifndef VEC_EXPR_DOT_H
+#define VEC_EXPR_DOT_H
+
+#include <cstddef>
+#include <type_traits>
+#include "ssevec.h"
+#include "ssemat44.h"
+#include "matmath.h"
+
+/*!
+ * \file
+ */
+
+/*!
+ * \defgroup VecExpr Vector Expression Templates
+ */
+
+/*!
+ * \namespace	gofxmath
+ *
+ * \brief	G of F of X math namespace.
+ */
+namespace gofxmath
+{
+	/*!
+	 * \ingroup VecExpr
+	 * @{
+	 */
+
+	/*!
+	 * \enum	VecExprOp
+	 *
+	 * \brief	The component-wise operations that a VecBinaryExpr can apply.
+	 */
+	enum class VecExprOp
+	{
+		ADD,/*!< Component-wise addition. */
+		SUB,/*!< Component-wise subtraction. */
+		MUL,/*!< Component-wise multiplication. */
+		DIV/*!< Component-wise division (PrecisionPolicy::EXACT). */
+	};
+
+	/*!
+	 * \struct	VecExprBase
+	 *
+	 * \brief	Empty tag base shared by every vector expression node.
+	 *
+	 * \date	10/18/2026
+	 */
+	struct VecExprBase {};
+
+	/*!
+	 * \struct	VecExprResult
+	 *
+	 * \brief	Maps an expression size to the value type it evaluates to.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	N	3 for Vec3, 4 for Vec4, 0 for a broadcast scalar.
+	 */
+	template<size_t N>
+	struct VecExprResult;
+
+	//! \cond
+	template<>
+	struct VecExprResult<0>
+	{
+		typedef float Type;
+		static float Store(const SseVec& vec) { return _mm_cvtss_f32(vec); }
+	};
+
+	template<>
+	struct VecExprResult<3>
+	{
+		typedef Vec3 Type;
+		static Vec3 Store(const SseVec& vec) { return StoreSseVec3(vec); }
+	};
+
+	template<>
+	struct VecExprResult<4>
+	{
+		typedef Vec4 Type;
+		static Vec4 Store(const SseVec& vec) { return StoreSseVec4(vec); }
+	};
+	//! \endcond
+
+	/*!
+	 * \class	VecExpr
+	 *
+	 * \brief	CRTP base for lazily evaluated vector expressions.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	Derived	The concrete expression node.
+	 * \tparam	N		3 or 4 for 3D/4D vector expressions, 0 for scalar expressions
+	 *					(which evaluate to a broadcast SseVec).
+	 *
+	 * \remarks	Each node provides <CODE>SseVec Eval(size_t i) const</CODE>, where \p i is the
+	 *			element index used by array leaves; value leaves ignore it. Nothing is computed
+	 *			until the expression is converted to its result type, passed to Evaluate or
+	 *			passed to EvaluateBatch, so a chain of operations is fused into one pass of
+	 *			register-resident SSE instructions.
+	 */
+	template<typename Derived, size_t N>
+	class VecExpr : public VecExprBase
+	{
+	public:
+		static const size_t SIZE = N;/*!< The expression size (3, 4, or 0 for a scalar). */
+
+		typedef typename VecExprResult<N>::Type ResultType;/*!< Vec3, Vec4 or float. */
+
+		/*!
+		 * \brief	Returns this expression as its concrete node type.
+		 */
+		const Derived& Self() const { return static_cast<const Derived&>(*this); }
+
+		/*!
+		 * \brief	Evaluates the expression for element 0 and stores the result.
+		 */
+		operator ResultType() const { return VecExprResult<N>::Store(Self().Eval(0)); }
+	};
+
+	/*!
+	 * \class	VecValueExpr
+	 *
+	 * \brief	Expression leaf holding a single SseVec value.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	N	The vector size the value is typed as (3, 4, or 0 for a broadcast scalar).
+	 *
+	 * \remarks	Doubles as the typed SIMD wrapper that lets a raw SseVec take part in
+	 *			expressions (see AsVec3Expr and AsVec4Expr).
+	 */
+	template<size_t N>
+	class VecValueExpr : public VecExpr<VecValueExpr<N>, N>
+	{
+	public:
+		explicit VecValueExpr(const SseVec& value) : value(value) {}
+
+		SseVec Eval(size_t) const { return value; }
+
+	private:
+		SseVec value;
+	};
+
+	/*!
+	 * \class	VecArrayExpr
+	 *
+	 * \brief	Expression leaf reading element \p i of an aligned Vec3 or Vec4 array.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	N	3 for a Vec3 array, 4 for a Vec4 array.
+	 *
+	 * \remarks	Vec3 elements are loaded with their w component set to 1.0f, matching
+	 *			LoadSseVec3.
+	 */
+	template<size_t N>
+	class VecArrayExpr : public VecExpr<VecArrayExpr<N>, N>
+	{
+	public:
+		typedef typename VecExprResult<N>::Type ElementType;
+
+		explicit VecArrayExpr(const ElementType* data) : data(data) {}
+
+		SseVec Eval(size_t i) const
+		{
+			SseVec result = _mm_load_ps(data[i].vals);
+			return N == 3 ? VecBlend<LEFT, LEFT, LEFT, RIGHT>(result, SSE_VEC_ONE) : result;
+		}
+
+	private:
+		const ElementType* data;
+	};
+
+	/*!
+	 * \class	ScalarArrayExpr
+	 *
+	 * \brief	Expression leaf broadcasting element \p i of a float array.
+	 *
+	 * \date	10/18/2026
+	 */
+	class ScalarArrayExpr : public VecExpr<ScalarArrayExpr, 0>
+	{
+	public:
+		explicit ScalarArrayExpr(const float* data) : data(data) {}
+
+		SseVec Eval(size_t i) const { return _mm_load1_ps(data + i); }
+
+	private:
+		const float* data;
+	};
+
+	/*!
+	 * \struct	VecExprTraits
+	 *
+	 * \brief	Describes how a type takes part in vector expressions.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	Vec3, Vec4, float and every VecExpr are operands. Other types (Vec2,
+	 *			Quaternion, integers) are deliberately not, so the operators never hijack them.
+	 */
+	template<typename T, typename Enable = void>
+	struct VecExprTraits
+	{
+		static const bool IS_OPERAND = false;
+		static const bool IS_FLOAT = false;
+		static const size_t SIZE = 0;
+	};
+
+	//! \cond
+	template<>
+	struct VecExprTraits<float>
+	{
+		static const bool IS_OPERAND = true;
+		static const bool IS_FLOAT = true;
+		static const size_t SIZE = 0;
+		typedef VecValueExpr<0> ExprType;
+		static ExprType ToExpr(float value) { return ExprType(_mm_set1_ps(value)); }
+	};
+
+	template<>
+	struct VecExprTraits<Vec3>
+	{
+		static const bool IS_OPERAND = true;
+		static const bool IS_FLOAT = false;
+		static const size_t SIZE = 3;
+		typedef VecValueExpr<3> ExprType;
+		static ExprType ToExpr(const Vec3& vec) { return ExprType(LoadSseVec3(vec)); }
+	};
+
+	template<>
+	struct VecExprTraits<Vec4>
+	{
+		static const bool IS_OPERAND = true;
+		static const bool IS_FLOAT = false;
+		static const size_t SIZE = 4;
+		typedef VecValueExpr<4> ExprType;
+		static ExprType ToExpr(const Vec4& vec) { return ExprType(LoadSseVec4(vec)); }
+	};
+
+	template<typename T>
+	struct VecExprTraits<T, typename std::enable_if<std::is_base_of<VecExprBase, T>::value>::type>
+	{
+		static const bool IS_OPERAND = true;
+		static const bool IS_FLOAT = false;
+		static const size_t SIZE = T::SIZE;
+		typedef T ExprType;
+		static const T& ToExpr(const T& expr) { return expr; }
+	};
+	//! \endcond
+
+	/*!
+	 * \class	VecBinaryExpr
+	 *
+	 * \brief	Component-wise binary operation node.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \tparam	op	The operation to apply.
+	 * \tparam	L	The left operand expression.
+	 * \tparam	R	The right operand expression.
+	 *
+	 * \remarks	Scalar operands evaluate to broadcast SseVecs, so vector-scalar operations
+	 *			need no special casing.
+	 */
+	template<VecExprOp op, typename L, typename R>
+	class VecBinaryExpr : public VecExpr<VecBinaryExpr<op, L, R>, (L::SIZE != 0 ? L::SIZE : R::SIZE)>
+	{
+	public:
+		VecBinaryExpr(const L& left, const R& right) : left(left), right(right) {}
+
+		SseVec Eval(size_t i) const
+		{
+			SseVec l = left.Eval(i);
+			SseVec r = right.Eval(i);
+
+			switch (op)
+			{
+			case VecExprOp::ADD: return VecAdd(l, r);
+			case VecExprOp::SUB: return VecSub(l, r);
+			case VecExprOp::MUL: return VecMul(l, r);
+			default: return VecDiv<PrecisionPolicy::EXACT>(l, r);
+			}
+		}
+
+	private:
+		L left;
+		R right;
+	};
+
+	/*!
+	 * \class	VecNegateExpr
+	 *
+	 * \brief	Component-wise negation node.
+	 *
+	 * \date	10/18/2026
+	 */
+	template<typename E>
+	class VecNegateExpr : public VecExpr<VecNegateExpr<E>, E::SIZE>
+	{
+	public:
+		explicit VecNegateExpr(const E& expr) : expr(expr) {}
+
+		SseVec Eval(size_t i) const { return Vec4Negate(expr.Eval(i)); }
+
+	private:
+		E expr;
+	};
+
+	/*!
+	 * \class	VecDotExpr
+	 *
+	 * \brief	Dot product node; evaluates to the dot product broadcast to every lane.
+	 *
+	 * \date	10/18/2026
+	 */
+	template<typename L, typename R>
+	class VecDotExpr : public VecExpr<VecDotExpr<L, R>, 0>
+	{
+	public:
+		VecDotExpr(const L& left, const R& right) : left(left), right(right) {}
+
+		SseVec Eval(size_t i) const
+		{
+			return L::SIZE == 3 ? Vec3Dot(left.Eval(i), right.Eval(i)) : Vec4Dot(left.Eval(i), right.Eval(i));
+		}
+
+	private:
+		L left;
+		R right;
+	};
+
+	/*!
+	 * \class	Vec3CrossExpr
+	 *
+	 * \brief	3D cross product node.
+	 *
+	 * \date	10/18/2026
+	 */
+	template<typename L, typename R>
+	class Vec3CrossExpr : public VecExpr<Vec3CrossExpr<L, R>, 3>
+	{
+	public:
+		Vec3CrossExpr(const L& left, const R& right) : left(left), right(right) {}
+
+		SseVec Eval(size_t i) const { return Vec3Cross(left.Eval(i), right.Eval(i)); }
+
+	private:
+		L left;
+		R right;
+	};
+
+	/*!
+	 * \class	MatVecExpr
+	 *
+	 * \brief	Matrix-vector product node.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	A 3D operand is treated as a point (w = 1.0f) and the result has its w
+	 *			component set to 1.0f, matching TransformVec3. A 4D operand is multiplied
+	 *			in full.
+	 */
+	template<typename E>
+	class MatVecExpr : public VecExpr<MatVecExpr<E>, E::SIZE>
+	{
+	public:
+		MatVecExpr(const SseMat44& mat, const E& expr) : mat(mat), expr(expr) {}
+
+		SseVec Eval(size_t i) const
+		{
+			SseVec vec = expr.Eval(i);
+			SseVec result = VecAdd(
+				VecAdd(VecMul(mat.col0, VecSplat<VecCoord::X>(vec)), VecMul(mat.col1, VecSplat<VecCoord::Y>(vec))),
+				VecMul(mat.col2, VecSplat<VecCoord::Z>(vec)));
+
+			if (E::SIZE == 3)
+			{
+				return VecBlend<LEFT, LEFT, LEFT, RIGHT>(VecAdd(result, mat.col3), SSE_VEC_ONE);
+			}
+
+			return VecAdd(result, VecMul(mat.col3, VecSplat<VecCoord::W>(vec)));
+		}
+
+	private:
+		SseMat44 mat;
+		E expr;
+	};
+
+	/*!
+	 * \struct	VecBinaryResult
+	 *
+	 * \brief	SFINAE helper that yields the VecBinaryExpr type for two operands, or no type
+	 *			when the operands cannot be combined.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	Both sides must be operands, at least one must not be a plain float, and the
+	 *			sizes must match unless one side is a scalar.
+	 */
+	template<VecExprOp op, typename L, typename R, typename Enable = void>
+	struct VecBinaryResult {};
+
+	//! \cond
+	template<VecExprOp op, typename L, typename R>
+	struct VecBinaryResult<op, L, R, typename std::enable_if<
+		VecExprTraits<L>::IS_OPERAND && VecExprTraits<R>::IS_OPERAND &&
+		!(VecExprTraits<L>::IS_FLOAT && VecExprTraits<R>::IS_FLOAT) &&
+		(VecExprTraits<L>::SIZE == VecExprTraits<R>::SIZE || VecExprTraits<L>::SIZE == 0 || VecExprTraits<R>::SIZE == 0)>::type>
+	{
+		typedef VecBinaryExpr<op, typename VecExprTraits<L>::ExprType, typename VecExprTraits<R>::ExprType> Type;
+
+		static Type Make(const L& left, const R& right)
+		{
+			return Type(VecExprTraits<L>::ToExpr(left), VecExprTraits<R>::ToExpr(right));
+		}
+	};
+	//! \endcond
+
+	/*!
+	 * \brief	Builds a lazy component-wise sum of two vector operands.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename L, typename R>
+	inline typename VecBinaryResult<VecExprOp::ADD, L, R>::Type operator+(const L& left, const R& right)
+	{
+		return VecBinaryResult<VecExprOp::ADD, L, R>::Make(left, right);
+	}
+
+	/*!
+	 * \brief	Builds a lazy component-wise difference of two vector operands.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename L, typename R>
+	inline typename VecBinaryResult<VecExprOp::SUB, L, R>::Type operator-(const L& left, const R& right)
+	{
+		return VecBinaryResult<VecExprOp::SUB, L, R>::Make(left, right);
+	}
+
+	/*!
+	 * \brief	Builds a lazy component-wise (or vector-scalar) product of two vector operands.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename L, typename R>
+	inline typename VecBinaryResult<VecExprOp::MUL, L, R>::Type operator*(const L& left, const R& right)
+	{
+		return VecBinaryResult<VecExprOp::MUL, L, R>::Make(left, right);
+	}
+
+	/*!
+	 * \brief	Builds a lazy component-wise (or vector-scalar) quotient of two vector operands.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename L, typename R>
+	inline typename VecBinaryResult<VecExprOp::DIV, L, R>::Type operator/(const L& left, const R& right)
+	{
+		return VecBinaryResult<VecExprOp::DIV, L, R>::Make(left, right);
+	}
+
+	/*!
+	 * \brief	Builds a lazy negation of a vector operand.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename E>
+	inline typename std::enable_if<VecExprTraits<E>::IS_OPERAND && !VecExprTraits<E>::IS_FLOAT,
+		VecNegateExpr<typename VecExprTraits<E>::ExprType> >::type operator-(const E& expr)
+	{
+		return VecNegateExpr<typename VecExprTraits<E>::ExprType>(VecExprTraits<E>::ToExpr(expr));
+	}
+
+	/*!
+	 * \brief	Builds a lazy dot product of two 3D or two 4D vector operands.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \return	A scalar expression that can be used as an operand or converted to float.
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename L, typename R>
+	inline typename std::enable_if<VecExprTraits<L>::IS_OPERAND && VecExprTraits<R>::IS_OPERAND &&
+		VecExprTraits<L>::SIZE != 0 && VecExprTraits<L>::SIZE == VecExprTraits<R>::SIZE,
+		VecDotExpr<typename VecExprTraits<L>::ExprType, typename VecExprTraits<R>::ExprType> >::type Dot(const L& left, const R& right)
+	{
+		return VecDotExpr<typename VecExprTraits<L>::ExprType, typename VecExprTraits<R>::ExprType>(
+			VecExprTraits<L>::ToExpr(left), VecExprTraits<R>::ToExpr(right));
+	}
+
+	/*!
+	 * \brief	Builds a lazy cross product of two 3D vector operands.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename L, typename R>
+	inline typename std::enable_if<VecExprTraits<L>::SIZE == 3 && VecExprTraits<R>::SIZE == 3,
+		Vec3CrossExpr<typename VecExprTraits<L>::ExprType, typename VecExprTraits<R>::ExprType> >::type Cross(const L& left, const R& right)
+	{
+		return Vec3CrossExpr<typename VecExprTraits<L>::ExprType, typename VecExprTraits<R>::ExprType>(
+			VecExprTraits<L>::ToExpr(left), VecExprTraits<R>::ToExpr(right));
+	}
+
+	/*!
+	 * \brief	Builds a lazy product of the given SseMat44 and a 3D or 4D vector operand.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \sa MatVecExpr
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename E>
+	inline typename std::enable_if<VecExprTraits<E>::SIZE == 3 || VecExprTraits<E>::SIZE == 4,
+		MatVecExpr<typename VecExprTraits<E>::ExprType> >::type operator*(const SseMat44& mat, const E& expr)
+	{
+		return MatVecExpr<typename VecExprTraits<E>::ExprType>(mat, VecExprTraits<E>::ToExpr(expr));
+	}
+
+	/*!
+	 * \brief	Builds a lazy product of the given Mat44 and a 3D or 4D vector operand.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \sa MatVecExpr
+	 *
+	 * \relatedalso gofxmath::VecExpr
+	 */
+	template<typename E>
+	inline typename std::enable_if<VecExprTraits<E>::SIZE == 3 || VecExprTraits<E>::SIZE == 4,
+		MatVecExpr<typename VecExprTraits<E>::ExprType> >::type operator*(const Mat44& mat, const E& expr)
+	{
+		return MatVecExpr<typename VecExprTraits<E>::ExprType>(
+			SseMat44(mat.col0, mat.col1, mat.col2, mat.col3, mat.matrixTypeVal), VecExprTraits<E>::ToExpr(expr));
+	}
+
+	/*!
+	 * \brief	Multiplies two 4x4 matrices, such that <CODE>(left * right) * v</CODE> equals
+	 *			<CODE>left * (right * v)</CODE>.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \remarks	Evaluated eagerly via MatrixMultiply(right, left); a matrix product is not a
+	 *			per-element operation, so there is nothing to fuse.
+	 *
+	 * \relatedalso gofxmath::Mat44
+	 */
+	inline Mat44 operator*(const Mat44& left, const Mat44& right)
+	{
+		return MatrixMultiply(right, left);
+	}
+
+	/*!
+	 * \brief	Wraps a raw SseVec holding a 3D vector so it can take part in expressions.
+	 *
+	 * \date	10/18/2026
+	 */
+	inline VecValueExpr<3> AsVec3Expr(const SseVec& vec)
+	{
+		return VecValueExpr<3>(vec);
+	}
+
+	/*!
+	 * \brief	Wraps a raw SseVec holding a 4D vector so it can take part in expressions.
+	 *
+	 * \date	10/18/2026
+	 */
+	inline VecValueExpr<4> AsVec4Expr(const SseVec& vec)
+	{
+		return VecValueExpr<4>(vec);
+	}
+
+	/*!
+	 * \brief	Wraps an aligned Vec3 array as an expression leaf for EvaluateBatch.
+	 *
+	 * \date	10/18/2026
+	 */
+	inline VecArrayExpr<3> AsVec3Array(const Vec3* data)
+	{
+		return VecArrayExpr<3>(data);
+	}
+
+	/*!
+	 * \brief	Wraps an aligned Vec4 array as an expression leaf for EvaluateBatch.
+	 *
+	 * \date	10/18/2026
+	 */
+	inline VecArrayExpr<4> AsVec4Array(const Vec4* data)
+	{
+		return VecArrayExpr<4>(data);
+	}
+
+	/*!
+	 * \brief	Wraps a float array as a per-element scalar leaf for EvaluateBatch.
+	 *
+	 * \date	10/18/2026
+	 */
+	inline ScalarArrayExpr AsScalarArray(const float* data)
+	{
+		return ScalarArrayExpr(data);
+	}
+
+	/*!
+	 * \brief	Evaluates the given expression in a single fused pass.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	expr	The expression to evaluate.
+	 *
+	 * \return	The resulting Vec3, Vec4 or float.
+	 */
+	template<typename Derived, size_t N>
+	inline typename VecExprResult<N>::Type Evaluate(const VecExpr<Derived, N>& expr)
+	{
+		return VecExprResult<N>::Store(expr.Self().Eval(0));
+	}
+
+	/*!
+	 * \brief	Evaluates the given expression once for each element of its array leaves,
+	 *			storing the results to \p results.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	expr	The expression to evaluate, typically built from AsVec3Array/AsVec4Array/AsScalarArray leaves.
+	 * \param	results	The aligned destination array.
+	 * \param	count	The number of elements to evaluate.
+	 *
+	 * \remarks	The whole expression is evaluated in one loop with every intermediate kept in
+	 *			registers. Vec3 results are stored as 16-byte aligned writes, so their padding
+	 *			lane is overwritten.
+	 */
+	template<typename Derived, size_t N>
+	inline typename std::enable_if<N != 0>::type EvaluateBatch(const VecExpr<Derived, N>& expr, typename VecExprResult<N>::Type* results, size_t count)
+	{
+		const Derived& self = expr.Self();
+
+		for (size_t i = 0; i < count; i++)
+		{
+			_mm_store_ps(results[i].vals, self.Eval(i));
+		}
+	}
+
+	/*!
+	 * \brief	Evaluates the given scalar expression once for each element of its array
+	 *			leaves, storing the results to \p results.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	expr	The scalar expression to evaluate.
+	 * \param	results	The destination array.
+	 * \param	count	The number of elements to evaluate.
+	 */
+	template<typename Derived>
+	inline void EvaluateBatch(const VecExpr<Derived, 0>& expr, float* results, size_t count)
+	{
+		const Derived& self = expr.Self();
+
+		for (size_t i = 0; i < count; i++)
+		{
+			_mm_store_ss(results + i, self.Eval(i));
+		}
+	}
+
+	/*! @} */
+}
+#endif // VEC_EXPR_DOT_H
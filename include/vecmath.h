@@ -40,7 +40,14 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	Vec2 Vec2Add(const Vec2& first, const Vec2& second);
+	GOFX_CONSTEXPR Vec2 Vec2Add(const Vec2& first, const Vec2& second)
+	{
+		Vec2 result;
+		result.x = first.x + second.x;
+		result.y = first.y + second.y;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Add the two given Vec3s.
@@ -54,7 +61,15 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	Vec3 Vec3Add(const Vec3& first, const Vec3& second);
+	GOFX_CONSTEXPR Vec3 Vec3Add(const Vec3& first, const Vec3& second)
+	{
+		Vec3 result;
+		result.x = first.x + second.x;
+		result.y = first.y + second.y;
+		result.z = first.z + second.z;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Add the two given Vec4s.
@@ -68,7 +83,16 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	Vec4 Vec4Add(const Vec4& first, const Vec4& second);
+	GOFX_CONSTEXPR Vec4 Vec4Add(const Vec4& first, const Vec4& second)
+	{
+		Vec4 result;
+		result.x = first.x + second.x;
+		result.y = first.y + second.y;
+		result.z = first.z + second.z;
+		result.w = first.w + second.w;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Subtract the two given Vec2s.
@@ -82,7 +106,14 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	Vec2 Vec2Sub(const Vec2& first, const Vec2& second);
+	GOFX_CONSTEXPR Vec2 Vec2Sub(const Vec2& first, const Vec2& second)
+	{
+		Vec2 result;
+		result.x = first.x - second.x;
+		result.y = first.y - second.y;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Subtract the two given Vec3s.
@@ -96,7 +127,15 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	Vec3 Vec3Sub(const Vec3& first, const Vec3& second);
+	GOFX_CONSTEXPR Vec3 Vec3Sub(const Vec3& first, const Vec3& second)
+	{
+		Vec3 result;
+		result.x = first.x - second.x;
+		result.y = first.y - second.y;
+		result.z = first.z - second.z;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Subtract the two given Vec4s.
@@ -110,7 +149,16 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	Vec4 Vec4Sub(const Vec4& first, const Vec4& second);
+	GOFX_CONSTEXPR Vec4 Vec4Sub(const Vec4& first, const Vec4& second)
+	{
+		Vec4 result;
+		result.x = first.x - second.x;
+		result.y = first.y - second.y;
+		result.z = first.z - second.z;
+		result.w = first.w - second.w;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Vec2 dot product.
@@ -124,7 +172,12 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	float Vec2Dot(const Vec2& first, const Vec2& second);
+	GOFX_CONSTEXPR float Vec2Dot(const Vec2& first, const Vec2& second)
+	{
+		float result = first.x * second.x + first.y * second.y;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Vec3 dot product.
@@ -138,7 +191,12 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	float Vec3Dot(const Vec3& first, const Vec3& second);
+	GOFX_CONSTEXPR float Vec3Dot(const Vec3& first, const Vec3& second)
+	{
+		float result = (first.x * second.x) + (first.y * second.y) + (first.z * second.z);
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Vec4 dot product.
@@ -152,7 +210,12 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	float Vec4Dot(const Vec4& first, const Vec4& second);
+	GOFX_CONSTEXPR float Vec4Dot(const Vec4& first, const Vec4& second)
+	{
+		float result = (first.x * second.x) + (first.y * second.y) + (first.z * second.z) + (first.w * second.w);
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Multiply the components of the given Vec2 by the given scalar.
@@ -166,7 +229,14 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	Vec2 Vec2MulScalar(const Vec2& vec, float factor);
+	GOFX_CONSTEXPR Vec2 Vec2MulScalar(const Vec2& vec, float factor)
+	{
+		Vec2 result;
+		result.x = vec.x * factor;
+		result.y = vec.y * factor;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Multiply the components of the given Vec3 by the given scalar.
@@ -180,7 +250,15 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	Vec3 Vec3MulScalar(const Vec3& vec, float factor);
+	GOFX_CONSTEXPR Vec3 Vec3MulScalar(const Vec3& vec, float factor)
+	{
+		Vec3 result;
+		result.x = vec.x * factor;
+		result.y = vec.y * factor;
+		result.z = vec.z * factor;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Multiply the components of the given Vec4 by the given scalar.
@@ -194,7 +272,16 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	Vec4 Vec4MulScalar(const Vec4& vec, float factor);
+	GOFX_CONSTEXPR Vec4 Vec4MulScalar(const Vec4& vec, float factor)
+	{
+		Vec4 result;
+		result.x = vec.x * factor;
+		result.y = vec.y * factor;
+		result.z = vec.z * factor;
+		result.w = vec.w * factor;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Divide the components of the given Vec2 by the given scalar.
@@ -208,7 +295,14 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	Vec2 Vec2DivScalar(const Vec2& vec, float divisor);
+	GOFX_CONSTEXPR Vec2 Vec2DivScalar(const Vec2& vec, float divisor)
+	{
+		Vec2 result;
+		result.x = vec.x / divisor;
+		result.y = vec.y / divisor;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Divide the components of the given Vec3 by the given scalar.
@@ -222,7 +316,15 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	Vec3 Vec3DivScalar(const Vec3& vec, float divisor);
+	GOFX_CONSTEXPR Vec3 Vec3DivScalar(const Vec3& vec, float divisor)
+	{
+		Vec3 result;
+		result.x = vec.x / divisor;
+		result.y = vec.y / divisor;
+		result.z = vec.z / divisor;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Divide the components of the given Vec4 by the given scalar.
@@ -236,7 +338,16 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	Vec4 Vec4DivScalar(const Vec4& vec, float divisor);
+	GOFX_CONSTEXPR Vec4 Vec4DivScalar(const Vec4& vec, float divisor)
+	{
+		Vec4 result;
+		result.x = vec.x / divisor;
+		result.y = vec.y / divisor;
+		result.z = vec.z / divisor;
+		result.w = vec.w / divisor;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Normalize the given Vec2.
@@ -253,7 +364,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	Vec2 Vec2Normalize(const Vec2& vec);
+	GOFX_SISD_INLINE Vec2 Vec2Normalize(const Vec2& vec);
 
 	/*!
 	 * \brief	Normalize the given Vec3.
@@ -270,7 +381,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	Vec3 Vec3Normalize(const Vec3& vec);
+	GOFX_SISD_INLINE Vec3 Vec3Normalize(const Vec3& vec);
 
 	/*!
 	 * \brief	Normalize the given Vec4.
@@ -287,7 +398,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	Vec4 Vec4Normalize(const Vec4& vec);
+	GOFX_SISD_INLINE Vec4 Vec4Normalize(const Vec4& vec);
 
 	/*!
 	 * \brief	Normalize the given quaternion.
@@ -303,7 +414,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Quaternion
 	 */
-	Quaternion QuaternionNormalize(const Quaternion& quat);
+	GOFX_SISD_INLINE Quaternion QuaternionNormalize(const Quaternion& quat);
 
 	/*!
 	 * \brief	Negate the given Vec2 components.
@@ -316,7 +427,10 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	Vec2 Vec2Negate(const Vec2& vec);
+	GOFX_CONSTEXPR Vec2 Vec2Negate(const Vec2& vec)
+	{
+		return Vec2(-vec.x, -vec.y);
+	}
 
 	/*!
 	 * \brief	Negate the given Vec3 components.
@@ -329,7 +443,10 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	Vec3 Vec3Negate(const Vec3& vec);
+	GOFX_CONSTEXPR Vec3 Vec3Negate(const Vec3& vec)
+	{
+		return Vec3(-vec.x, -vec.y, -vec.z);
+	}
 
 	/*!
 	 * \brief	Negate the given Vec4 components.
@@ -342,7 +459,10 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	Vec4 Vec4Negate(const Vec4& vec);
+	GOFX_CONSTEXPR Vec4 Vec4Negate(const Vec4& vec)
+	{
+		return Vec4(-vec.x, -vec.y, -vec.z, -vec.w);
+	}
 
 	/*!
 	 * \brief	Determines whether the two Vec2s are approximately equal, based on the given Precision template argument (defaults to HIGH precision).
@@ -412,7 +532,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	bool Vec2HasNaN(const Vec2& vec);
+	GOFX_SISD_INLINE bool Vec2HasNaN(const Vec2& vec);
 
 	/*!
 	 * \brief	Vector 2 has a NaN component value.
@@ -425,7 +545,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	bool Vec3HasNaN(const Vec3& vec);
+	GOFX_SISD_INLINE bool Vec3HasNaN(const Vec3& vec);
 
 	/*!
 	 * \brief	Vector 2 has a NaN component value.
@@ -438,7 +558,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	bool Vec4HasNaN(const Vec4& vec);
+	GOFX_SISD_INLINE bool Vec4HasNaN(const Vec4& vec);
 
 	/*!
 	 * \brief	Determines whether or not the given Vec2 has an infinite value component.
@@ -451,7 +571,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec2
 	 */
-	bool Vec2HasInfinite(const Vec2& vec);
+	GOFX_SISD_INLINE bool Vec2HasInfinite(const Vec2& vec);
 
 	/*!
 	 * \brief	Determines whether or not the given Vec3 has an infinite value component.
@@ -464,7 +584,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	bool Vec3HasInfinite(const Vec3& vec);
+	GOFX_SISD_INLINE bool Vec3HasInfinite(const Vec3& vec);
 
 	/*!
 	 * \brief	Determines whether or not the given Vec4 has an infinite value component.
@@ -477,7 +597,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec4
 	 */
-	bool Vec4HasInfinite(const Vec4& vec);
+	GOFX_SISD_INLINE bool Vec4HasInfinite(const Vec4& vec);
 
 	/*!
 	 * \brief	The cross product of the two given Vec3s.
@@ -491,7 +611,23 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Vec3
 	 */
-	Vec3 Vec3Cross(const Vec3& first, const Vec3& second);
+	GOFX_CONSTEXPR Vec3 Vec3Cross(const Vec3& first, const Vec3& second)
+	{
+		// k  i  j  k  i  j
+		// z0 x0 y0 z0 x0 y0
+		// z1 x1 y1 z1 x1 y1
+		// 
+		// i * y0 * z1 - i * z0 * y1
+		// j * z0 * x1 - j * x0 * z1
+		// k * x0 * y1 - k * y0 * x1
+
+		Vec3 result;
+		result.x = first.y * second.z - first.z * second.y;
+		result.y = first.z * second.x - first.x * second.z;
+		result.z = first.x * second.y - first.y * second.x;
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Multiply the two given Quaternions
@@ -505,7 +641,39 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Quaternion
 	 */
-	Quaternion QuaternionMultiply(const Quaternion& q0, const Quaternion& q1);
+	GOFX_CONSTEXPR Quaternion QuaternionMultiply(const Quaternion& q0, const Quaternion& q1)
+	{
+		Quaternion result;
+		result.x = q0.w*q1.x + q0.x*q1.w + q0.y*q1.z - q0.z*q1.y;
+		result.y = q0.w*q1.y + q0.y*q1.w + q0.z*q1.x - q0.x*q1.z;
+		result.z = q0.w*q1.z + q0.z*q1.w + q0.x*q1.y - q0.y*q1.x;
+		result.w = q0.w*q1.w - q0.x*q1.x - q0.y*q1.y - q0.z*q1.z;
+
+		return result;
+	}
+
+	/*!
+	 * \brief	Rotates the given 3D vector by the given unit quaternion.
+	 *
+	 * \date	10/18/2026
+	 *
+	 * \param	quat	The unit quaternion.
+	 * \param	vec 	The vector to rotate.
+	 *
+	 * \return	The rotated vector.
+	 *
+	 * \remarks	Uses %%v + w\mathbf{t} + \mathbf{q} \times \mathbf{t}%% with %%\mathbf{t} = 2(\mathbf{q} \times v)%%,
+	 *			which needs no rotation matrix.
+	 *
+	 * \relatedalso gofxmath::Quaternion
+	 */
+	GOFX_CONSTEXPR Vec3 QuaternionRotateVec3(const Quaternion& quat, const Vec3& vec)
+	{
+		Vec3 axis = Vec3(quat.x, quat.y, quat.z);
+		Vec3 twoCross = Vec3MulScalar(Vec3Cross(axis, vec), 2.0f);
+
+		return Vec3Add(Vec3Add(vec, Vec3MulScalar(twoCross, quat.w)), Vec3Cross(axis, twoCross));
+	}
 
 	/*!
 	 * \brief	Linearly interpolate the given quaternions for time t.
@@ -520,7 +688,7 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Quaternion
 	 */
-	Quaternion QuaternionLerp(const Quaternion& qStart, const Quaternion& qEnd, float t);
+	GOFX_SISD_INLINE Quaternion QuaternionLerp(const Quaternion& qStart, const Quaternion& qEnd, float t);
 
 	/*!
 	 * \brief	Produces a quaternion representation of the given axis-angle rotation.
@@ -534,7 +702,21 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Quaternion
 	 */
-	Quaternion QuaternionFromAxisAngle(const Vec3& axisVec, float angle);
+	GOFX_CONSTEXPR Quaternion QuaternionFromAxisAngle(const Vec3& axisVec, float angle)
+	{
+		float halfAngle = angle * 0.5f;
+		float cosAngle = CosApprox(halfAngle);
+		float sinAngle = SinApprox(halfAngle);
+
+		Quaternion result(
+			axisVec.x * sinAngle,
+			axisVec.y * sinAngle,
+			axisVec.z * sinAngle,
+			cosAngle
+			);
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Converts the given euler angles to a quaternion.
@@ -547,7 +729,34 @@ namespace gofxmath
 	 *
 	 * \relatedalso gofxmath::Quaternion
 	 */
-	Quaternion QuaternionFromEuler(const Vec3& angles);
+	GOFX_CONSTEXPR Quaternion QuaternionFromEuler(const Vec3& angles)
+	{
+		float halfX = angles.x * 0.5f;
+		float halfY = angles.y * 0.5f;
+		float halfZ = angles.z * 0.5f;
+
+		float cx = CosApprox(halfX);
+		float cy = CosApprox(halfY);
+		float cz = CosApprox(halfZ);
+
+		float sx = SinApprox(halfX);
+		float sy = SinApprox(halfY);
+		float sz = SinApprox(halfZ);
+
+		float szsy = sz * sy;
+		float szcy = sz * cy;
+		float czsy = cz * sy;
+		float czcy = cz * cy;
+		
+		Quaternion result(
+			(czcy * sx) - (szsy * cx),
+			(czsy * cx) + (szcy * sx),
+			(szcy * cx) - (czsy * sx),
+			(czcy * cx) + (szsy * sx)
+			);
+
+		return result;
+	}
 
 	/*!
 	 * \brief	Converts the given euler angles to a quaternion.
@@ -567,4 +776,8 @@ namespace gofxmath
 	/*! @} */
 }
 
+#if defined(GOFXMATH_INLINE_SISD)
+#include "vecmath_impl.h"
+#endif
+
 #endif// VEC_MATH_DOT_H
\ No newline at end of file
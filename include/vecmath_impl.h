@@ -0,0 +1,120 @@
+#ifndef VEC_MATH_IMPL_DOT_H
+#define VEC_MATH_IMPL_DOT_H
+
+#include "vecmath.h"
+#include <cmath>
+#include "scalar_math.h"
+
+/*!
+ * \file
+ *
+ * \brief	The definitions of the out-of-line functions declared in vecmath.h.
+ *
+ * \remarks Compiled into the static library by default.  With GOFXMATH_INLINE_SISD defined, vecmath.h
+ *			includes this file instead, so that every translation unit sees the bodies and the compiler
+ *			can inline (and vectorize) calls to them without link-time optimization.
+ */
+
+namespace gofxmath
+{
+	GOFX_SISD_INLINE Vec2 Vec2Normalize(const Vec2& vec)
+	{
+		float mag = sqrt((vec.x * vec.x) + (vec.y * vec.y));
+
+		Vec2 result;
+		result.x = vec.x / mag;
+		result.y = vec.y / mag;
+
+		return result;
+	}
+
+	GOFX_SISD_INLINE Vec3 Vec3Normalize(const Vec3& vec)
+	{
+		float oneOverMag = 1.0f / sqrt(vec.x * vec.x + vec.y * vec.y + vec.z * vec.z);
+		Vec3 result;
+		result.x = vec.x * oneOverMag;
+		result.y = vec.y * oneOverMag;
+		result.z = vec.z * oneOverMag;
+
+		return result;
+	}
+
+	GOFX_SISD_INLINE Vec4 Vec4Normalize(const Vec4& vec)
+	{
+		float mag = sqrt(vec.w * vec.w + vec.x * vec.x + vec.y * vec.y + vec.z * vec.z);
+
+		Vec4 result;
+		result.x = vec.x / mag;
+		result.y = vec.y / mag;
+		result.z = vec.z / mag;
+		result.w = vec.w / mag;
+
+		return result;
+	}
+
+	GOFX_SISD_INLINE Quaternion QuaternionNormalize(const Quaternion& quat)
+	{
+		float sqrMag = Vec4Dot(quat, quat);
+		float mag = sqrt(sqrMag);
+
+		Quaternion result;
+		result.x = quat.x / mag;
+		result.y = quat.y / mag;
+		result.z = quat.z / mag;
+		result.w = quat.w / mag;
+
+		return result;
+	}
+
+
+	GOFX_SISD_INLINE bool Vec2HasNaN(const Vec2& vec)
+	{
+		return IsNaN(vec.x) || IsNaN(vec.y);
+	}
+
+	GOFX_SISD_INLINE bool Vec3HasNaN(const Vec3& vec)
+	{
+		return IsNaN(vec.x) || IsNaN(vec.y) || IsNaN(vec.z);
+	}
+
+	GOFX_SISD_INLINE bool Vec4HasNaN(const Vec4& vec)
+	{
+		return IsNaN(vec.x) || IsNaN(vec.y) || IsNaN(vec.z) || IsNaN(vec.w);
+	}
+ 
+
+	GOFX_SISD_INLINE bool Vec2HasInfinite(const Vec2& vec)
+	{
+		return IsInfinity(vec.x) || IsInfinity(vec.y);
+	}
+
+	GOFX_SISD_INLINE bool Vec3HasInfinite(const Vec3& vec)
+	{
+		return IsInfinity(vec.x) || IsInfinity(vec.y) || IsInfinity(vec.z);
+	}
+
+	GOFX_SISD_INLINE bool Vec4HasInfinite(const Vec4& vec)
+	{
+		return IsInfinity(vec.x) || IsInfinity(vec.y) || IsInfinity(vec.z) || IsInfinity(vec.w);
+	}
+
+
+	GOFX_SISD_INLINE Quaternion QuaternionLerp(const Quaternion& qStart, const Quaternion& qEnd, float t)
+	{
+		float dot = Vec4Dot(qStart, qEnd);
+		float tStart = 1.0f - t;
+		float tEnd = dot < 0.0f ? -t : t;
+
+		Quaternion result;
+		result.x = tStart*qStart.x + tEnd*qEnd.x;
+		result.y = tStart*qStart.y + tEnd*qEnd.y;
+		result.z = tStart*qStart.z + tEnd*qEnd.z;
+		result.w = tStart*qStart.w + tEnd*qEnd.w;
+
+		result = QuaternionNormalize(result);
+
+		return result;
+	}
+}
+
+#endif // VEC_MATH_IMPL_DOT_H
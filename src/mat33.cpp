@@ -0,0 +1,56 @@
+#include "mat33.h"
+#include "ssemat33.h"
+#include "vecmath.h"
+#include <sstream>
+#include <iomanip>
+
+
+namespace gofxmath
+{
+	Mat33::Mat33(const SseMat33& mat) : col0(StoreSseVec3(mat.col0)),
+										col1(StoreSseVec3(mat.col1)),
+										col2(StoreSseVec3(mat.col2)) { }
+
+	std::ostream &operator << (std::ostream& stream, const Mat33& mat)
+	{
+		stream << "[" << mat.col0 << "][" << mat.col1 << "][" << mat.col2 << "]";
+
+		return stream;
+	}
+
+	std::istream &operator >> (std::istream& stream, Mat33& mat)
+	{
+		stream.ignore(1) >> mat.col0;
+		stream.ignore(2) >> mat.col1;
+		stream.ignore(2) >> mat.col2;
+		stream.ignore(1);
+
+		return stream;
+	}
+
+	bool operator==(const Mat33& left, const Mat33& right)
+	{
+		return left.col0 == right.col0 && left.col1 == right.col1 && left.col2 == right.col2;
+	}
+
+	bool operator!=(const Mat33& left, const Mat33& right)
+	{
+		return !(left == right);
+	}
+
+	void Print(const Mat33& mat)
+	{
+		std::cout << ToConsoleDebugString(mat);
+	}
+
+	std::string ToConsoleDebugString(const Mat33& mat)
+	{
+		std::stringstream str;
+
+		str << mat.col0.x << " " << mat.col1.x << " " << mat.col2.x << " " << std::endl;
+		str << mat.col0.y << " " << mat.col1.y << " " << mat.col2.y << " " << std::endl;
+		str << mat.col0.z << " " << mat.col1.z << " " << mat.col2.z << " " << std::endl;
+
+		return str.str();
+	}
+}
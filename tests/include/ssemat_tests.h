@@ -4,6 +4,10 @@
 #include "scalar_tests.h"
 #include "matmath.h"
 #include "ssemat44.h"
+#include "ssemat34.h"
+#include "ssemat33.h"
+#include "ssetransform.h"
+#include "aligned_allocator.h"
 #include <iomanip>
 #ifdef __MINGW32__
 #include "mingw_tostring_patch.h"
@@ -77,4 +81,12 @@ inline void RunSseMat44Test(const gofxmath::SseMat44& result, const gofxmath::Ss
 
 void RunSseMat44InvalidTest(const gofxmath::SseMat44& result);
 
+template<gofxmath::FloatPrecision precisionLevel = gofxmath::FloatPrecision::HIGH>
+inline void RunSseMat33Test(const gofxmath::SseMat33& result, const gofxmath::SseMat33& expected)
+{
+	CheckSseVec<precisionLevel>(result.col0, expected.col0);
+	CheckSseVec<precisionLevel>(result.col1, expected.col1);
+	CheckSseVec<precisionLevel>(result.col2, expected.col2);
+}
+
 #endif
\ No newline at end of file
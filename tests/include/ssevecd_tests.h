@@ -0,0 +1,47 @@
+#ifndef SSE_VECD_TESTS_DOT_H
+#define SSE_VECD_TESTS_DOT_H
+#include "catch.hpp"
+#include "ssevecd.h"
+#include "ssemat44d.h"
+#include <array>
+#include <cmath>
+#include <iomanip>
+#ifdef __MINGW32__
+#include "mingw_tostring_patch.h"
+#endif
+
+const double SSE_VECD_TEST_TOLERANCE = 1e-12;
+
+inline void RunSseVecDTest(const gofxmath::SseVecD& result, double x, double y, double z, double w, double tolerance = SSE_VECD_TEST_TOLERANCE)
+{
+	std::array<double, 4> res;
+	std::array<double, 4> exp = { { x, y, z, w } };
+	gofxmath::StoreSseVecD4(res.data(), result);
+
+	INFO(std::setprecision(17) << "RESULT: <" << res[0] << " " << res[1] << " " << res[2] << " " << res[3] << ">");
+	INFO(std::setprecision(17) << "EXPECTED: <" << exp[0] << " " << exp[1] << " " << exp[2] << " " << exp[3] << ">");
+
+	bool equal = true;
+	for (size_t i = 0; i < 4; i++)
+	{
+		equal = equal && std::abs(res[i] - exp[i]) <= tolerance;
+	}
+	CHECK(equal);
+}
+
+inline void RunSseMat44DTest(const gofxmath::SseMat44D& result, const gofxmath::SseMat44D& expected, double tolerance = SSE_VECD_TEST_TOLERANCE)
+{
+	std::array<double, 16> res = gofxmath::MatrixToArray(result);
+	std::array<double, 16> exp = gofxmath::MatrixToArray(expected);
+
+	bool equal = result.matrixTypeVal == expected.matrixTypeVal;
+	for (size_t i = 0; i < 16; i++)
+	{
+		INFO("INDEX: " << i << std::setprecision(17) << " RESULT: " << res[i] << " EXPECTED: " << exp[i]);
+		CHECK(std::abs(res[i] - exp[i]) <= tolerance);
+	}
+	INFO("MATRIX TYPE: " << result.matrixTypeVal << " EXPECTED: " << expected.matrixTypeVal);
+	CHECK(equal);
+}
+
+#endif
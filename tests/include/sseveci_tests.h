@@ -0,0 +1,20 @@
+#ifndef SSE_VECI_TESTS_DOT_H
+#define SSE_VECI_TESTS_DOT_H
+#include "catch.hpp"
+#include "sseveci.h"
+#include <array>
+#ifdef __MINGW32__
+#include "mingw_tostring_patch.h"
+#endif
+
+inline void RunSseVecITest(const gofxmath::SseVecI& result, int32_t x, int32_t y, int32_t z, int32_t w)
+{
+	std::array<int32_t, 4> res;
+	gofxmath::StoreSseVecI4(res.data(), result);
+
+	INFO("RESULT: <" << res[0] << " " << res[1] << " " << res[2] << " " << res[3] << ">");
+	INFO("EXPECTED: <" << x << " " << y << " " << z << " " << w << ">");
+	CHECK((res[0] == x && res[1] == y && res[2] == z && res[3] == w));
+}
+
+#endif
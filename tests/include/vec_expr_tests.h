@@ -0,0 +1,9 @@
+#ifndef VEC_EXPR_TESTS_DOT_H
+#define VEC_EXPR_TESTS_DOT_H
+
+#include "catch.hpp"
+#include "vec_expr.h"
+#include "matmath_tests.h"
+#include "vec_tests.h"
+
+#endif
@@ -65,7 +65,7 @@ void RunLookDirTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E1(),
 		Vec4::E2(),
-		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f)
+		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -80,7 +80,7 @@ void RunLookDirTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E2(),
 		Vec4::NegE1(),
-		Vec4(-eyeX, eyeZ, -eyeY, 1.0f)
+		Vec4(-eyeX, eyeZ, -eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -95,7 +95,7 @@ void RunLookDirTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E2(),
 		Vec4::E1(),
 		Vec4::NegE0(),
-		Vec4(eyeZ, -eyeY, -eyeX, 1.0f)
+		Vec4(eyeZ, -eyeY, -eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -110,7 +110,7 @@ void RunLookDirTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE0(),
 		Vec4::E1(),
 		Vec4::NegE2(),
-		Vec4(eyeX, -eyeY, eyeZ, 1.0f)
+		Vec4(eyeX, -eyeY, eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -125,7 +125,7 @@ void RunLookDirTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::NegE2(),
 		Vec4::E1(),
-		Vec4(-eyeX, -eyeZ, eyeY, 1.0f)
+		Vec4(-eyeX, -eyeZ, eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -140,7 +140,7 @@ void RunLookDirTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE2(),
 		Vec4::E1(),
 		Vec4::E0(),
-		Vec4(-eyeZ, -eyeY, eyeX, 1.0f)
+		Vec4(-eyeZ, -eyeY, eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -162,7 +162,7 @@ void RunLookAtTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E1(),
 		Vec4::E2(),
-		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f)
+		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -177,7 +177,7 @@ void RunLookAtTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E2(),
 		Vec4::NegE1(),
-		Vec4(-eyeX, eyeZ, -eyeY, 1.0f)
+		Vec4(-eyeX, eyeZ, -eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -192,7 +192,7 @@ void RunLookAtTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E2(),
 		Vec4::E1(),
 		Vec4::NegE0(),
-		Vec4(eyeZ, -eyeY, -eyeX, 1.0f)
+		Vec4(eyeZ, -eyeY, -eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -207,7 +207,7 @@ void RunLookAtTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE0(),
 		Vec4::E1(),
 		Vec4::NegE2(),
-		Vec4(eyeX, -eyeY, eyeZ, 1.0f)
+		Vec4(eyeX, -eyeY, eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -222,7 +222,7 @@ void RunLookAtTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::NegE2(),
 		Vec4::E1(),
-		Vec4(-eyeX, -eyeZ, eyeY, 1.0f)
+		Vec4(-eyeX, -eyeZ, eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -237,7 +237,7 @@ void RunLookAtTestMat44(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE2(),
 		Vec4::E1(),
 		Vec4::E0(),
-		Vec4(-eyeZ, -eyeY, eyeX, 1.0f)
+		Vec4(-eyeZ, -eyeY, eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunMat44Test(result, expected);
@@ -342,6 +342,181 @@ TEST_CASE("MatrixInverse for Mat44 can produce the proper inverse of invertible
 	}
 }
 
+TEST_CASE("CombineMatrixTypes finds the most specific MatrixType of a product", "[Mat44][MatrixType]")
+{
+	SECTION("Identity leaves the other type unchanged")
+	{
+		CHECK(CombineMatrixTypes(MatrixType::IDENTITY, MatrixType::IDENTITY) == MatrixType::IDENTITY);
+		CHECK(CombineMatrixTypes(MatrixType::IDENTITY, MatrixType::ROTATION) == MatrixType::ROTATION);
+		CHECK(CombineMatrixTypes(MatrixType::UNIFORM_SCALE, MatrixType::IDENTITY) == MatrixType::UNIFORM_SCALE);
+		CHECK(CombineMatrixTypes(MatrixType::IDENTITY, MatrixType::PROJECTIVE) == MatrixType::PROJECTIVE);
+	}
+
+	SECTION("Rotations and translations compose into rigid transforms")
+	{
+		CHECK(CombineMatrixTypes(MatrixType::TRANSLATION, MatrixType::TRANSLATION) == MatrixType::TRANSLATION);
+		CHECK(CombineMatrixTypes(MatrixType::ROTATION, MatrixType::ROTATION) == MatrixType::ROTATION);
+		CHECK(CombineMatrixTypes(MatrixType::TRANSLATION, MatrixType::ROTATION) == MatrixType::RIGID);
+		CHECK(CombineMatrixTypes(MatrixType::RIGID, MatrixType::TRANSLATION) == MatrixType::RIGID);
+	}
+
+	SECTION("Scales combined with rotations or translations become affine")
+	{
+		CHECK(CombineMatrixTypes(MatrixType::UNIFORM_SCALE, MatrixType::UNIFORM_SCALE) == MatrixType::UNIFORM_SCALE);
+		CHECK(CombineMatrixTypes(MatrixType::UNIFORM_SCALE, MatrixType::ROTATION) == MatrixType::AFFINE);
+		CHECK(CombineMatrixTypes(MatrixType::TRANSLATION, MatrixType::UNIFORM_SCALE) == MatrixType::AFFINE);
+		CHECK(CombineMatrixTypes(MatrixType::RIGID, MatrixType::AFFINE) == MatrixType::AFFINE);
+	}
+
+	SECTION("Projective and invalid types are contagious")
+	{
+		CHECK(CombineMatrixTypes(MatrixType::AFFINE, MatrixType::PROJECTIVE) == MatrixType::PROJECTIVE);
+		CHECK(CombineMatrixTypes(MatrixType::MISC, MatrixType::RIGID) == MatrixType::PROJECTIVE);
+		CHECK(CombineMatrixTypes(MatrixType::INVALID, MatrixType::IDENTITY) == MatrixType::INVALID);
+		CHECK(CombineMatrixTypes(MatrixType::PROJECTIVE, MatrixType::INVALID) == MatrixType::INVALID);
+	}
+
+	SECTION("Classification predicates")
+	{
+		CHECK(MatrixTypeIsRigid(MatrixType::IDENTITY));
+		CHECK(MatrixTypeIsRigid(MatrixType::TRANSLATION));
+		CHECK(MatrixTypeIsRigid(MatrixType::ROTATION));
+		CHECK(MatrixTypeIsRigid(MatrixType::RIGID));
+		CHECK_FALSE(MatrixTypeIsRigid(MatrixType::UNIFORM_SCALE));
+		CHECK_FALSE(MatrixTypeIsRigid(MatrixType::AFFINE));
+		CHECK_FALSE(MatrixTypeIsRigid(MatrixType::INVALID));
+
+		CHECK(MatrixTypeIsAffine(MatrixType::UNIFORM_SCALE));
+		CHECK(MatrixTypeIsAffine(MatrixType::AFFINE));
+		CHECK_FALSE(MatrixTypeIsAffine(MatrixType::PROJECTIVE));
+		CHECK_FALSE(MatrixTypeIsAffine(MatrixType::INVALID));
+	}
+}
+
+TEST_CASE("MatrixMultiply and MatrixInverse for Mat44 take the affine fast paths with the same results as the general paths", "[Mat44][MatrixType]")
+{
+	// RotationMatrixFromEuler uses the approximated trig functions, so build an exactly orthonormal rotation instead
+	Mat44 rotation = RotationMatrixFromQuaternion(Quaternion(0.5f, -0.5f, 0.5f, 0.5f));
+	Mat44 translation = TranslationMatrixFromVec3(Vec3(1.0f, -2.0f, 3.0f));
+	Mat44 scale = ScaleMatrixFromVec3(Vec3(2.0f, 0.5f, 4.0f));
+
+	Mat44 rigid = MatrixMultiply(rotation, translation);
+	Mat44 affine = MatrixMultiply(scale, rigid);
+
+	SECTION("Multiplication")
+	{
+		Mat44 generalRotation = rotation;
+		Mat44 generalTranslation = translation;
+		Mat44 generalScale = scale;
+		generalRotation.matrixTypeVal = MatrixType::MISC;
+		generalTranslation.matrixTypeVal = MatrixType::MISC;
+		generalScale.matrixTypeVal = MatrixType::MISC;
+
+		Mat44 expectedRigid = MatrixMultiply(generalRotation, generalTranslation);
+		expectedRigid.matrixTypeVal = MatrixType::RIGID;
+		RunMat44Test<FloatPrecision::HIGH>(rigid, expectedRigid);
+
+		Mat44 expectedAffine = MatrixMultiply(generalScale, expectedRigid);
+		expectedAffine.matrixTypeVal = MatrixType::AFFINE;
+		RunMat44Test<FloatPrecision::HIGH>(affine, expectedAffine);
+	}
+
+	SECTION("Identity factors are returned unchanged")
+	{
+		RunMat44Test<FloatPrecision::HIGH>(MatrixMultiply(Mat44::Identity(), affine), affine);
+		RunMat44Test<FloatPrecision::HIGH>(MatrixMultiply(rigid, Mat44::Identity()), rigid);
+	}
+
+	SECTION("Rigid inverse")
+	{
+		Mat44 general = rigid;
+		general.matrixTypeVal = MatrixType::MISC;
+
+		Mat44 expected = MatrixInverse(general);
+		expected.matrixTypeVal = MatrixType::RIGID;
+
+		RunMat44Test<FloatPrecision::MEDIUM_HIGH>(MatrixInverse(rigid), expected);
+		RunMat44Test<FloatPrecision::MEDIUM_HIGH>(RigidMatrixInverse(rigid), expected);
+	}
+
+	SECTION("Affine inverse")
+	{
+		Mat44 general = affine;
+		general.matrixTypeVal = MatrixType::MISC;
+
+		Mat44 expected = MatrixInverse(general);
+		expected.matrixTypeVal = MatrixType::AFFINE;
+
+		RunMat44Test<FloatPrecision::MEDIUM_HIGH>(MatrixInverse(affine), expected);
+		RunMat44Test<FloatPrecision::MEDIUM_HIGH>(AffineMatrixInverse(affine), expected);
+	}
+
+	SECTION("Affine inverse with a determinant below 1")
+	{
+		Mat44 halfScale = MatrixMultiply(translation, ScaleMatrixFromVec3(Vec3(0.5f, 0.5f, 0.5f)));
+
+		Mat44 general = halfScale;
+		general.matrixTypeVal = MatrixType::MISC;
+
+		Mat44 expected = TranslationMatrixFromVec3(Vec3(-1.0f, 2.0f, -3.0f));
+		expected.col0.x = 2.0f;
+		expected.col1.y = 2.0f;
+		expected.col2.z = 2.0f;
+
+		expected.matrixTypeVal = MatrixType::MISC;
+		RunMat44Test<FloatPrecision::HIGH>(MatrixInverse(general), expected);
+
+		expected.matrixTypeVal = halfScale.matrixTypeVal;
+		RunMat44Test<FloatPrecision::HIGH>(MatrixInverse(halfScale), expected);
+		RunMat44Test<FloatPrecision::HIGH>(AffineMatrixInverse(halfScale), expected);
+	}
+
+	SECTION("Singular affine matrix")
+	{
+		Mat44 singular = ScaleMatrixFromVec3(Vec3(1.0f, 0.0f, 1.0f));
+		RunMat44InvalidTest(MatrixInverse(singular));
+	}
+
+	SECTION("Transposing moves the translation out of the affine classes")
+	{
+		CHECK(MatrixTranspose(rotation).matrixTypeVal == MatrixType::ROTATION);
+		CHECK(MatrixTranspose(translation).matrixTypeVal == MatrixType::PROJECTIVE);
+		CHECK(MatrixTranspose(affine).matrixTypeVal == MatrixType::PROJECTIVE);
+	}
+}
+
+TEST_CASE("Col for Mat44 and Mat33 gives the same columns as operator[]", "[Mat44][Mat33]")
+{
+	Mat44 mat(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		5.0f, 6.0f, 7.0f, 8.0f,
+		9.0f, 10.0f, 11.0f, 12.0f,
+		13.0f, 14.0f, 15.0f, 16.0f);
+	Mat33 mat33(mat);
+
+	SECTION("Reading")
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			CHECK(&mat.Col(i) == &mat[i]);
+		}
+
+		for (int i = 0; i < 3; i++)
+		{
+			CHECK(&mat33.Col(i) == &mat33[i]);
+		}
+	}
+
+	SECTION("Writing")
+	{
+		mat.Col(3) = Vec4(-1.0f, -2.0f, -3.0f, 1.0f);
+		mat33.Col(2).y = -7.0f;
+
+		RunVec4Test(mat.col3, Vec4(-1.0f, -2.0f, -3.0f, 1.0f));
+		RunVec3Test(mat33.col2, Vec3(3.0f, -7.0f, 11.0f));
+	}
+}
+
 TEST_CASE("MatrixTranspose for Mat44 can produce the proper transpose of a matrix", "[Mat44]")
 {
 	SECTION("I-T = I")
@@ -425,7 +600,7 @@ TEST_CASE("RotationMatrixFromQuaternion for Mat44 can calculate the associated r
 			Vec4::E0(),
 			Vec4(0.0f, 0.0f, 1.0f, 0.0f),
 			Vec4(0.0f, -1.0f, 0.0f, 0.0f),
-			Vec4::E3()
+			Vec4::E3(), MatrixType::ROTATION
 			);
 
 		RunMat44Test(result, expected);
@@ -439,7 +614,7 @@ TEST_CASE("RotationMatrixFromQuaternion for Mat44 can calculate the associated r
 			Vec4(0.0f, 0.0f, -1.0f, 0.0f),
 			Vec4::E1(),
 			Vec4(1.0f, 0.0f, 0.0f, 0.0f),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunMat44Test(result, expected);
 	}
@@ -452,7 +627,7 @@ TEST_CASE("RotationMatrixFromQuaternion for Mat44 can calculate the associated r
 			Vec4(0.0f, 1.0f, 0.0f, 0.0f),
 			Vec4(-1.0f, 0.0f, 0.0f, 0.0f),
 			Vec4::E2(),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunMat44Test(result, expected);
 	}
@@ -468,7 +643,7 @@ TEST_CASE("RotationMatrixFromEuler for Mat44 can calculate the associated rotati
 			Vec4::E0(),
 			Vec4(0.0f, 0.0f, 1.0f, 0.0f),
 			Vec4(0.0f, -1.0f, 0.0f, 0.0f),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunMat44Test(result, expected);
 	}
@@ -481,7 +656,7 @@ TEST_CASE("RotationMatrixFromEuler for Mat44 can calculate the associated rotati
 			Vec4(0.0f, 0.0f, -1.0f, 0.0f),
 			Vec4::E1(),
 			Vec4(1.0f, 0.0f, 0.0f, 0.0f),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunMat44Test(result, expected);
 	}
@@ -494,7 +669,7 @@ TEST_CASE("RotationMatrixFromEuler for Mat44 can calculate the associated rotati
 			Vec4(0.0f, 1.0f, 0.0f, 0.0f),
 			Vec4(-1.0f, 0.0f, 0.0f, 0.0f),
 			Vec4::E2(),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunMat44Test(result, expected);
 	}
@@ -507,7 +682,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		Vec3 vec = Vec3(0.0f, 0.0f, 0.0f);
 		Mat44 result = TranslationMatrixFromVec3(vec);
 		Mat44 expected = Mat44::Identity();
-		expected.matrixTypeVal = MatrixType::MISC;
+		expected.matrixTypeVal = MatrixType::TRANSLATION;
 
 		RunMat44Test(result, expected);
 	}
@@ -518,7 +693,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(1.0f, 0.0f, 0.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, 0.0f, 0.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, 0.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -527,7 +702,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(0.0f, 1.0f, 0.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 1.0f, 0.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 1.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -536,7 +711,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(0.0f, 0.0f, 1.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, 1.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, 1.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -545,7 +720,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(-1.0f, 0.0f, 0.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 0.0f, 0.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 0.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -554,7 +729,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(0.0f, -1.0f, 0.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, -1.0f, 0.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, -1.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -563,7 +738,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(0.0f, 0.0f, -1.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, -1.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, -1.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -575,7 +750,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(1.0f, 1.0f, 1.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4::One());
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4::One(), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -584,7 +759,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(-1.0f, -1.0f, -1.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f, -1.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f, -1.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -595,7 +770,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 			{
 				Vec3 vec = Vec3(-1.0f, 1.0f, 1.0f);
 				Mat44 result = TranslationMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 1.0f, 1.0f, 1.0f));
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 1.0f, 1.0f, 1.0f), MatrixType::TRANSLATION);
 
 				RunMat44Test(result, expected);
 			}
@@ -603,7 +778,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 			{
 				Vec3 vec = Vec3(1.0f, -1.0f, 1.0f);
 				Mat44 result = TranslationMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, -1.0f, 1.0f, 1.0f));
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, -1.0f, 1.0f, 1.0f), MatrixType::TRANSLATION);
 
 				RunMat44Test(result, expected);
 			}
@@ -611,7 +786,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 			{
 				Vec3 vec = Vec3(1.0f, 1.0f, -1.0f);
 				Mat44 result = TranslationMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, 1.0f, -1.0f, 1.0f));
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, 1.0f, -1.0f, 1.0f), MatrixType::TRANSLATION);
 
 				RunMat44Test(result, expected);
 			}
@@ -621,7 +796,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 			{
 				Vec3 vec = Vec3(1.0f, -1.0f, -1.0f);
 				Mat44 result = TranslationMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, -1.0f, -1.0f, 1.0f));
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, -1.0f, -1.0f, 1.0f), MatrixType::TRANSLATION);
 
 				RunMat44Test(result, expected);
 			}
@@ -629,7 +804,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 			{
 				Vec3 vec = Vec3(-1.0f, 1.0f, -1.0f);
 				Mat44 result = TranslationMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 1.0f, -1.0f, 1.0f));
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 1.0f, -1.0f, 1.0f), MatrixType::TRANSLATION);
 
 				RunMat44Test(result, expected);
 			}
@@ -637,7 +812,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 			{
 				Vec3 vec = Vec3(-1.0f, -1.0f, 1.0f);
 				Mat44 result = TranslationMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f, 1.0f, 1.0f));
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f, 1.0f, 1.0f), MatrixType::TRANSLATION);
 
 				RunMat44Test(result, expected);
 			}
@@ -650,7 +825,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(2.0f, 30.0f, 400.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(2.0f, 30.0f, 400.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(2.0f, 30.0f, 400.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -659,7 +834,7 @@ TEST_CASE("TranslationMatrixFromVec3 for Mat44 can produce a translation matrix
 		{
 			Vec3 vec = Vec3(-2.0f, -30.0f, -400.0f);
 			Mat44 result = TranslationMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-2.0f, -30.0f, -400.0f, 1.0f));
+			Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-2.0f, -30.0f, -400.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunMat44Test(result, expected);
 		}
@@ -673,7 +848,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		Vec3 vec = Vec3(0.0f, 0.0f, 0.0f);
 		Mat44 result = ScaleMatrixFromVec3(vec);
 		Mat44 expected = Mat44(Vec4::Zero(), Vec4::Zero(), Vec4::Zero(), Vec4::E3());
-		expected.matrixTypeVal = MatrixType::MISC;
+		expected.matrixTypeVal = MatrixType::UNIFORM_SCALE;
 
 		RunMat44Test(result, expected);
 	}
@@ -684,7 +859,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(1.0f, 0.0f, 0.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4(1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3());
+			Mat44 expected = Mat44(Vec4(1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -693,7 +868,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(0.0f, 1.0f, 0.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::Zero(), Vec4(0.0f, 1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3());
+			Mat44 expected = Mat44(Vec4::Zero(), Vec4(0.0f, 1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -702,7 +877,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(0.0f, 0.0f, 1.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, 1.0f, 0.0f), Vec4::E3());
+			Mat44 expected = Mat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, 1.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -711,7 +886,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(-1.0f, 0.0f, 0.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4(-1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3());
+			Mat44 expected = Mat44(Vec4(-1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -720,7 +895,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(0.0f, -1.0f, 0.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::Zero(), Vec4(0.0f, -1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3());
+			Mat44 expected = Mat44(Vec4::Zero(), Vec4(0.0f, -1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -729,7 +904,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(0.0f, 0.0f, -1.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, -1.0f, 0.0f), Vec4::E3());
+			Mat44 expected = Mat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, -1.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -742,7 +917,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 			Vec3 vec = Vec3(1.0f, 1.0f, 1.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
 			Mat44 expected = Mat44::Identity();
-			expected.matrixTypeVal = MatrixType::MISC;
+			expected.matrixTypeVal = MatrixType::UNIFORM_SCALE;
 
 			RunMat44Test(result, expected);
 		}
@@ -751,7 +926,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(-1.0f, -1.0f, -1.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3());
+			Mat44 expected = Mat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3(), MatrixType::UNIFORM_SCALE);
 
 			RunMat44Test(result, expected);
 		}
@@ -762,7 +937,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 			{
 				Vec3 vec = Vec3(-1.0f, 1.0f, 1.0f);
 				Mat44 result = ScaleMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::NegE0(), Vec4::E1(), Vec4::E2(), Vec4::E3());
+				Mat44 expected = Mat44(Vec4::NegE0(), Vec4::E1(), Vec4::E2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunMat44Test(result, expected);
 			}
@@ -770,7 +945,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 			{
 				Vec3 vec = Vec3(1.0f, -1.0f, 1.0f);
 				Mat44 result = ScaleMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3());
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunMat44Test(result, expected);
 			}
@@ -778,7 +953,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 			{
 				Vec3 vec = Vec3(1.0f, 1.0f, -1.0f);
 				Mat44 result = ScaleMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3());
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunMat44Test(result, expected);
 			}
@@ -788,7 +963,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 			{
 				Vec3 vec = Vec3(1.0f, -1.0f, -1.0f);
 				Mat44 result = ScaleMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::E0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3());
+				Mat44 expected = Mat44(Vec4::E0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunMat44Test(result, expected);
 			}
@@ -796,7 +971,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 			{
 				Vec3 vec = Vec3(-1.0f, 1.0f, -1.0f);
 				Mat44 result = ScaleMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::NegE0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3());
+				Mat44 expected = Mat44(Vec4::NegE0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunMat44Test(result, expected);
 			}
@@ -804,7 +979,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 			{
 				Vec3 vec = Vec3(-1.0f, -1.0f, 1.0f);
 				Mat44 result = ScaleMatrixFromVec3(vec);
-				Mat44 expected = Mat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3());
+				Mat44 expected = Mat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunMat44Test(result, expected);
 			}
@@ -817,7 +992,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(2.0f, 30.0f, 400.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4(2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 400.0f, 0.0f), Vec4::E3());
+			Mat44 expected = Mat44(Vec4(2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 400.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -826,7 +1001,7 @@ TEST_CASE("ScaleMatrixFromVec3 for Mat44 can produce a scale matrix from a given
 		{
 			Vec3 vec = Vec3(-2.0f, -30.0f, -400.0f);
 			Mat44 result = ScaleMatrixFromVec3(vec);
-			Mat44 expected = Mat44(Vec4(-2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, -30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, -400.0f, 0.0f), Vec4::E3());
+			Mat44 expected = Mat44(Vec4(-2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, -30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, -400.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunMat44Test(result, expected);
 		}
@@ -1161,6 +1336,14 @@ TEST_CASE("TransformVec3 for Mat44 can produce a Vec3 representation of a 3D vec
 		RunVec3Test(result, expected);
 	}
 
+	SECTION("Typed identity and translation matrices")
+	{
+		Vec3 value = Vec3(3.0f, -4.0f, 5.0f);
+
+		RunVec3Test(TransformVec3(Mat44::Identity(), value), value);
+		RunVec3Test(TransformVec3(TranslationMatrixFromVec3(Vec3(1.0f, 2.0f, -3.0f)), value), Vec3(4.0f, -2.0f, 2.0f));
+	}
+
 	SECTION("Rotation")
 	{
 		// Rotate by PI/2 on the x-axis
@@ -1195,4 +1378,126 @@ TEST_CASE("TransformVec3 for Mat44 can produce a Vec3 representation of a 3D vec
 
 		RunVec3Test(result, expected);
 	}
-}
\ No newline at end of file
+}
+
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+TEST_CASE("Mat44 transforms can be composed at compile time, matching their runtime results", "[Mat44][3D][Vec3][Affine Transformation Matrix]")
+{
+	constexpr Quaternion ROTATION = QuaternionFromAxisAngle(Vec3::Up(), F_PI_2);
+	constexpr Mat44 TRANSFORM = MatrixMultiply(RotationMatrixFromQuaternion(ROTATION), TranslationMatrixFromVec3(Vec3(1.0f, 2.0f, 3.0f)));
+	constexpr Vec3 TRANSFORMED = TransformVec3(TRANSFORM, Vec3::Forward());
+
+	static_assert(TRANSFORMED.x > 1.99f && TRANSFORMED.x < 2.01f, "The transform must be a constant expression");
+	static_assert(MatrixTranspose(Mat44::Identity()).col3.w == 1.0f, "MatrixTranspose must be a constant expression");
+	static_assert(Vec3Dot(Vec3Cross(Vec3::Right(), Vec3::Up()), Vec3::Forward()) == 1.0f, "Vec3Cross and Vec3Dot must be constant expressions");
+
+	volatile float angle = F_PI_2;
+	Quaternion rotation = QuaternionFromAxisAngle(Vec3::Up(), angle);
+	Mat44 transform = MatrixMultiply(RotationMatrixFromQuaternion(rotation), TranslationMatrixFromVec3(Vec3(1.0f, 2.0f, 3.0f)));
+
+	RunMat44Test<FloatPrecision::HIGH>(TRANSFORM, transform);
+	RunVec3Test(TRANSFORMED, TransformVec3(transform, Vec3::Forward()));
+	RunVec3Test(TRANSFORMED, Vec3(2.0f, 2.0f, 3.0f));
+}
+#endif
+
+TEST_CASE("Mat33 multiply, transpose, determinant and inverse match their Mat44 counterparts", "[Mat33][Mat44]")
+{
+	const Mat33 rotation = RotationMat33FromQuaternion(Quaternion(0.5f, -0.5f, 0.5f, 0.5f));
+	const Mat33 shear = Mat33(
+		2.0f, 1.0f, 0.0f,
+		0.0f, 3.0f, -1.0f,
+		0.5f, 0.0f, 4.0f);
+
+	SECTION("Construction and conversion")
+	{
+		CHECK(Mat33(Mat44::Identity()) == Mat33::Identity());
+		CHECK(shear.col0 == Vec3(2.0f, 0.0f, 0.5f));
+		CHECK(shear[2] == Vec3(0.0f, -1.0f, 4.0f));
+		CHECK(Mat33(ToMat44(shear)) == shear);
+		CHECK(Mat33(RotationMatrixFromQuaternion(Quaternion(0.5f, -0.5f, 0.5f, 0.5f))) == rotation);
+	}
+
+	SECTION("Multiplication")
+	{
+		Mat44 expected = MatrixMultiply(ToMat44(rotation, MatrixType::MISC), ToMat44(shear, MatrixType::MISC));
+
+		CHECK(MatrixMultiply(rotation, shear) == Mat33(expected));
+		CHECK(MatrixMultiply(Mat33::Identity(), shear) == shear);
+		RunVec3Test(TransformVec3(shear, Vec3(1.0f, 2.0f, 3.0f)), Vec3(4.0f, 3.0f, 12.5f));
+	}
+
+	SECTION("Transpose and determinant")
+	{
+		CHECK(MatrixTranspose(MatrixTranspose(shear)) == shear);
+		CHECK(MatrixTranspose(shear).col0 == Vec3(2.0f, 1.0f, 0.0f));
+		CHECK(MatrixDeterminant(shear) == Approx(MatrixDeterminant(ToMat44(shear, MatrixType::MISC))));
+		CHECK(MatrixDeterminant(rotation) == Approx(1.0f));
+	}
+
+	SECTION("Inverse")
+	{
+		CHECK(MatrixInverse(shear) == Mat33(MatrixInverse(ToMat44(shear, MatrixType::MISC))));
+		CHECK(MatrixMultiply(MatrixInverse(shear), shear) == Mat33::Identity());
+		CHECK(MatrixInverse(rotation) == MatrixTranspose(rotation));
+
+		// A determinant below 1 (here 0.125) is still far from singular
+		Mat33 halfScale = Mat33(0.5f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.5f);
+		CHECK(MatrixInverse(halfScale) == Mat33(2.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f));
+
+		// So is a rotation scaled down to 0.01, with a determinant of 1e-6
+		Mat33 smallScale = MatrixMultiply(Mat33(0.01f, 0.0f, 0.0f, 0.0f, 0.01f, 0.0f, 0.0f, 0.0f, 0.01f), rotation);
+		CHECK(MatrixInverse(smallScale) == MatrixMultiply(MatrixTranspose(rotation), Mat33(100.0f, 0.0f, 0.0f, 0.0f, 100.0f, 0.0f, 0.0f, 0.0f, 100.0f)));
+		CHECK(MatrixMultiply(MatrixInverse(smallScale), smallScale) == Mat33::Identity());
+	}
+
+	SECTION("Singular inverse")
+	{
+		Mat33 singular = MatrixInverse(Mat33(1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 6.0f, 0.0f, 1.0f, 1.0f));
+		bool allFinite = true;
+
+		for (size_t i = 0; i < 3; i++)
+		{
+			allFinite = allFinite && std::isfinite(singular[i].x) && std::isfinite(singular[i].y) && std::isfinite(singular[i].z);
+		}
+
+		CHECK_FALSE(allFinite);
+	}
+
+	SECTION("Normal matrix")
+	{
+		Mat44 model = ToMat44(shear);
+		model.col3 = Vec4(1.0f, 2.0f, 3.0f, 1.0f);
+
+		CHECK(NormalMatrix(model) == MatrixTranspose(MatrixInverse(shear)));
+		CHECK(NormalMatrix(RotationMatrixFromQuaternion(Quaternion(0.5f, -0.5f, 0.5f, 0.5f))) == rotation);
+		CHECK(NormalMatrix(ScaleMatrixFromVec3(Vec3(0.5f, 0.25f, 1.0f))) == Mat33(2.0f, 0.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.0f, 0.0f, 1.0f));
+		CHECK(NormalMatrix(ScaleMatrixFromVec3(Vec3(0.01f, 0.01f, 0.01f))) == Mat33(100.0f, 0.0f, 0.0f, 0.0f, 100.0f, 0.0f, 0.0f, 0.0f, 100.0f));
+	}
+}
+
+TEST_CASE("QuaternionFromRotationMatrix for Mat33 and Mat44 inverts RotationMatrixFromQuaternion", "[Mat33][Mat44][Quaternion]")
+{
+	const int NUM_TESTS = 7;
+	const Quaternion quats[NUM_TESTS] = {
+		Quaternion::Identity(),
+		Quaternion(0.5f, -0.5f, 0.5f, 0.5f),
+		Quaternion(1.0f, 0.0f, 0.0f, 0.0f),
+		Quaternion(0.0f, 1.0f, 0.0f, 0.0f),
+		Quaternion(0.0f, 0.0f, 1.0f, 0.0f),
+		Quaternion(F_1_SQRT2, F_1_SQRT2, 0.0f, 0.0f),
+		Quaternion(0.2f, -0.4f, 0.4f, 0.8f)
+	};
+
+	for (int i = 0; i < NUM_TESTS; i++)
+	{
+		INFO("Test " << i);
+		RunVec4Test(QuaternionFromRotationMatrix(RotationMat33FromQuaternion(quats[i])), quats[i]);
+		RunVec4Test(QuaternionFromRotationMatrix(RotationMatrixFromQuaternion(quats[i])), quats[i]);
+	}
+
+	SECTION("w is kept non-negative")
+	{
+		RunVec4Test(QuaternionFromRotationMatrix(RotationMat33FromQuaternion(Quaternion(-0.2f, 0.4f, -0.4f, -0.8f))), quats[6]);
+	}
+}
@@ -84,6 +84,15 @@ TEST_CASE("NormalizeAngle can shift and scale an angle (in radians) from any non
 
 		RunScalarTest(result, expected);
 	}
+
+	SECTION("-4PI/3")
+	{
+		float value = -4 * F_PI / 3;
+		float result = NormalizeAngle(value);
+		float expected = 2 * F_PI / 3;
+
+		RunScalarTest(result, expected);
+	}
 }
 
 TEST_CASE("FastSinApprox can approximate sine within 0.01 margin of error from the standard implementation, within the range [-PI,PI)")
@@ -1716,6 +1725,196 @@ TEST_CASE("CotApprox can approximate the cotangent within varying levels of accu
 	}
 }
 
+TEST_CASE("SinApprox and CosApprox stay within their precision level across the full range [-PI,PI)")
+{
+	const int NUM_SAMPLES = 4096;
+
+	for (int i = 0; i < NUM_SAMPLES; ++i)
+	{
+		float value = -F_PI + i * (F_2PI / NUM_SAMPLES);
+
+		RunScalarTest(SinApprox(value), sinf(value));
+		RunScalarTest(CosApprox(value), cosf(value));
+		RunScalarTest<FloatPrecision::MEDIUM_HIGH>(SinApprox<FloatPrecision::MEDIUM_HIGH>(value), sinf(value));
+		RunScalarTest<FloatPrecision::MEDIUM_HIGH>(CosApprox<FloatPrecision::MEDIUM_HIGH>(value), cosf(value));
+	}
+}
+
+TEST_CASE("ReduceAngleCodyWaite reduces an angle to [-PI/4,PI/4] and reports its quadrant")
+{
+	int quadrant;
+
+	SECTION("Quadrant multiples")
+	{
+		RunScalarTest(ReduceAngleCodyWaite(0.0f, quadrant), 0.0f);
+		CHECK(quadrant == 0);
+		RunScalarTest(ReduceAngleCodyWaite(F_PI_2, quadrant), 0.0f);
+		CHECK(quadrant == 1);
+		RunScalarTest(ReduceAngleCodyWaite(F_PI, quadrant), 0.0f);
+		CHECK(quadrant == 2);
+		RunScalarTest(ReduceAngleCodyWaite(-F_PI_2, quadrant), 0.0f);
+		CHECK(quadrant == 3);
+	}
+
+	SECTION("Offsets from the quadrant multiples")
+	{
+		RunScalarTest(ReduceAngleCodyWaite(F_PI_2 + 0.5f, quadrant), 0.5f);
+		CHECK(quadrant == 1);
+		RunScalarTest(ReduceAngleCodyWaite(-F_PI - 0.25f, quadrant), -0.25f);
+		CHECK(quadrant == 2);
+		RunScalarTest(ReduceAngleCodyWaite(-0.7f, quadrant), -0.7f);
+		CHECK(quadrant == 0);
+	}
+
+	SECTION("Past the supported range, where k no longer fits in an int")
+	{
+		// k = 26101410 and 6366197000 (or their negations), both rounded to floats
+		CHECK(std::isfinite(ReduceAngleCodyWaite(4.1e7f, quadrant)));
+		CHECK(quadrant == 2);
+		CHECK(std::isfinite(ReduceAngleCodyWaite(-4.1e7f, quadrant)));
+		CHECK(quadrant == 2);
+		CHECK(std::isfinite(ReduceAngleCodyWaite(1e10f, quadrant)));
+		CHECK(quadrant == 0);
+		CHECK(std::isfinite(ReduceAngleCodyWaite(-1e10f, quadrant)));
+		CHECK(quadrant == 0);
+	}
+}
+
+TEST_CASE("SinApprox, CosApprox and TanApprox stay within their precision level for large angles with CODY_WAITE reduction")
+{
+	const int NUM_SAMPLES = 4096;
+	const float RANGE = 1.0e+5f;
+
+	for (int i = 0; i < NUM_SAMPLES; ++i)
+	{
+		float value = -RANGE + i * (2.0f * RANGE / NUM_SAMPLES) + 0.1f;
+		float tangent = tanf(value);
+
+		RunScalarTest(SinApprox<FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(value), sinf(value));
+		RunScalarTest(CosApprox<FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(value), cosf(value));
+		RunScalarTest<FloatPrecision::MEDIUM_HIGH>(SinApprox<FloatPrecision::MEDIUM_HIGH, AngleReduction::CODY_WAITE>(value), sinf(value));
+		RunScalarTest<FloatPrecision::MEDIUM_HIGH>(CosApprox<FloatPrecision::MEDIUM_HIGH, AngleReduction::CODY_WAITE>(value), cosf(value));
+		RunScalarTest<FloatPrecision::MEDIUM>(SinApprox<FloatPrecision::MEDIUM, AngleReduction::CODY_WAITE>(value), sinf(value));
+		RunScalarTest<FloatPrecision::MEDIUM_LOW>(CosApprox<FloatPrecision::MEDIUM_LOW, AngleReduction::CODY_WAITE>(value), cosf(value));
+
+		if (tangent > -1.0f && tangent < 1.0f)
+		{
+			RunScalarTest(TanApprox<FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(value), tangent);
+			RunScalarTest(1.0f / CotApprox<FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(value), tangent);
+		}
+	}
+}
+
+TEST_CASE("Floor rounds down to the nearest integer, matching std::floor")
+{
+	const float VALUES[] = { 0.0f, 0.25f, -0.25f, 1.0f, -1.0f, 1.5f, -1.5f, 8388607.5f, -8388607.5f, 1.0e+10f, -1.0e+10f };
+
+	for (float value : VALUES)
+	{
+		INFO("VALUE: " << value);
+		CHECK(Floor(value) == std::floor(value));
+	}
+
+	CHECK(Floor(Infinity()) == Infinity());
+	CHECK(IsNaN(Floor(std::numeric_limits<float>::quiet_NaN())));
+}
+
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+TEST_CASE("SinApprox, CosApprox and TanApprox can be evaluated at compile time, matching their runtime results")
+{
+	static_assert(Floor(-0.25f) == -1.0f && Floor(1.5f) == 1.0f && Floor(-2.0f) == -2.0f, "Floor must be a constant expression");
+
+	constexpr float SIN_PI_3 = SinApprox(F_PI_3);
+	constexpr float COS_3PI_4 = CosApprox(F_3PI_4);
+	constexpr float TAN_PI_3 = TanApprox(F_PI_3);
+	constexpr float SIN_NEG = SinApprox<FloatPrecision::MEDIUM>(-100.0f);
+
+	static_assert(SIN_PI_3 > 0.8660f && SIN_PI_3 < 0.8661f, "SinApprox must be a constant expression");
+	static_assert(COS_3PI_4 > -0.7072f && COS_3PI_4 < -0.7071f, "CosApprox must be a constant expression");
+
+	volatile float pi3 = F_PI_3;
+	volatile float threePi4 = F_3PI_4;
+	volatile float neg = -100.0f;
+
+	CHECK(SIN_PI_3 == SinApprox(pi3));
+	CHECK(COS_3PI_4 == CosApprox(threePi4));
+	CHECK(TAN_PI_3 == TanApprox(pi3));
+	CHECK(SIN_NEG == SinApprox<FloatPrecision::MEDIUM>(neg));
+}
+#endif
+
+TEST_CASE("AtanApprox can approximate the arctangent within varying levels of accuracy, given specific settings")
+{
+	const int TEST_COUNT = 6;
+	const float values[TEST_COUNT] = { 0.0f, 0.25f, -1.0f, F_SQRT3, -8.0f, 1.0e6f };
+
+	for (int i = 0; i < TEST_COUNT; ++i)
+	{
+		float expected = atanf(values[i]);
+
+		RunScalarTest<FloatPrecision::HIGH>(AtanApprox<FloatPrecision::HIGH>(values[i]), expected);
+		RunScalarTest<FloatPrecision::MEDIUM_HIGH>(AtanApprox<FloatPrecision::MEDIUM_HIGH>(values[i]), expected);
+		RunScalarTest<FloatPrecision::MEDIUM>(AtanApprox<FloatPrecision::MEDIUM>(values[i]), expected);
+		RunScalarTest<FloatPrecision::MEDIUM_LOW>(AtanApprox<FloatPrecision::MEDIUM_LOW>(values[i]), expected);
+		RunScalarTest<FloatPrecision::LOW>(AtanApprox<FloatPrecision::LOW>(values[i]), expected);
+	}
+
+	SECTION("Infinity")
+	{
+		RunScalarTest(AtanApprox(Infinity()), F_PI_2);
+		RunScalarTest(AtanApprox(-Infinity()), -F_PI_2);
+	}
+
+	SECTION("NaN")
+	{
+		CHECK(IsNaN(AtanApprox(NAN)));
+	}
+}
+
+TEST_CASE("Atan2Approx follows the quadrant conventions of std::atan2")
+{
+	const int TEST_COUNT = 10;
+	const float ys[TEST_COUNT] = { 1.0f,  1.0f, -1.0f, -1.0f, 0.0f,  0.0f, -0.0f, 2.0f, Infinity(), -3.0f };
+	const float xs[TEST_COUNT] = { 1.0f, -1.0f, -1.0f,  1.0f, 0.0f, -0.0f, -1.0f, 0.0f, -Infinity(), 0.5f };
+
+	for (int i = 0; i < TEST_COUNT; ++i)
+	{
+		INFO("y: " << ys[i] << " x: " << xs[i]);
+		float expected = atan2f(ys[i], xs[i]);
+
+		RunScalarTest<FloatPrecision::HIGH>(Atan2Approx<FloatPrecision::HIGH>(ys[i], xs[i]), expected);
+		RunScalarTest<FloatPrecision::MEDIUM>(Atan2Approx<FloatPrecision::MEDIUM>(ys[i], xs[i]), expected);
+		RunScalarTest<FloatPrecision::LOW>(Atan2Approx<FloatPrecision::LOW>(ys[i], xs[i]), expected);
+	}
+
+	SECTION("NaN")
+	{
+		CHECK(IsNaN(Atan2Approx(NAN, 1.0f)));
+		CHECK(IsNaN(Atan2Approx(0.0f, NAN)));
+	}
+}
+
+TEST_CASE("AsinApprox and AcosApprox stay within their precision level across [-1,1]")
+{
+	const int NUM_SAMPLES = 1024;
+
+	for (int i = 0; i <= NUM_SAMPLES; ++i)
+	{
+		float value = -1.0f + i * (2.0f / NUM_SAMPLES);
+
+		RunScalarTest(AsinApprox(value), asinf(value));
+		RunScalarTest(AcosApprox(value), acosf(value));
+		RunScalarTest<FloatPrecision::MEDIUM>(AsinApprox<FloatPrecision::MEDIUM>(value), asinf(value));
+		RunScalarTest<FloatPrecision::MEDIUM>(AcosApprox<FloatPrecision::MEDIUM>(value), acosf(value));
+	}
+
+	SECTION("Out of range")
+	{
+		CHECK(IsNaN(AsinApprox(1.5f)));
+		CHECK(IsNaN(AcosApprox(-1.5f)));
+	}
+}
+
 TEST_CASE("ApproxEqual can determine whether or not two floating point numbers are approximately the same, within a given window of accuracy")
 {
 	SECTION("Returns true")
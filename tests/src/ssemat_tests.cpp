@@ -49,6 +49,15 @@ SseMat44 MiscSseMat44Identity()
 	return result;
 }
 
+// A rotation about the given (not necessarily unit) axis followed by the given translation.  Pick a
+// general axis and angle; a rotation that only permutes the axes can hide components stored in the
+// wrong lane.
+SseMat44 RigidSseMat44(float x, float y, float z, float axisX, float axisY, float axisZ, float angle)
+{
+	return MatrixMultiply(TranslationMatrixFromVec3(SetSseVec3_Debug(x, y, z)),
+		RotationMatrixFromQuaternion(QuaternionFromAxisAngle(SetSseVec3_Debug(axisX, axisY, axisZ), angle)));
+}
+
 void RunLookDirTest(float eyeX, float eyeY, float eyeZ)
 {
 	const SseVec EYE = SetSseVec3_Debug(eyeX, eyeY, eyeZ);
@@ -65,7 +74,7 @@ void RunLookDirTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E1(),
 		Vec4::E2(),
-		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f)
+		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -80,7 +89,7 @@ void RunLookDirTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E2(),
 		Vec4::NegE1(),
-		Vec4(-eyeX, eyeZ, -eyeY, 1.0f)
+		Vec4(-eyeX, eyeZ, -eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -95,7 +104,7 @@ void RunLookDirTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E2(),
 		Vec4::E1(),
 		Vec4::NegE0(),
-		Vec4(eyeZ, -eyeY, -eyeX, 1.0f)
+		Vec4(eyeZ, -eyeY, -eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -110,7 +119,7 @@ void RunLookDirTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE0(),
 		Vec4::E1(),
 		Vec4::NegE2(),
-		Vec4(eyeX, -eyeY, eyeZ, 1.0f)
+		Vec4(eyeX, -eyeY, eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -125,7 +134,7 @@ void RunLookDirTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::NegE2(),
 		Vec4::E1(),
-		Vec4(-eyeX, -eyeZ, eyeY, 1.0f)
+		Vec4(-eyeX, -eyeZ, eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -140,7 +149,7 @@ void RunLookDirTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE2(),
 		Vec4::E1(),
 		Vec4::E0(),
-		Vec4(-eyeZ, -eyeY, eyeX, 1.0f)
+		Vec4(-eyeZ, -eyeY, eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -162,7 +171,7 @@ void RunLookAtTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E1(),
 		Vec4::E2(),
-		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f)
+		Vec4(-eyeX, -eyeY, -eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -177,7 +186,7 @@ void RunLookAtTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::E2(),
 		Vec4::NegE1(),
-		Vec4(-eyeX, eyeZ, -eyeY, 1.0f)
+		Vec4(-eyeX, eyeZ, -eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -192,7 +201,7 @@ void RunLookAtTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E2(),
 		Vec4::E1(),
 		Vec4::NegE0(),
-		Vec4(eyeZ, -eyeY, -eyeX, 1.0f)
+		Vec4(eyeZ, -eyeY, -eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -207,7 +216,7 @@ void RunLookAtTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE0(),
 		Vec4::E1(),
 		Vec4::NegE2(),
-		Vec4(eyeX, -eyeY, eyeZ, 1.0f)
+		Vec4(eyeX, -eyeY, eyeZ, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -222,7 +231,7 @@ void RunLookAtTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::E0(),
 		Vec4::NegE2(),
 		Vec4::E1(),
-		Vec4(-eyeX, -eyeZ, eyeY, 1.0f)
+		Vec4(-eyeX, -eyeZ, eyeY, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -237,7 +246,7 @@ void RunLookAtTest(float eyeX, float eyeY, float eyeZ)
 		Vec4::NegE2(),
 		Vec4::E1(),
 		Vec4::E0(),
-		Vec4(-eyeZ, -eyeY, eyeX, 1.0f)
+		Vec4(-eyeZ, -eyeY, eyeX, 1.0f), MatrixType::RIGID
 		);
 
 	RunSseMat44Test(result, expected);
@@ -342,6 +351,103 @@ TEST_CASE("MatrixInverse for SseMat44 can produce the proper inverse of invertib
 	}
 }
 
+TEST_CASE("MatrixInverse for SseMat44 follows the given PrecisionPolicy", "[SseMat44]")
+{
+	SseMat44 scaleTranslate = SseMat44(Vec4(2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 4.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 0.5f, 0.0f), Vec4(1.0f, -2.0f, 3.0f, 1.0f));
+	SseMat44 expected = SseMat44(Vec4(0.5f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 0.25f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 2.0f, 0.0f), Vec4(-0.5f, 0.5f, -6.0f, 1.0f));
+	SseMat44 nonInvertible = SseMat44(Vec4::Zero(), Vec4::E1(), Vec4::E2(), Vec4::E3());
+
+	SECTION("EXACT")
+	{
+		RunSseMat44Test<FloatPrecision::HIGH>(MatrixInverse<PrecisionPolicy::EXACT>(scaleTranslate), expected);
+		RunSseMat44InvalidTest(MatrixInverse<PrecisionPolicy::EXACT>(nonInvertible));
+	}
+
+	SECTION("REFINED")
+	{
+		RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(MatrixInverse<PrecisionPolicy::REFINED>(scaleTranslate), expected);
+		RunSseMat44InvalidTest(MatrixInverse<PrecisionPolicy::REFINED>(nonInvertible));
+	}
+
+	SECTION("ESTIMATE")
+	{
+		RunSseMat44Test<FloatPrecision::MEDIUM_LOW>(MatrixInverse<PrecisionPolicy::ESTIMATE>(scaleTranslate), expected);
+		RunSseMat44InvalidTest(MatrixInverse<PrecisionPolicy::ESTIMATE>(nonInvertible));
+	}
+}
+
+TEST_CASE("MatrixMultiply and MatrixInverse for SseMat44 take the affine fast paths with the same results as the general paths", "[SseMat44][MatrixType]")
+{
+	// RotationMatrixFromEuler uses the approximated trig functions, so build an exactly orthonormal rotation instead
+	SseMat44 rotation = RotationMatrixFromQuaternion(SetSseVec4(0.5f, -0.5f, 0.5f, 0.5f));
+	SseMat44 translation = TranslationMatrixFromVec3(SetSseVec3_Debug(1.0f, -2.0f, 3.0f));
+	SseMat44 scale = ScaleMatrixFromVec3(SetSseVec3_Debug(2.0f, 0.5f, 4.0f));
+
+	SseMat44 rigid = MatrixMultiply(translation, rotation);
+	SseMat44 affine = MatrixMultiply(rigid, scale);
+
+	SECTION("Multiplication")
+	{
+		SseMat44 generalRotation = rotation;
+		SseMat44 generalTranslation = translation;
+		SseMat44 generalScale = scale;
+		generalRotation.matrixTypeVal = MatrixType::MISC;
+		generalTranslation.matrixTypeVal = MatrixType::MISC;
+		generalScale.matrixTypeVal = MatrixType::MISC;
+
+		SseMat44 expectedRigid = MatrixMultiply(generalTranslation, generalRotation);
+		expectedRigid.matrixTypeVal = MatrixType::RIGID;
+		RunSseMat44Test<FloatPrecision::HIGH>(rigid, expectedRigid);
+
+		SseMat44 expectedAffine = MatrixMultiply(expectedRigid, generalScale);
+		expectedAffine.matrixTypeVal = MatrixType::AFFINE;
+		RunSseMat44Test<FloatPrecision::HIGH>(affine, expectedAffine);
+	}
+
+	SECTION("Identity factors are returned unchanged")
+	{
+		RunSseMat44Test<FloatPrecision::HIGH>(MatrixMultiply(SseMat44::IDENTITY, affine), affine);
+		RunSseMat44Test<FloatPrecision::HIGH>(MatrixMultiply(rigid, SseMat44::IDENTITY), rigid);
+	}
+
+	SECTION("Rigid inverse")
+	{
+		SseMat44 general = rigid;
+		general.matrixTypeVal = MatrixType::MISC;
+
+		SseMat44 expected = MatrixInverse<PrecisionPolicy::EXACT>(general);
+		expected.matrixTypeVal = MatrixType::RIGID;
+
+		RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(MatrixInverse(rigid), expected);
+		RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(RigidMatrixInverse(rigid), expected);
+	}
+
+	SECTION("Affine inverse")
+	{
+		SseMat44 general = affine;
+		general.matrixTypeVal = MatrixType::MISC;
+
+		SseMat44 expected = MatrixInverse<PrecisionPolicy::EXACT>(general);
+		expected.matrixTypeVal = MatrixType::AFFINE;
+
+		RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(MatrixInverse<PrecisionPolicy::EXACT>(affine), expected);
+		RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(AffineMatrixInverse<PrecisionPolicy::REFINED>(affine), expected);
+	}
+
+	SECTION("Singular affine matrix")
+	{
+		SseMat44 singular = ScaleMatrixFromVec3(SetSseVec3_Debug(1.0f, 0.0f, 1.0f));
+		RunSseMat44InvalidTest(MatrixInverse(singular));
+	}
+
+	SECTION("Transposing moves the translation out of the affine classes")
+	{
+		CHECK(MatrixTranspose(rotation).matrixTypeVal == MatrixType::ROTATION);
+		CHECK(MatrixTranspose(translation).matrixTypeVal == MatrixType::PROJECTIVE);
+		CHECK(MatrixTranspose(affine).matrixTypeVal == MatrixType::PROJECTIVE);
+	}
+}
+
 TEST_CASE("MatrixTranspose for SseMat44 can produce the proper transpose of a matrix", "[SseMat44]")
 {
 	SECTION("I-T = I")
@@ -425,7 +531,7 @@ TEST_CASE("RotationMatrixFromQuaternion can calculate the associated rotation ma
 			Vec4::E0(),
 			Vec4(0.0f, 0.0f, 1.0f, 0.0f),
 			Vec4(0.0f, -1.0f, 0.0f, 0.0f),
-			Vec4::E3()
+			Vec4::E3(), MatrixType::ROTATION
 			);
 
 		RunSseMat44Test(result, expected);
@@ -439,7 +545,7 @@ TEST_CASE("RotationMatrixFromQuaternion can calculate the associated rotation ma
 			Vec4(0.0f, 0.0f, -1.0f, 0.0f),
 			Vec4::E1(),
 			Vec4(1.0f, 0.0f, 0.0f, 0.0f),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunSseMat44Test(result, expected);
 	}
@@ -452,7 +558,7 @@ TEST_CASE("RotationMatrixFromQuaternion can calculate the associated rotation ma
 			Vec4(0.0f, 1.0f, 0.0f, 0.0f),
 			Vec4(-1.0f, 0.0f, 0.0f, 0.0f),
 			Vec4::E2(),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunSseMat44Test(result, expected);
 	}
@@ -468,7 +574,7 @@ TEST_CASE("RotationMatrixFromEuler can calculate the associated rotation matrix
 			Vec4::E0(),
 			Vec4(0.0f, 0.0f, 1.0f, 0.0f),
 			Vec4(0.0f, -1.0f, 0.0f, 0.0f),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunSseMat44Test(result, expected);
 	}
@@ -481,7 +587,7 @@ TEST_CASE("RotationMatrixFromEuler can calculate the associated rotation matrix
 			Vec4(0.0f, 0.0f, -1.0f, 0.0f),
 			Vec4::E1(),
 			Vec4(1.0f, 0.0f, 0.0f, 0.0f),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunSseMat44Test(result, expected);
 	}
@@ -494,7 +600,7 @@ TEST_CASE("RotationMatrixFromEuler can calculate the associated rotation matrix
 			Vec4(0.0f, 1.0f, 0.0f, 0.0f),
 			Vec4(-1.0f, 0.0f, 0.0f, 0.0f),
 			Vec4::E2(),
-			Vec4::E3());
+			Vec4::E3(), MatrixType::ROTATION);
 
 		RunSseMat44Test(result, expected);
 	}
@@ -507,7 +613,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		SseVec vec = SetSseVec3_Debug(0.0f, 0.0f, 0.0f);
 		SseMat44 result = TranslationMatrixFromVec3(vec);
 		SseMat44 expected = SseMat44::IDENTITY;
-		expected.matrixTypeVal = MatrixType::MISC;
+		expected.matrixTypeVal = MatrixType::TRANSLATION;
 
 		RunSseMat44Test(result, expected);
 	}
@@ -518,7 +624,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(1.0f, 0.0f, 0.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, 0.0f, 0.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(1.0f, 0.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -527,7 +633,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, 1.0f, 0.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 1.0f, 0.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 1.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -536,7 +642,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, 0.0f, 1.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, 1.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, 1.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -545,7 +651,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(-1.0f, 0.0f, 0.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 0.0f, 0.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, 0.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -554,7 +660,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, -1.0f, 0.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, -1.0f, 0.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, -1.0f, 0.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -563,7 +669,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, 0.0f, -1.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, -1.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(0.0f, 0.0f, -1.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -575,7 +681,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(1.0f, 1.0f, 1.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4::One());
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4::One(), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -584,7 +690,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(-1.0f, -1.0f, -1.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f, -1.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f, -1.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -595,7 +701,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 			{
 				SseVec vec = SetSseVec3_Debug(-1.0f,  1.0f,  1.0f);
 				SseMat44 result = TranslationMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f,  1.0f,  1.0f,  1.0f));
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f,  1.0f,  1.0f,  1.0f), MatrixType::TRANSLATION);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -603,7 +709,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 			{
 				SseVec vec = SetSseVec3_Debug( 1.0f, -1.0f,  1.0f);
 				SseMat44 result = TranslationMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4( 1.0f, -1.0f,  1.0f,  1.0f));
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4( 1.0f, -1.0f,  1.0f,  1.0f), MatrixType::TRANSLATION);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -611,7 +717,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 			{
 				SseVec vec = SetSseVec3_Debug( 1.0f,  1.0f, -1.0f);
 				SseMat44 result = TranslationMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4( 1.0f,  1.0f, -1.0f,  1.0f));
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4( 1.0f,  1.0f, -1.0f,  1.0f), MatrixType::TRANSLATION);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -621,7 +727,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 			{
 				SseVec vec = SetSseVec3_Debug( 1.0f, -1.0f, -1.0f);
 				SseMat44 result = TranslationMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4( 1.0f, -1.0f, -1.0f,  1.0f));
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4( 1.0f, -1.0f, -1.0f,  1.0f), MatrixType::TRANSLATION);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -629,7 +735,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 			{
 				SseVec vec = SetSseVec3_Debug(-1.0f,  1.0f, -1.0f);
 				SseMat44 result = TranslationMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f,  1.0f, -1.0f,  1.0f));
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f,  1.0f, -1.0f,  1.0f), MatrixType::TRANSLATION);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -637,7 +743,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 			{
 				SseVec vec = SetSseVec3_Debug(-1.0f, -1.0f, 1.0f);
 				SseMat44 result = TranslationMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f,  1.0f,  1.0f));
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-1.0f, -1.0f,  1.0f,  1.0f), MatrixType::TRANSLATION);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -650,7 +756,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(2.0f, 30.0f, 400.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(2.0f, 30.0f, 400.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(2.0f, 30.0f, 400.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -659,7 +765,7 @@ TEST_CASE("TranslationMatrixFromVec3 can produce a translation matrix from a giv
 		{
 			SseVec vec = SetSseVec3_Debug(-2.0f, -30.0f, -400.0f);
 			SseMat44 result = TranslationMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-2.0f, -30.0f, -400.0f, 1.0f));
+			SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::E2(), Vec4(-2.0f, -30.0f, -400.0f, 1.0f), MatrixType::TRANSLATION);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -673,7 +779,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		SseVec vec = SetSseVec3_Debug(0.0f, 0.0f, 0.0f);
 		SseMat44 result = ScaleMatrixFromVec3(vec);
 		SseMat44 expected = SseMat44(Vec4::Zero(), Vec4::Zero(), Vec4::Zero(), Vec4::E3());
-		expected.matrixTypeVal = MatrixType::MISC;
+		expected.matrixTypeVal = MatrixType::UNIFORM_SCALE;
 
 		RunSseMat44Test(result, expected);
 	}
@@ -684,7 +790,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(1.0f, 0.0f, 0.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4(1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4(1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -693,7 +799,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, 1.0f, 0.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4(0.0f, 1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4(0.0f, 1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -702,7 +808,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, 0.0f, 1.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, 1.0f, 0.0f), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, 1.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -711,7 +817,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(-1.0f, 0.0f, 0.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4(-1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4(-1.0f, 0.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -720,7 +826,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, -1.0f, 0.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4(0.0f, -1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4(0.0f, -1.0f, 0.0f, 0.0f), Vec4::Zero(), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -729,7 +835,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(0.0f, 0.0f, -1.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, -1.0f, 0.0f), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4::Zero(), Vec4::Zero(), Vec4(0.0f, 0.0f, -1.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -742,7 +848,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 			SseVec vec = SetSseVec3_Debug(1.0f, 1.0f, 1.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
 			SseMat44 expected = SseMat44::IDENTITY;
-			expected.matrixTypeVal = MatrixType::MISC;
+			expected.matrixTypeVal = MatrixType::UNIFORM_SCALE;
 
 			RunSseMat44Test(result, expected);
 		}
@@ -751,7 +857,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(-1.0f, -1.0f, -1.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3(), MatrixType::UNIFORM_SCALE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -762,7 +868,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 			{
 				SseVec vec = SetSseVec3_Debug(-1.0f, 1.0f, 1.0f);
 				SseMat44 result = ScaleMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::E1(), Vec4::E2(), Vec4::E3());
+				SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::E1(), Vec4::E2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -770,7 +876,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 			{
 				SseVec vec = SetSseVec3_Debug(1.0f, -1.0f, 1.0f);
 				SseMat44 result = ScaleMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3());
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -778,7 +884,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 			{
 				SseVec vec = SetSseVec3_Debug(1.0f, 1.0f, -1.0f);
 				SseMat44 result = ScaleMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3());
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -788,7 +894,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 			{
 				SseVec vec = SetSseVec3_Debug(1.0f, -1.0f, -1.0f);
 				SseMat44 result = ScaleMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3());
+				SseMat44 expected = SseMat44(Vec4::E0(), Vec4::NegE1(), Vec4::NegE2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -796,7 +902,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 			{
 				SseVec vec = SetSseVec3_Debug(-1.0f, 1.0f, -1.0f);
 				SseMat44 result = ScaleMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3());
+				SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::E1(), Vec4::NegE2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -804,7 +910,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 			{
 				SseVec vec = SetSseVec3_Debug(-1.0f, -1.0f, 1.0f);
 				SseMat44 result = ScaleMatrixFromVec3(vec);
-				SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3());
+				SseMat44 expected = SseMat44(Vec4::NegE0(), Vec4::NegE1(), Vec4::E2(), Vec4::E3(), MatrixType::AFFINE);
 
 				RunSseMat44Test(result, expected);
 			}
@@ -817,7 +923,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(2.0f, 30.0f, 400.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4(2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 400.0f, 0.0f), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4(2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, 30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, 400.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -826,7 +932,7 @@ TEST_CASE("ScaleMatrixFromVec3 can produce a scale matrix from a given SseVec re
 		{
 			SseVec vec = SetSseVec3_Debug(-2.0f, -30.0f, -400.0f);
 			SseMat44 result = ScaleMatrixFromVec3(vec);
-			SseMat44 expected = SseMat44(Vec4(-2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, -30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, -400.0f, 0.0f), Vec4::E3());
+			SseMat44 expected = SseMat44(Vec4(-2.0f, 0.0f, 0.0f, 0.0f), Vec4(0.0f, -30.0f, 0.0f, 0.0f), Vec4(0.0f, 0.0f, -400.0f, 0.0f), Vec4::E3(), MatrixType::AFFINE);
 
 			RunSseMat44Test(result, expected);
 		}
@@ -969,6 +1075,32 @@ TEST_CASE("PerspectiveProjectionMatrix can produce a perspective projection matr
 	}
 }
 
+TEST_CASE("PerspectiveProjectionMatrix follows the given PrecisionPolicy", "[SseMat44][Projection Matrix]")
+{
+	static const float FOUR_THIRDS = 4.0f / 3.0f;
+	SseMat44 expected = SseMat44(
+		Vec4(1.0f, 0.0f, 0.0f, 0.0f),
+		Vec4(0.0f, FOUR_THIRDS, 0.0f, 0.0f),
+		Vec4(0.0f, 0.0f, -1.0001f, -1.0f),
+		Vec4(0.0f, 0.0f, -0.10001f, 0.0f)
+		);
+
+	RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(PerspectiveProjectionMatrix<PrecisionPolicy::EXACT>(0.1f, 1000.0f, F_PI_2, FOUR_THIRDS), expected);
+	RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(PerspectiveProjectionMatrix<PrecisionPolicy::REFINED>(0.1f, 1000.0f, F_PI_2, FOUR_THIRDS), expected);
+	RunSseMat44Test<FloatPrecision::MEDIUM_LOW>(PerspectiveProjectionMatrix<PrecisionPolicy::ESTIMATE>(0.1f, 1000.0f, F_PI_2, FOUR_THIRDS), expected);
+
+	// The default (EXACT) policy keeps the scalar cotangent and divisions, bit for bit
+	float cotFOV = CotApprox(1.2f * 0.5f);
+	float farDistOverDepth = 500.0f / (500.0f - 0.3f);
+	array<float, 16> exact = MatrixToArray(PerspectiveProjectionMatrix(0.3f, 500.0f, 1.2f, 1.7f));
+
+	CHECK(exact[0] == cotFOV);
+	CHECK(exact[5] == cotFOV * 1.7f);
+	CHECK(exact[10] == -farDistOverDepth);
+	CHECK(exact[11] == -1.0f);
+	CHECK(exact[14] == -farDistOverDepth * 0.3f);
+}
+
 TEST_CASE("LookDir can produce a View matrix at the given position looking in the given direction","[SseMat44][View Matrix]")
 {
 	SECTION("At the origin")
@@ -1161,6 +1293,14 @@ TEST_CASE("TransformVec3 can produce a SseVec representation of a 3D vector that
 		CheckSseVec(result, expected);
 	}
 
+	SECTION("Typed identity and translation matrices")
+	{
+		SseVec value = SetSseVec3_Debug(3.0f, -4.0f, 5.0f);
+
+		CheckSseVec(TransformVec3(SseMat44::IDENTITY, value), value);
+		CheckSseVec(TransformVec3(TranslationMatrixFromVec3(SetSseVec3_Debug(1.0f, 2.0f, -3.0f)), value), SetSseVec3_Debug(4.0f, -2.0f, 2.0f));
+	}
+
 	SECTION("Rotation")
 	{
 		// Rotate by PI/2 on the x-axis
@@ -1195,4 +1335,652 @@ TEST_CASE("TransformVec3 can produce a SseVec representation of a 3D vector that
 
 		CheckSseVec(result, expected);
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("SseMat34 converts to and from SseMat44 and packs into float3x4 buffers", "[SseMat34][SseMat44]")
+{
+	SseMat44 affine = MatrixMultiply(
+		RigidSseMat44(1.0f, -2.0f, 3.0f, 1.0f, 2.0f, -2.0f, 0.7f),
+		ScaleMatrixFromVec3(SetSseVec3_Debug(2.0f, 0.5f, 4.0f)));
+
+	CHECK(sizeof(SseMat34) == 48);
+
+	SECTION("Round trip")
+	{
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(SseMat34(affine)), affine);
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(SseMat34::Identity(), MatrixType::IDENTITY), SseMat44::IDENTITY);
+	}
+
+	SECTION("Row-major layout")
+	{
+		SseMat34 mat = SseMat34(
+			0.0f, 1.0f, 2.0f, 3.0f,
+			4.0f, 5.0f, 6.0f, 7.0f,
+			8.0f, 9.0f, 10.0f, 11.0f);
+
+		std::array<float, 12> values = MatrixToArray(mat);
+		float buffer[13];
+		StoreFloat3x4(buffer + 1, mat);
+
+		for (size_t i = 0; i < 12; i++)
+		{
+			CHECK(values[i] == (float)i);
+			CHECK(buffer[i + 1] == (float)i);
+		}
+
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(LoadFloat3x4(buffer + 1)), ToSseMat44(mat));
+	}
+
+	SECTION("Batch packing")
+	{
+		SseMat44 mats[3] = { SseMat44::IDENTITY, affine, TranslationMatrixFromVec3(SetSseVec3_Debug(4.0f, 5.0f, 6.0f)) };
+		float buffer[36];
+		StoreFloat3x4(buffer, mats, 3);
+
+		for (size_t i = 0; i < 3; i++)
+		{
+			std::array<float, 12> expected = MatrixToArray(SseMat34(mats[i]));
+
+			for (size_t j = 0; j < 12; j++)
+			{
+				CHECK(buffer[12 * i + j] == expected[j]);
+			}
+		}
+	}
+}
+
+TEST_CASE("SseMat34 multiply, inverse and transforms match SseMat44", "[SseMat34][SseMat44]")
+{
+	SseMat44 left = MatrixMultiply(TranslationMatrixFromVec3(SetSseVec3_Debug(1.0f, -2.0f, 3.0f)), ScaleMatrixFromVec3(SetSseVec3_Debug(2.0f, 0.5f, 4.0f)));
+	SseMat44 right = RigidSseMat44(-3.0f, 0.5f, 2.0f, -2.0f, 1.0f, 3.0f, 1.9f);
+
+	SECTION("Multiplication")
+	{
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(MatrixMultiply(SseMat34(left), SseMat34(right))), MatrixMultiply(left, right));
+	}
+
+	SECTION("Inverse")
+	{
+		SseMat44 expected = MatrixInverse<PrecisionPolicy::EXACT>(left);
+
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(MatrixInverse<PrecisionPolicy::EXACT>(SseMat34(left))), expected);
+		RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(ToSseMat44(MatrixInverse(SseMat34(left))), expected);
+		CHECK(_mm_cvtss_f32(MatrixDeterminant(SseMat34(left))) == Approx(4.0f));
+	}
+
+	SECTION("Points and directions")
+	{
+		SseVec value = SetSseVec3_Debug(3.0f, -4.0f, 5.0f);
+
+		CheckSseVec(TransformVec3(SseMat34(right), value), TransformVec3(right, value));
+		CheckSseVec(TransformDirectionVec3(SseMat34(left), value), SetSseVec4(6.0f, -2.0f, 20.0f, 0.0f));
+	}
+}
+
+TEST_CASE("SseMat33 functions match their Mat33 counterparts", "[SseMat33][Mat33]")
+{
+	const Mat33 shear = Mat33(
+		2.0f, 1.0f, 0.0f,
+		0.0f, 3.0f, -1.0f,
+		0.5f, 0.0f, 4.0f);
+	const Mat33 rotation = RotationMat33FromQuaternion(Quaternion(0.5f, -0.5f, 0.5f, 0.5f));
+
+	const SseMat33 sseShear = SseMat33(shear);
+	const SseMat33 sseRotation = RotationMat33FromQuaternion(SetSseVec4(0.5f, -0.5f, 0.5f, 0.5f));
+
+	SECTION("Construction and conversion")
+	{
+		RunSseMat33Test(sseRotation, SseMat33(rotation));
+		CHECK(Mat33(sseShear) == shear);
+		RunSseMat33Test(SseMat33(ToSseMat44(sseShear)), sseShear);
+		RunSseMat33Test(SseMat33(SseMat44::IDENTITY), SseMat33::Identity());
+
+		std::array<float, 9> values = MatrixToArray(sseShear);
+		CHECK(values[0] == 2.0f);
+		CHECK(values[2] == 0.5f);
+		CHECK(values[3] == 1.0f);
+		CHECK(values[7] == -1.0f);
+	}
+
+	SECTION("Multiply, transpose and determinant")
+	{
+		RunSseMat33Test(MatrixMultiply(sseRotation, sseShear), SseMat33(MatrixMultiply(shear, rotation)));
+		RunSseMat33Test(MatrixTranspose(sseShear), SseMat33(MatrixTranspose(shear)));
+		CheckSseVec(TransformVec3(sseShear, SetSseVec3_Debug(1.0f, 2.0f, 3.0f)), SetSseVec4(4.0f, 3.0f, 12.5f, 0.0f));
+		CHECK(_mm_cvtss_f32(MatrixDeterminant(sseShear)) == Approx(MatrixDeterminant(shear)));
+	}
+
+	SECTION("Inverse and normal matrix")
+	{
+		RunSseMat33Test(MatrixInverse<PrecisionPolicy::EXACT>(sseShear), SseMat33(MatrixInverse(shear)));
+		RunSseMat33Test<FloatPrecision::MEDIUM_HIGH>(MatrixInverse(sseShear), SseMat33(MatrixInverse(shear)));
+
+		SseMat44 model = ToSseMat44(sseShear);
+		RunSseMat33Test(NormalMatrix<PrecisionPolicy::EXACT>(model), SseMat33(MatrixTranspose(MatrixInverse(shear))));
+		RunSseMat33Test(NormalMatrix(ToSseMat44(sseRotation, MatrixType::ROTATION)), sseRotation);
+	}
+
+	SECTION("Batches")
+	{
+		SseMat33 lefts[3] = { sseShear, sseRotation, SseMat33::Identity() };
+		SseMat33 rights[3] = { sseRotation, sseShear, sseShear };
+		SseMat33 results[3];
+
+		MatrixMultiplyBatch(lefts, rights, results, 3);
+		for (size_t i = 0; i < 3; i++)
+		{
+			RunSseMat33Test(results[i], MatrixMultiply(lefts[i], rights[i]));
+		}
+
+		MatrixInverseBatch<PrecisionPolicy::EXACT>(lefts, results, 3);
+		for (size_t i = 0; i < 3; i++)
+		{
+			RunSseMat33Test(results[i], MatrixInverse<PrecisionPolicy::EXACT>(lefts[i]));
+		}
+
+		SseVec vecs[3] = { SetSseVec3_Debug(1.0f, 2.0f, 3.0f), SetSseVec3_Debug(-1.0f, 0.0f, 2.0f), SetSseVec3_Debug(0.0f, 0.5f, 0.0f) };
+		SseVec transformed[3];
+		TransformVec3Batch(sseShear, vecs, transformed, 3);
+		for (size_t i = 0; i < 3; i++)
+		{
+			CheckSseVec(transformed[i], TransformVec3(sseShear, vecs[i]));
+		}
+	}
+}
+
+TEST_CASE("TransformVec3PBatch for SseMat44 and SseMat33 transforms packed Vec3P arrays in place", "[SseMat44][SseMat33][3D]")
+{
+	const SseMat44 mat = RigidSseMat44(0.5f, 4.0f, -1.5f, 3.0f, -1.0f, 2.0f, 2.4f);
+	const SseMat33 shear(SetSseVec3_Debug(2.0f, 0.0f, 0.5f), SetSseVec3_Debug(1.0f, 3.0f, 0.0f), SetSseVec3_Debug(0.0f, -1.0f, 4.0f));
+
+	const size_t COUNT = 6;
+	Vec3P packed[COUNT];
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		packed[i] = Vec3P(1.0f + i, -0.5f * i, 2.0f - i);
+	}
+
+	Vec3P points[COUNT];
+	std::copy(packed, packed + COUNT, points);
+	TransformVec3PBatch(mat, points, points, COUNT);
+
+	Vec3P normals[COUNT];
+	TransformVec3PBatch(shear, packed, normals, COUNT);
+
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		CheckSseVec(LoadSseVec3P(points[i]), TransformVec3(mat, LoadSseVec3P(packed[i])));
+		CheckSseVec(VecAnd(LoadSseVec3P(normals[i]), MASK_1110), VecAnd(TransformVec3(shear, LoadSseVec3P(packed[i])), MASK_1110));
+	}
+}
+
+TEST_CASE("Batch functions give the same results with STREAMING stores and input prefetching", "[SseMat44][SseMat33][3D]")
+{
+	const SseMat44 mat = RigidSseMat44(-2.0f, 1.5f, 0.25f, 1.0f, 1.0f, 4.0f, -1.1f);
+	const SseMat33 shear(SetSseVec3_Debug(2.0f, 0.0f, 0.5f), SetSseVec3_Debug(1.0f, 3.0f, 0.0f), SetSseVec3_Debug(0.0f, -1.0f, 4.0f));
+	const SseVec quat = SetSseVec4(0.2f, -0.4f, 0.4f, 0.8f);
+
+	// 9 elements: two blocks of four and a tail, with prefetches running past the end
+	const size_t COUNT = 9;
+	SseVec vecs[COUNT];
+	ALIGNED_TYPE(Vec3P, 16) packed[COUNT + 1];
+	SseMat44 mats[COUNT];
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		packed[i] = Vec3P(1.0f + i, -0.5f * i, 2.0f - i);
+		vecs[i] = LoadSseVec3P(packed[i]);
+		mats[i] = TranslationMatrixFromVec3(vecs[i]);
+	}
+
+	SECTION("SseVec outputs")
+	{
+		SseVec cached[COUNT];
+		SseVec streamed[COUNT];
+
+		TransformVec3Batch(mat, vecs, cached, COUNT);
+		TransformVec3Batch<StorePolicy::STREAMING, 4>(mat, vecs, streamed, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CheckSseVec(streamed[i], cached[i]);
+		}
+
+		TransformVec3Batch(shear, vecs, cached, COUNT);
+		TransformVec3Batch<StorePolicy::STREAMING, 4>(shear, vecs, streamed, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CheckSseVec(streamed[i], cached[i]);
+		}
+
+		QuaternionRotateVec3Batch(quat, vecs, cached, COUNT);
+		QuaternionRotateVec3Batch<StorePolicy::STREAMING, 4>(quat, vecs, streamed, COUNT);
+		LoadSseVec3PBatch<StorePolicy::STREAMING, 4>(packed, vecs, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CheckSseVec(streamed[i], cached[i]);
+			CheckSseVec(vecs[i], LoadSseVec3P(packed[i]));
+		}
+	}
+
+	SECTION("Matrix outputs")
+	{
+		SseMat44 cached[COUNT];
+		SseMat44 streamed[COUNT];
+
+		MatrixMultiplyBatch(mats, mats, cached, COUNT);
+		MatrixMultiplyBatch<StorePolicy::STREAMING, 2>(mats, mats, streamed, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			RunSseMat44Test(streamed[i], cached[i]);
+			RunSseMat44Test(cached[i], MatrixMultiply(mats[i], mats[i]));
+		}
+
+		SseMat33 lefts[3] = { shear, shear, SseMat33::Identity() };
+		SseMat33 cached33[3];
+		SseMat33 streamed33[3];
+		MatrixInverseBatch<PrecisionPolicy::EXACT>(lefts, cached33, 3);
+		MatrixInverseBatch<PrecisionPolicy::EXACT, StorePolicy::STREAMING, 1>(lefts, streamed33, 3);
+		for (size_t i = 0; i < 3; i++)
+		{
+			RunSseMat33Test(streamed33[i], cached33[i]);
+		}
+	}
+
+	SECTION("Packed Vec3P outputs, aligned and unaligned")
+	{
+		Vec3P cached[COUNT];
+		ALIGNED_TYPE(Vec3P, 16) streamed[COUNT + 1];
+
+		TransformVec3PBatch(mat, packed, cached, COUNT);
+		TransformVec3PBatch<StorePolicy::STREAMING, 4>(mat, packed, streamed, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			RunVec3Test(streamed[i], cached[i]);
+		}
+
+		// results + 1 is not 16-byte aligned, so the blocks fall back to ordinary stores
+		TransformVec3PBatch<StorePolicy::STREAMING, 4>(shear, packed, streamed + 1, COUNT);
+		TransformVec3PBatch(shear, packed, cached, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			RunVec3Test(streamed[i + 1], cached[i]);
+		}
+
+		QuaternionRotateVec3PBatch(quat, packed, cached, COUNT);
+		QuaternionRotateVec3PBatch<StorePolicy::STREAMING>(quat, packed, streamed, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			RunVec3Test(streamed[i], cached[i]);
+		}
+
+		StoreSseVec3PBatch<StorePolicy::STREAMING>(vecs, streamed, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			RunVec3Test(streamed[i], packed[i]);
+		}
+	}
+}
+
+TEST_CASE("Strided Vec3P kernels transform, normalize and skin attributes inside interleaved vertex buffers", "[SseMat44][SseMat33][3D]")
+{
+	struct SkinnedVertex
+	{
+		Vec3P pos;
+		uint8_t bones[4];
+		float weights[4];
+		Vec3P norm;
+	};
+
+	const size_t STRIDE = sizeof(SkinnedVertex);
+	const size_t POS = offsetof(SkinnedVertex, pos);
+	const size_t BONES = offsetof(SkinnedVertex, bones);
+	const size_t WEIGHTS = offsetof(SkinnedVertex, weights);
+	const size_t NORM = offsetof(SkinnedVertex, norm);
+
+	const SseMat44 mat = RigidSseMat44(2.0f, -1.0f, -3.0f, -1.0f, 3.0f, 1.0f, 0.4f);
+	const SseMat33 shear(SetSseVec3_Debug(2.0f, 0.0f, 0.5f), SetSseVec3_Debug(1.0f, 3.0f, 0.0f), SetSseVec3_Debug(0.0f, -1.0f, 4.0f));
+
+	const size_t COUNT = 5;
+	SkinnedVertex verts[COUNT];
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		verts[i].pos = Vec3P(1.0f + i, -0.5f * i, 2.0f - i);
+		verts[i].norm = Vec3P(0.0f, 1.0f + i, 1.0f);
+		for (uint8_t j = 0; j < 4; j++)
+		{
+			verts[i].bones[j] = static_cast<uint8_t>((i + j) % 3);
+			verts[i].weights[j] = 0.0f;
+		}
+		verts[i].weights[0] = 0.25f;
+		verts[i].weights[1] = 0.75f;
+	}
+
+	SECTION("TransformVec3PStrided transforms positions in place")
+	{
+		SkinnedVertex transformed[COUNT];
+		std::copy(verts, verts + COUNT, transformed);
+		TransformVec3PStrided(mat, transformed, STRIDE, POS, transformed, STRIDE, POS, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CheckSseVec(LoadSseVec3P(transformed[i].pos), TransformVec3(mat, LoadSseVec3P(verts[i].pos)));
+			CHECK(transformed[i].norm == verts[i].norm);
+			CHECK(transformed[i].weights[1] == 0.75f);
+		}
+	}
+
+	SECTION("TransformNormalVec3PStrided and Vec3PNormalizeStrided write unit normals")
+	{
+		Vec3P normals[COUNT];
+		TransformNormalVec3PStrided(shear, verts, STRIDE, NORM, normals, sizeof(Vec3P), 0, COUNT);
+
+		SkinnedVertex normalized[COUNT];
+		std::copy(verts, verts + COUNT, normalized);
+		Vec3PNormalizeStrided(normalized, STRIDE, NORM, normalized, STRIDE, NORM, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			SseVec expected = Vec3Normalize(TransformVec3(shear, LoadSseVec3P(verts[i].norm)));
+			CheckSseVec(VecAnd(LoadSseVec3P(normals[i]), MASK_1110), VecAnd(expected, MASK_1110));
+
+			expected = Vec3Normalize(LoadSseVec3P(verts[i].norm));
+			CheckSseVec(VecAnd(LoadSseVec3P(normalized[i].norm), MASK_1110), VecAnd(expected, MASK_1110));
+			CHECK(normalized[i].pos == verts[i].pos);
+		}
+	}
+
+	SECTION("SkinVec3PStrided blends the bone matrices by the vertex weights")
+	{
+		const SseMat44 bones[3] =
+		{
+			TranslationMatrixFromVec3(SetSseVec3_Debug(0.0f, 4.0f, 0.0f)),
+			mat,
+			ScaleMatrixFromVec3(SetSseVec3_Debug(2.0f, 2.0f, 2.0f))
+		};
+
+		SkinnedVertex skinned[COUNT];
+		std::copy(verts, verts + COUNT, skinned);
+		SkinVec3PStrided(bones, skinned, STRIDE, POS, BONES, WEIGHTS, skinned, STRIDE, POS, COUNT);
+		SkinVec3PStrided<false>(bones, skinned, STRIDE, NORM, BONES, WEIGHTS, skinned, STRIDE, NORM, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			const SseMat44& first = bones[verts[i].bones[0]];
+			const SseMat44& second = bones[verts[i].bones[1]];
+
+			SseVec pos = LoadSseVec3P(verts[i].pos);
+			SseVec expected = VecAdd(VecMul(SetSseVec4(0.25f), TransformVec3(first, pos)), VecMul(SetSseVec4(0.75f), TransformVec3(second, pos)));
+			CheckSseVec(VecAnd(LoadSseVec3P(skinned[i].pos), MASK_1110), VecAnd(expected, MASK_1110));
+
+			SseVec norm = LoadSseVec3P(verts[i].norm);
+			expected = VecAdd(VecMul(SetSseVec4(0.25f), VecSub(TransformVec3(first, norm), first.col3)),
+				VecMul(SetSseVec4(0.75f), VecSub(TransformVec3(second, norm), second.col3)));
+			CheckSseVec(VecAnd(LoadSseVec3P(skinned[i].norm), MASK_1110), VecAnd(expected, MASK_1110));
+		}
+	}
+}
+
+TEST_CASE("SseTransform compose, inverse and transforms match SseMat44", "[SseTransform][SseMat44]")
+{
+	const SseVec parentRotation = QuaternionFromAxisAngle(SetSseVec3_Debug(2.0f, -3.0f, 1.0f), 1.3f);
+	const SseVec rigidRotation = QuaternionFromAxisAngle(SetSseVec3_Debug(0.0f, 1.0f, -1.0f), -2.2f);
+	const SseTransform parent(parentRotation, SetSseVec3_Debug(1.0f, -2.0f, 3.0f), 2.0f);
+	const SseTransform child(QuaternionFromAxisAngle(SetSseVec3_Debug(0.0f, 0.0f, 1.0f), F_PI_4), SetSseVec3_Debug(-3.0f, 0.5f, 2.0f), 0.5f);
+	const SseTransform rigid(rigidRotation, SetSseVec3_Debug(4.0f, 0.0f, -1.0f), 1.0f);
+
+	CHECK(sizeof(SseTransform) == 32);
+
+	SECTION("Conversion")
+	{
+		RunSseMat44Test(ToSseMat44(SseTransform::Identity()), SseMat44(UNIT_1000, UNIT_0100, UNIT_0010, UNIT_0001, MatrixType::RIGID));
+		RunSseMat44Test(ToSseMat44(rigid), RigidSseMat44(4.0f, 0.0f, -1.0f, 0.0f, 1.0f, -1.0f, -2.2f));
+
+		SseMat44 expected = MatrixMultiply(RigidSseMat44(1.0f, -2.0f, 3.0f, 2.0f, -3.0f, 1.0f, 1.3f), ScaleMatrixFromVec3(SetSseVec3_Debug(2.0f, 2.0f, 2.0f)));
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(parent), expected);
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(ToSseMat34(parent)), expected);
+	}
+
+	SECTION("Composition")
+	{
+		SseMat44 expected = MatrixMultiply(ToSseMat44(parent), ToSseMat44(child));
+		expected.matrixTypeVal = MatrixType::RIGID;// the scales cancel out
+
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(TransformMultiply(parent, child)), expected);
+		CheckSseVec(TransformMultiply(parent, SseTransform::Identity()).translationScale, parent.translationScale);
+	}
+
+	SECTION("Inverse")
+	{
+		SseTransform identity = TransformMultiply(TransformInverse<PrecisionPolicy::EXACT>(child), child);
+
+		RunSseMat44Test<FloatPrecision::HIGH>(ToSseMat44(TransformInverse<PrecisionPolicy::EXACT>(parent)), MatrixInverse<PrecisionPolicy::EXACT>(ToSseMat44(parent)));
+		RunSseMat44Test<FloatPrecision::MEDIUM_HIGH>(ToSseMat44(TransformInverse(child)), MatrixInverse<PrecisionPolicy::EXACT>(ToSseMat44(child)));
+		CheckSseVec(identity.rotation, UNIT_0001);
+		CheckSseVec(identity.translationScale, UNIT_0001);
+	}
+
+	SECTION("Points and directions")
+	{
+		SseVec value = SetSseVec3_Debug(3.0f, -4.0f, 5.0f);
+
+		// The quaternion and the matrix round differently
+		CheckSseVec<FloatPrecision::MEDIUM_HIGH>(TransformVec3(parent, value), TransformVec3(ToSseMat44(parent), value));
+		CheckSseVec(TransformVec3(child, value), TransformVec3(ToSseMat44(child), value));
+		CheckSseVec<FloatPrecision::MEDIUM_HIGH>(TransformDirectionVec3(parent, value), TransformDirectionVec3(ToSseMat34(parent), value));
+		CheckSseVec(TransformVec3(SseTransform::Identity(), value), value);
+	}
+}
+
+TEST_CASE("QuaternionFromRotationMatrix for SseMat44 and SseMat33 inverts RotationMatrixFromQuaternion", "[SseMat44][SseMat33][Rotation]")
+{
+	const int NUM_TESTS = 7;
+	const SseVec quats[NUM_TESTS] = {
+		UNIT_0001,
+		SetSseVec4(0.5f, -0.5f, 0.5f, 0.5f),
+		SetSseVec4(1.0f, 0.0f, 0.0f, 0.0f),
+		SetSseVec4(0.0f, 1.0f, 0.0f, 0.0f),
+		SetSseVec4(0.0f, 0.0f, 1.0f, 0.0f),
+		SetSseVec4(F_1_SQRT2, F_1_SQRT2, 0.0f, 0.0f),
+		SetSseVec4(0.2f, -0.4f, 0.4f, 0.8f)
+	};
+
+	for (int i = 0; i < NUM_TESTS; i++)
+	{
+		INFO("Test " << i);
+		CheckSseVec(QuaternionFromRotationMatrix<PrecisionPolicy::EXACT>(RotationMatrixFromQuaternion(quats[i])), quats[i]);
+		CheckSseVec<FloatPrecision::MEDIUM_HIGH>(QuaternionFromRotationMatrix(RotationMatrixFromQuaternion(quats[i])), quats[i]);
+		CheckSseVec(QuaternionFromRotationMatrix<PrecisionPolicy::EXACT>(RotationMat33FromQuaternion(quats[i])), quats[i]);
+	}
+
+	SECTION("w is kept non-negative")
+	{
+		CheckSseVec(QuaternionFromRotationMatrix<PrecisionPolicy::EXACT>(RotationMatrixFromQuaternion(SetSseVec4(-0.2f, 0.4f, -0.4f, -0.8f))), quats[6]);
+	}
+
+	SECTION("Matches the SISD version")
+	{
+		Mat44 rotation = RotationMatrixFromQuaternion(Quaternion(0.2f, -0.4f, 0.4f, 0.8f));
+
+		CheckSseVec(QuaternionFromRotationMatrix<PrecisionPolicy::EXACT>(SseMat44(rotation)), LoadSseVec4(QuaternionFromRotationMatrix(rotation)));
+	}
+}
+
+TEST_CASE("DecomposeTRS recovers the translation, rotation and scale of SseMat44s", "[SseMat44][Affine Transformation Matrix]")
+{
+	const SseVec translation = SetSseVec3_Debug(1.0f, -2.0f, 3.0f);
+	const SseVec rotation = SetSseVec4(0.2f, -0.4f, 0.4f, 0.8f);
+	const SseVec scale = SetSseVec3_Debug(2.0f, 0.5f, 4.0f);
+
+	const SseMat44 trs = MatrixMultiply(MatrixMultiply(TranslationMatrixFromVec3(translation), RotationMatrixFromQuaternion(rotation)), ScaleMatrixFromVec3(scale));
+
+	SseVec resultTranslation, resultRotation, resultScale;
+
+	SECTION("Affine")
+	{
+		CHECK(DecomposeTRS(trs, resultTranslation, resultRotation, resultScale));
+		CheckSseVec(resultTranslation, translation);
+		CheckSseVec(resultRotation, rotation);
+		CheckSseVec(resultScale, scale);
+
+		SseMat44 rebuilt = MatrixMultiply(MatrixMultiply(TranslationMatrixFromVec3(resultTranslation), RotationMatrixFromQuaternion(resultRotation)), ScaleMatrixFromVec3(resultScale));
+		RunSseMat44Test<FloatPrecision::HIGH>(rebuilt, trs);
+	}
+
+	SECTION("Rigid")
+	{
+		SseMat44 rigid = MatrixMultiply(TranslationMatrixFromVec3(translation), RotationMatrixFromQuaternion(rotation));
+		REQUIRE(rigid.matrixTypeVal == MatrixType::RIGID);
+
+		CHECK(DecomposeTRS(rigid, resultTranslation, resultRotation, resultScale));
+		CheckSseVec(resultTranslation, translation);
+		CheckSseVec(resultRotation, rotation);
+		CheckSseVec(resultScale, SSE_VEC_ONE);
+	}
+
+	SECTION("Mirrored")
+	{
+		SseMat44 mirrored = MatrixMultiply(RotationMatrixFromQuaternion(rotation), ScaleMatrixFromVec3(SetSseVec3_Debug(-2.0f, -2.0f, -2.0f)));
+
+		CHECK(DecomposeTRS(mirrored, resultTranslation, resultRotation, resultScale));
+		CheckSseVec(resultTranslation, UNIT_0001);
+		CheckSseVec(resultRotation, rotation);
+		CheckSseVec(resultScale, SetSseVec3_Debug(-2.0f, -2.0f, -2.0f));
+	}
+
+	SECTION("Singular")
+	{
+		SseMat44 flattened = MatrixMultiply(trs, ScaleMatrixFromVec3(SetSseVec3_Debug(1.0f, 0.0f, 1.0f)));
+
+		CHECK_FALSE(DecomposeTRS(flattened, resultTranslation, resultRotation, resultScale));
+		CheckSseVec(resultRotation, UNIT_0001);
+		CHECK_FALSE(DecomposeTRS(SseMat44(UNIT_1000, UNIT_0100, UNIT_0010, UNIT_0001, MatrixType::INVALID), resultTranslation, resultRotation, resultScale));
+	}
+
+	SECTION("Batch")
+	{
+		SseMat44 mats[3] = { trs, SseMat44::IDENTITY, TranslationMatrixFromVec3(translation) };
+		SseVec translations[3], rotations[3], scales[3];
+
+		CHECK(DecomposeTRSBatch(mats, translations, rotations, scales, 3));
+		for (size_t i = 0; i < 3; i++)
+		{
+			CHECK(DecomposeTRS(mats[i], resultTranslation, resultRotation, resultScale));
+			CheckSseVec(translations[i], resultTranslation);
+			CheckSseVec(rotations[i], resultRotation);
+			CheckSseVec(scales[i], resultScale);
+		}
+
+		mats[1] = MatrixMultiply(trs, ScaleMatrixFromVec3(SetSseVec3_Debug(0.0f, 1.0f, 1.0f)));
+		CHECK_FALSE(DecomposeTRSBatch(mats, translations, rotations, scales, 3));
+	}
+}
+
+TEST_CASE("SseMat44ApproxEqual and HasNaNOrInf validate SseMat44s", "[SseMat44]")
+{
+	const SseMat44 mat = RigidSseMat44(-1.0f, 2.5f, 0.5f, 2.0f, 1.0f, -1.0f, 1.2f);
+
+	SseMat44 nudged = mat;
+	nudged.col2 = VecAdd(nudged.col2, SetSseVec4(0.0f, 0.001f, 0.0f, 0.0f));
+
+	SseMat44 broken = mat;
+	broken.col3 = SetSseVec4(1.0f, NAN, 3.0f, 1.0f);
+
+	SECTION("Single matrices")
+	{
+		CHECK(SseMat44ApproxEqual(mat, mat));
+		CHECK(SseMat44ApproxEqual(mat, SseMat44(mat.col0, mat.col1, mat.col2, mat.col3, MatrixType::MISC)));
+		CHECK_FALSE(SseMat44ApproxEqual(mat, nudged));
+		CHECK(SseMat44ApproxEqual<FloatPrecision::MEDIUM_LOW>(mat, nudged));
+		CHECK_FALSE(SseMat44ApproxEqual(broken, broken));
+
+		CHECK_FALSE(HasNaNOrInf(mat));
+		CHECK(HasNaNOrInf(broken));
+	}
+
+	SECTION("Batches")
+	{
+		SseMat44 mats[4] = { mat, nudged, mat, broken };
+		SseMat44 expected[4] = { mat, mat, mat, mat };
+
+		CHECK(FindNaNOrInf(mats, 4) == 3);
+		CHECK(FindNaNOrInf(mats, 3) == 3);
+		CHECK(FindApproxUnequal(mats, expected, 4) == 1);
+		CHECK(FindApproxUnequal<FloatPrecision::MEDIUM_LOW>(mats, expected, 4) == 3);
+		CHECK(FindApproxUnequal(expected, expected, 4) == 4);
+	}
+}
+
+TEST_CASE("AlignedVector and HugePageVector keep SIMD types aligned", "[SseMat44][Aligned Memory]")
+{
+	const SseMat44 mat = RigidSseMat44(3.0f, 0.5f, -2.0f, 0.0f, 2.0f, 1.0f, -0.8f);
+
+	SECTION("Alignment")
+	{
+		CHECK(AlignedAllocator<float>::ALIGNMENT == 16);
+		CHECK((AlignedAllocator<SseMat44, 8>::ALIGNMENT == 16));
+		CHECK((AlignedAllocator<double, 64>::ALIGNMENT == 64));
+
+		AlignedVector<SseMat44> mats;
+		for (size_t i = 0; i < 100; i++)
+		{
+			mats.push_back(mat);
+			REQUIRE((reinterpret_cast<uintptr_t>(mats.data()) % 16 == 0));
+		}
+
+		AlignedVector<Vec3P> points(7);
+		AlignedVector<float, 64> floats(5);
+
+		CHECK((reinterpret_cast<uintptr_t>(points.data()) % 16 == 0));
+		CHECK((reinterpret_cast<uintptr_t>(floats.data()) % 64 == 0));
+
+		typedef std::allocator_traits<AlignedAllocator<float, 32>>::rebind_alloc<double> Rebound;
+		CHECK((std::is_same<Rebound, AlignedAllocator<double, 32>>::value));
+		CHECK((AlignedAllocator<float, 32>() == AlignedAllocator<double, 32>()));
+	}
+
+	SECTION("Huge pages")
+	{
+		const size_t LARGE_COUNT = HUGE_PAGE_SIZE / sizeof(SseVec) + 3;
+
+		// Stored as floats, since SseVec (__m128) loses its alignment attribute as a template argument
+		HugePageVector<float> small(3 * 4);
+		HugePageVector<float> largeStorage(LARGE_COUNT * 4);
+		SseVec* large = reinterpret_cast<SseVec*>(largeStorage.data());
+
+		CHECK((reinterpret_cast<uintptr_t>(small.data()) % 16 == 0));
+		CHECK((reinterpret_cast<uintptr_t>(large) % HUGE_PAGE_SIZE == 0));
+
+		for (size_t i = 0; i < LARGE_COUNT; i++)
+		{
+			large[i] = SetSseVec3_Debug(float(i % 11), -1.0f, float(i % 5));
+		}
+
+		TransformVec3Batch(mat, large, large, LARGE_COUNT);
+
+		CheckSseVec(large[0], TransformVec3(mat, SetSseVec3_Debug(0.0f, -1.0f, 0.0f)));
+		CheckSseVec(large[LARGE_COUNT - 1], TransformVec3(mat, SetSseVec3_Debug(float((LARGE_COUNT - 1) % 11), -1.0f, float((LARGE_COUNT - 1) % 5))));
+	}
+
+	SECTION("Streaming into aligned Vec3Ps")
+	{
+		const size_t COUNT = 10;
+		SseVec inputs[COUNT];
+		AlignedVector<Vec3P> cached(COUNT);
+		AlignedVector<Vec3P> streamed(COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			inputs[i] = SetSseVec3_Debug(float(i), 2.0f - float(i), 0.5f * float(i));
+		}
+
+		StoreSseVec3PBatch(inputs, cached.data(), COUNT);
+		StoreSseVec3PBatch<StorePolicy::STREAMING>(inputs, streamed.data(), COUNT);
+
+		CHECK(cached == streamed);
+	}
+
+	SECTION("Failed allocations")
+	{
+		AlignedAllocator<SseMat44> allocator;
+
+		CHECK_THROWS_AS(allocator.allocate(allocator.max_size() + 1), const std::bad_alloc&);
+	}
+}
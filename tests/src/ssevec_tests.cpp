@@ -417,6 +417,34 @@ TEST_CASE("3D SseVec can be normalized", "[SseVec][3D]")
 	}
 }
 
+TEST_CASE("3D SseVec can be normalized with each PrecisionPolicy", "[SseVec][3D]")
+{
+	const int TEST_COUNT = 5;
+
+	SseVec3Context_1Arg tests[TEST_COUNT] {
+		{ "Right",				Vec3::Right() },
+		{ "Left-Down-Back",		Vec3(-SQRT_3_OVER_3, -SQRT_3_OVER_3, -SQRT_3_OVER_3) },
+		{ "<MED MED MED>",		Vec3(MED, MED, MED),		Vec3(SQRT_3_OVER_3, SQRT_3_OVER_3, SQRT_3_OVER_3) },
+		{ "<SMALL MED MED>",	Vec3(SMALL, MED, MED),		Vec3(SMALL, SQRT_2_OVER_2, SQRT_2_OVER_2) },
+		{ "<MED BIG BIG>",		Vec3(MED, BIG, BIG),		Vec3(0.0f, SQRT_2_OVER_2, SQRT_2_OVER_2) },
+	};
+
+	for (size_t i = 0; i < TEST_COUNT; i++)
+	{
+		RunVec3Test<FloatPrecision::HIGH>(tests[i], Vec3Normalize<PrecisionPolicy::EXACT>(tests[i].arg), (int)i);
+		RunVec3Test<FloatPrecision::MEDIUM_HIGH>(tests[i], Vec3Normalize<PrecisionPolicy::REFINED>(tests[i].arg), (int)i);
+		RunVec3Test<FloatPrecision::MEDIUM>(tests[i], Vec3Normalize<PrecisionPolicy::ESTIMATE>(tests[i].arg), (int)i);
+	}
+
+	SECTION("Zero Length")
+	{
+		SseVec3Context_1Arg test("Zero", Vec3::Zero());
+
+		RunVec3Test(test, Vec3Normalize<PrecisionPolicy::REFINED>(test.arg));
+		RunVec3Test(test, Vec3Normalize<PrecisionPolicy::ESTIMATE>(test.arg));
+	}
+}
+
 TEST_CASE("4D SseVec can be normalized", "[SseVec][4D]")
 {
 	SECTION("Non-Zero, Non-Infinite Length")
@@ -1113,12 +1141,561 @@ TEST_CASE("FastSinCosSseVec can calculate approximate sines and cosines of SseVe
 	}
 }
 
+TEST_CASE("VecRcp, VecRSqrt, VecDiv and VecSqrt follow the given PrecisionPolicy", "[SseVec]")
+{
+	SseVec values = SetSseVec4(0.25f, 1.0f, 2.0f, 3.0f);
+	SseVec numerators = SetSseVec4(1.0f, -2.0f, 0.5f, 3.0f);
+
+	Vec4 reciprocals(4.0f, 1.0f, 0.5f, 1.0f / 3.0f);
+	Vec4 rsqrts(2.0f, 1.0f, F_1_SQRT2, F_1_SQRT3);
+	Vec4 quotients(4.0f, -2.0f, 0.25f, 1.0f);
+	Vec4 sqrts(0.5f, 1.0f, F_SQRT2, F_SQRT3);
+
+	SECTION("EXACT")
+	{
+		CheckSseVec4(VecRcp<PrecisionPolicy::EXACT>(values), reciprocals);
+		CheckSseVec4(VecRSqrt<PrecisionPolicy::EXACT>(values), rsqrts);
+		CheckSseVec4(VecDiv<PrecisionPolicy::EXACT>(numerators, values), quotients);
+		CheckSseVec4(VecSqrt<PrecisionPolicy::EXACT>(values), sqrts);
+	}
+
+	SECTION("REFINED")
+	{
+		CheckSseVec4<FloatPrecision::MEDIUM_HIGH>(VecRcp<PrecisionPolicy::REFINED>(values), reciprocals);
+		CheckSseVec4<FloatPrecision::MEDIUM_HIGH>(VecRSqrt<PrecisionPolicy::REFINED>(values), rsqrts);
+		CheckSseVec4<FloatPrecision::MEDIUM_HIGH>(VecDiv<PrecisionPolicy::REFINED>(numerators, values), quotients);
+		CheckSseVec4<FloatPrecision::MEDIUM_HIGH>(VecSqrt<PrecisionPolicy::REFINED>(values), sqrts);
+	}
+
+	SECTION("ESTIMATE")
+	{
+		CheckSseVec4<FloatPrecision::MEDIUM_LOW>(VecRcp<PrecisionPolicy::ESTIMATE>(values), reciprocals);
+		CheckSseVec4<FloatPrecision::MEDIUM_LOW>(VecRSqrt<PrecisionPolicy::ESTIMATE>(values), rsqrts);
+		CheckSseVec4<FloatPrecision::MEDIUM_LOW>(VecDiv<PrecisionPolicy::ESTIMATE>(numerators, values), quotients);
+		CheckSseVec4<FloatPrecision::MEDIUM_LOW>(VecSqrt<PrecisionPolicy::ESTIMATE>(values), sqrts);
+	}
+
+	SECTION("Square root of zero")
+	{
+		CheckSseVec4(VecSqrt<PrecisionPolicy::REFINED>(SetVecZero()), Vec4(0.0f, 0.0f, 0.0f, 0.0f));
+		CheckSseVec4(VecSqrt<PrecisionPolicy::ESTIMATE>(SetVecZero()), Vec4(0.0f, 0.0f, 0.0f, 0.0f));
+	}
+}
+
+TEST_CASE("SinAndCosSseVec can calculate sines and cosines of SseVec angles from one range reduction", "[SseVec][TRIG]")
+{
+	const int NUM_SAMPLES = 256;
+
+	for (int i = 0; i < NUM_SAMPLES; i += 4)
+	{
+		SseVec angles = SetSseVec4(-F_PI + i * (F_2PI / NUM_SAMPLES), -F_PI + (i + 1) * (F_2PI / NUM_SAMPLES), -F_PI + (i + 2) * (F_2PI / NUM_SAMPLES), -F_PI + (i + 3) * (F_2PI / NUM_SAMPLES));
+		Vec4 angleVals = StoreSseVec4(angles);
+		SseVec sines, cosines;
+
+		SinAndCosSseVec(angles, sines, cosines);
+		CheckSseVec4(sines, Vec4(sinf(angleVals.x), sinf(angleVals.y), sinf(angleVals.z), sinf(angleVals.w)));
+		CheckSseVec4(cosines, Vec4(cosf(angleVals.x), cosf(angleVals.y), cosf(angleVals.z), cosf(angleVals.w)));
+
+		SinAndCosSseVec<FloatPrecision::MEDIUM>(angles, sines, cosines);
+		CheckSseVec4<FloatPrecision::MEDIUM>(sines, Vec4(sinf(angleVals.x), sinf(angleVals.y), sinf(angleVals.z), sinf(angleVals.w)));
+		CheckSseVec4<FloatPrecision::MEDIUM>(cosines, Vec4(cosf(angleVals.x), cosf(angleVals.y), cosf(angleVals.z), cosf(angleVals.w)));
+	}
+}
+
+TEST_CASE("SseVec trig functions stay within their precision level for large angles with CODY_WAITE reduction", "[SseVec][TRIG]")
+{
+	const int NUM_SAMPLES = 1024;
+	const float RANGE = 1.0e+5f;
+	const float STEP = 2.0f * RANGE / NUM_SAMPLES;
+
+	for (int i = 0; i < NUM_SAMPLES; i += 4)
+	{
+		SseVec angles = SetSseVec4(-RANGE + i * STEP + 0.1f, -RANGE + (i + 1) * STEP + 0.1f, -RANGE + (i + 2) * STEP + 0.1f, -RANGE + (i + 3) * STEP + 0.1f);
+		Vec4 angleVals = StoreSseVec4(angles);
+		Vec4 expectedSines(sinf(angleVals.x), sinf(angleVals.y), sinf(angleVals.z), sinf(angleVals.w));
+		Vec4 expectedCosines(cosf(angleVals.x), cosf(angleVals.y), cosf(angleVals.z), cosf(angleVals.w));
+		SseVec sines, cosines;
+
+		SinAndCosSseVec<FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(angles, sines, cosines);
+		CheckSseVec4(sines, expectedSines);
+		CheckSseVec4(cosines, expectedCosines);
+
+		CheckSseVec4(SinSseVec<FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(angles), expectedSines);
+		CheckSseVec4(CosSseVec<FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(angles), expectedCosines);
+		CheckSseVec4<FloatPrecision::MEDIUM_HIGH>(SinSseVec<FloatPrecision::MEDIUM_HIGH, AngleReduction::CODY_WAITE>(angles), expectedSines);
+		CheckSseVec4<FloatPrecision::MEDIUM>(CosSseVec<FloatPrecision::MEDIUM, AngleReduction::CODY_WAITE>(angles), expectedCosines);
+
+		CheckSseVec4(SinCosSseVec<SinCosFlag::SIN, SinCosFlag::COS, SinCosFlag::SIN, SinCosFlag::COS, FloatPrecision::HIGH, AngleReduction::CODY_WAITE>(angles),
+					 Vec4(expectedSines.x, expectedCosines.y, expectedSines.z, expectedCosines.w));
+	}
+}
+
+TEST_CASE("ReduceAnglesCodyWaite matches ReduceAngleCodyWaite, including past the supported range", "[SseVec][TRIG]")
+{
+	// The last two lanes round to k = 6366197000 and -6366197000, which do not fit in an int
+	const float ANGLES[2][4] = {
+		{ F_PI_2 + 0.5f, -F_PI - 0.25f, 4.1e7f, -4.1e7f },
+		{ -0.7f, F_PI, 1e10f, -1e10f }
+	};
+
+	for (size_t i = 0; i < 2; i++)
+	{
+		__m128i quadrants;
+		alignas(16) int quadrantVals[4];
+		Vec4 reduced = StoreSseVec4(ReduceAnglesCodyWaite(SetSseVec4(ANGLES[i][0], ANGLES[i][1], ANGLES[i][2], ANGLES[i][3]), quadrants));
+		_mm_store_si128(reinterpret_cast<__m128i*>(quadrantVals), quadrants);
+
+		for (size_t j = 0; j < 4; j++)
+		{
+			int expectedQuadrant;
+			float expected = ReduceAngleCodyWaite(ANGLES[i][j], expectedQuadrant);
+
+			CHECK(ApproxEqual(reduced.vals[j], expected));
+			CHECK(quadrantVals[j] == expectedQuadrant);
+		}
+	}
+}
+
+TEST_CASE("TanSseVec and CotSseVec can calculate tangents and cotangents of SseVec angles", "[SseVec][TRIG]")
+{
+	SECTION("TanSseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<0 PI/4 -PI/4 PI/3>", Vec4(0.0f, F_PI_4, -F_PI_4, F_PI_3), Vec4(0.0f, 1.0f, -1.0f, F_SQRT3) },
+			{ "<3PI/4 -2PI/3 -3PI/4 0.3>", Vec4(F_3PI_4, -F_2PI_3, -F_3PI_4, 0.3f), Vec4(-1.0f, F_SQRT3, 1.0f, tanf(0.3f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], TanSseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], TanSseVec<FloatPrecision::HIGH, PrecisionPolicy::REFINED>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], TanSseVec<FloatPrecision::MEDIUM_HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], TanSseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_LOW>(tests[i], TanSseVec<FloatPrecision::MEDIUM_LOW>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], TanSseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("CotSseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<PI/2 PI/4 -PI/4 PI/3>", Vec4(F_PI_2, F_PI_4, -F_PI_4, F_PI_3), Vec4(0.0f, 1.0f, -1.0f, F_1_SQRT3) },
+			{ "<3PI/4 -2PI/3 -PI/2 1.2>", Vec4(F_3PI_4, -F_2PI_3, -F_PI_2, 1.2f), Vec4(-1.0f, F_1_SQRT3, 0.0f, 1.0f / tanf(1.2f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], CotSseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], CotSseVec<FloatPrecision::HIGH, PrecisionPolicy::REFINED>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], CotSseVec<FloatPrecision::MEDIUM_HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], CotSseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_LOW>(tests[i], CotSseVec<FloatPrecision::MEDIUM_LOW>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], CotSseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("Poles")
+	{
+		CheckSseVec4HasInfinite(TanSseVec(SetSseVec4(F_PI_2)));
+		CheckSseVec4HasInfinite(CotSseVec(SetVecZero()));
+	}
+}
+
+TEST_CASE("TanBatch and CotBatch match their SseVec counterparts, including the non-multiple-of-four tail", "[SseVec][TRIG][BATCH]")
+{
+	const size_t COUNT = 6;
+	float angles[COUNT];
+	float results[COUNT];
+	float expected[8];
+
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		angles[i] = -1.4f + i * 0.55f;
+	}
+
+	SECTION("TanBatch")
+	{
+		TanBatch(angles, results, COUNT);
+		_mm_storeu_ps(expected, TanSseVec(_mm_loadu_ps(angles)));
+		_mm_storeu_ps(expected + 4, TanSseVec(_mm_loadu_ps(angles + 2)));
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(results[i] == (i < 4 ? expected[i] : expected[i + 2]));
+		}
+	}
+
+	SECTION("CotBatch with a refined reciprocal, in place")
+	{
+		std::copy(angles, angles + COUNT, results);
+		CotBatch<FloatPrecision::HIGH, PrecisionPolicy::REFINED>(results, results, COUNT);
+		_mm_storeu_ps(expected, CotSseVec<FloatPrecision::HIGH, PrecisionPolicy::REFINED>(_mm_loadu_ps(angles)));
+		_mm_storeu_ps(expected + 4, CotSseVec<FloatPrecision::HIGH, PrecisionPolicy::REFINED>(_mm_loadu_ps(angles + 2)));
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(results[i] == (i < 4 ? expected[i] : expected[i + 2]));
+		}
+	}
+}
+
+TEST_CASE("AtanSseVec can calculate arctangents of SseVec values", "[SseVec][TRIG]")
+{
+	const int TEST_COUNT = 3;
+	SseVec4Context_1Arg tests[TEST_COUNT] {
+		{ "<0 1 -1 SQRT3>", Vec4(0.0f, 1.0f, -1.0f, F_SQRT3), Vec4(0.0f, F_PI_4, -F_PI_4, F_PI_3) },
+		{ "<1/SQRT3 -1/SQRT3 BIG -BIG>", Vec4(F_1_SQRT3, -F_1_SQRT3, BIG, -BIG), Vec4(F_PI / 6, -F_PI / 6, F_PI_2, -F_PI_2) },
+		{ "<INF -INF 0.25 -8>", Vec4(Infinity(), -Infinity(), 0.25f, -8.0f), Vec4(F_PI_2, -F_PI_2, atanf(0.25f), atanf(-8.0f)) }
+	};
+
+	for (size_t i = 0; i < TEST_COUNT; i++)
+	{
+		RunVec4Test<FloatPrecision::HIGH>(tests[i], AtanSseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+		RunVec4Test<FloatPrecision::MEDIUM_HIGH>(tests[i], AtanSseVec<FloatPrecision::MEDIUM_HIGH>(tests[i].arg), (int)i);
+		RunVec4Test<FloatPrecision::MEDIUM>(tests[i], AtanSseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+		RunVec4Test<FloatPrecision::MEDIUM_LOW>(tests[i], AtanSseVec<FloatPrecision::MEDIUM_LOW>(tests[i].arg), (int)i);
+		RunVec4Test<FloatPrecision::LOW>(tests[i], AtanSseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+	}
+
+	SECTION("NaN")
+	{
+		CheckSseVec4IsNaN(AtanSseVec(SetSseVec4(NAN)));
+	}
+}
+
+TEST_CASE("Atan2SseVec can calculate the angles of SseVec points in all four quadrants", "[SseVec][TRIG]")
+{
+	const int TEST_COUNT = 3;
+	SseVec4Context_2Args tests[TEST_COUNT] {
+		{ "<1 1 -1 -1> <1 -1 -1 1>", Vec4(1.0f, 1.0f, -1.0f, -1.0f), Vec4(1.0f, -1.0f, -1.0f, 1.0f), Vec4(F_PI_4, F_3PI_4, -F_3PI_4, -F_PI_4) },
+		{ "<0 0 1 -1> <1 -1 0 0>", Vec4(0.0f, 0.0f, 1.0f, -1.0f), Vec4(1.0f, -1.0f, 0.0f, 0.0f), Vec4(0.0f, F_PI, F_PI_2, -F_PI_2) },
+		{ "<SQRT3 -2 INF 0> <1 -5 INF 0>", Vec4(F_SQRT3, -2.0f, Infinity(), 0.0f), Vec4(1.0f, -5.0f, Infinity(), 0.0f), Vec4(F_PI_3, atan2f(-2.0f, -5.0f), F_PI_4, 0.0f) }
+	};
+
+	for (size_t i = 0; i < TEST_COUNT; i++)
+	{
+		RunVec4Test<FloatPrecision::HIGH>(tests[i], Atan2SseVec<FloatPrecision::HIGH>(tests[i].arg0, tests[i].arg1), (int)i);
+		RunVec4Test<FloatPrecision::MEDIUM>(tests[i], Atan2SseVec<FloatPrecision::MEDIUM>(tests[i].arg0, tests[i].arg1), (int)i);
+		RunVec4Test<FloatPrecision::LOW>(tests[i], Atan2SseVec<FloatPrecision::LOW>(tests[i].arg0, tests[i].arg1), (int)i);
+	}
+
+	SECTION("NaN")
+	{
+		CheckSseVec4IsNaN(Atan2SseVec(SetSseVec4(NAN), SSE_VEC_ONE));
+		CheckSseVec4IsNaN(Atan2SseVec(_mm_setzero_ps(), SetSseVec4(NAN)));
+	}
+}
+
+TEST_CASE("AsinSseVec and AcosSseVec can calculate arcsines and arccosines of SseVec values", "[SseVec][TRIG]")
+{
+	SECTION("AsinSseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<0 1 -1 0.5>", Vec4(0.0f, 1.0f, -1.0f, 0.5f), Vec4(0.0f, F_PI_2, -F_PI_2, F_PI / 6) },
+			{ "<SQRT2/2 -SQRT3/2 0.999 -0.1>", Vec4(F_1_SQRT2, -F_SQRT3_2, 0.999f, -0.1f), Vec4(F_PI_4, -F_PI_3, asinf(0.999f), asinf(-0.1f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], AsinSseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], AsinSseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], AsinSseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("AcosSseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<0 1 -1 0.5>", Vec4(0.0f, 1.0f, -1.0f, 0.5f), Vec4(F_PI_2, 0.0f, F_PI, F_PI_3) },
+			{ "<SQRT2/2 -SQRT3/2 0.999 -0.1>", Vec4(F_1_SQRT2, -F_SQRT3_2, 0.999f, -0.1f), Vec4(F_PI_4, 5 * F_PI / 6, acosf(0.999f), acosf(-0.1f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], AcosSseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], AcosSseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], AcosSseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("Out of range")
+	{
+		CheckSseVec4IsNaN(AsinSseVec(SetSseVec4(1.5f)));
+		CheckSseVec4IsNaN(AcosSseVec(SetSseVec4(-1.5f)));
+	}
+}
+
+TEST_CASE("The inverse trig batch functions match their scalar counterparts, including the non-multiple-of-four tail", "[SseVec][TRIG][BATCH]")
+{
+	const size_t COUNT = 11;
+	float values[COUNT];
+	float others[COUNT];
+	float results[COUNT];
+
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		values[i] = -1.0f + i * 0.2f;
+		others[i] = 3.0f - i * 0.6f;
+	}
+
+	SECTION("AtanBatch")
+	{
+		AtanBatch(values, results, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(ApproxEqual(results[i], AtanApprox(values[i])));
+		}
+	}
+
+	SECTION("Atan2Batch")
+	{
+		Atan2Batch(values, others, results, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(ApproxEqual(results[i], Atan2Approx(values[i], others[i])));
+		}
+	}
+
+	SECTION("AsinBatch")
+	{
+		AsinBatch<FloatPrecision::MEDIUM>(values, results, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(ApproxEqual(results[i], AsinApprox<FloatPrecision::MEDIUM>(values[i])));
+		}
+	}
+
+	SECTION("AcosBatch in place")
+	{
+		std::copy(values, values + COUNT, results);
+		AcosBatch(results, results, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(ApproxEqual(results[i], AcosApprox(values[i])));
+		}
+	}
+}
+
+TEST_CASE("Exp2SseVec and ExpSseVec can calculate exponentials of SseVec values", "[SseVec][EXP]")
+{
+	SECTION("Exp2SseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<0 1 -1 -3>", Vec4(0.0f, 1.0f, -1.0f, -3.0f), Vec4(1.0f, 2.0f, 0.5f, 0.125f) },
+			{ "<0.5 -2.25 1.7 -0.3>", Vec4(0.5f, -2.25f, 1.7f, -0.3f), Vec4(F_SQRT2, exp2f(-2.25f), exp2f(1.7f), exp2f(-0.3f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], Exp2SseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_HIGH>(tests[i], Exp2SseVec<FloatPrecision::MEDIUM_HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], Exp2SseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_LOW>(tests[i], Exp2SseVec<FloatPrecision::MEDIUM_LOW>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], Exp2SseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("ExpSseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<0 1 -1 -2>", Vec4(0.0f, 1.0f, -1.0f, -2.0f), Vec4(1.0f, expf(1.0f), expf(-1.0f), expf(-2.0f)) },
+			{ "<0.1 -5 LN2 -0.7>", Vec4(0.1f, -5.0f, F_LN2, -0.7f), Vec4(expf(0.1f), expf(-5.0f), 2.0f, expf(-0.7f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], ExpSseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_HIGH>(tests[i], ExpSseVec<FloatPrecision::MEDIUM_HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], ExpSseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_LOW>(tests[i], ExpSseVec<FloatPrecision::MEDIUM_LOW>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], ExpSseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("Overflow, underflow and NaN")
+	{
+		Vec4 result = StoreSseVec4(ExpSseVec(SetSseVec4(100.0f, -110.0f, Infinity(), -Infinity())));
+
+		CHECK(IsInfinity(result.x));
+		CHECK(result.y == 0.0f);
+		CHECK(IsInfinity(result.z));
+		CHECK(result.w == 0.0f);
+
+		result = StoreSseVec4(Exp2SseVec(SetSseVec4(128.0f, -149.0f, -160.0f, 127.0f)));
+
+		CHECK(IsInfinity(result.x));
+		CHECK(result.y == exp2f(-149.0f));
+		CHECK(result.z == 0.0f);
+		CHECK(result.w == exp2f(127.0f));
+
+		CheckSseVec4IsNaN(ExpSseVec(SetSseVec4(NAN)));
+		CheckSseVec4IsNaN(Exp2SseVec(SetSseVec4(NAN)));
+	}
+}
+
+TEST_CASE("Log2SseVec and LogSseVec can calculate logarithms of SseVec values", "[SseVec][EXP]")
+{
+	SECTION("Log2SseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<1 2 0.5 1024>", Vec4(1.0f, 2.0f, 0.5f, 1024.0f), Vec4(0.0f, 1.0f, -1.0f, 10.0f) },
+			{ "<SQRT2 3 0.1 1e-40>", Vec4(F_SQRT2, 3.0f, 0.1f, 1.0e-40f), Vec4(0.5f, log2f(3.0f), log2f(0.1f), log2f(1.0e-40f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::MEDIUM_HIGH>(tests[i], Log2SseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_HIGH>(tests[i], Log2SseVec<FloatPrecision::MEDIUM_HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], Log2SseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_LOW>(tests[i], Log2SseVec<FloatPrecision::MEDIUM_LOW>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], Log2SseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("LogSseVec")
+	{
+		const int TEST_COUNT = 2;
+		SseVec4Context_1Arg tests[TEST_COUNT] {
+			{ "<1 e 2 0.25>", Vec4(1.0f, expf(1.0f), 2.0f, 0.25f), Vec4(0.0f, 1.0f, F_LN2, logf(0.25f)) },
+			{ "<1.0001 7 0.9 3e5>", Vec4(1.0001f, 7.0f, 0.9f, 3.0e5f), Vec4(logf(1.0001f), logf(7.0f), logf(0.9f), logf(3.0e5f)) }
+		};
+
+		for (size_t i = 0; i < TEST_COUNT; i++)
+		{
+			RunVec4Test<FloatPrecision::HIGH>(tests[i], LogSseVec<FloatPrecision::HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_HIGH>(tests[i], LogSseVec<FloatPrecision::MEDIUM_HIGH>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM>(tests[i], LogSseVec<FloatPrecision::MEDIUM>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::MEDIUM_LOW>(tests[i], LogSseVec<FloatPrecision::MEDIUM_LOW>(tests[i].arg), (int)i);
+			RunVec4Test<FloatPrecision::LOW>(tests[i], LogSseVec<FloatPrecision::LOW>(tests[i].arg), (int)i);
+		}
+	}
+
+	SECTION("Zero, infinity, negative and NaN")
+	{
+		Vec4 result = StoreSseVec4(LogSseVec(SetSseVec4(0.0f, -0.0f, Infinity(), 1.0f)));
+
+		CHECK(IsInfinity(result.x));
+		CHECK(result.x < 0.0f);
+		CHECK(IsInfinity(result.y));
+		CHECK(result.y < 0.0f);
+		CHECK(IsInfinity(result.z));
+		CHECK(result.z > 0.0f);
+
+		CheckSseVec4IsNaN(LogSseVec(SetSseVec4(-1.0f)));
+		CheckSseVec4IsNaN(Log2SseVec(SetSseVec4(-Infinity())));
+		CheckSseVec4IsNaN(Log2SseVec(SetSseVec4(NAN)));
+	}
+}
+
+TEST_CASE("PowSseVec can raise SseVec bases to SseVec exponents", "[SseVec][EXP]")
+{
+	const int TEST_COUNT = 2;
+	SseVec4Context_2Args tests[TEST_COUNT] {
+		{ "<2 9 0.5 10> <0.5 0.5 2 -1>", Vec4(2.0f, 9.0f, 0.5f, 10.0f), Vec4(0.5f, 0.5f, 2.0f, -1.0f), Vec4(F_SQRT2, 3.0f, 0.25f, 0.1f) },
+		{ "<0.8 1.5 0 3> <2.2 -0.75 2 0>", Vec4(0.8f, 1.5f, 0.0f, 3.0f), Vec4(2.2f, -0.75f, 2.0f, 0.0f), Vec4(powf(0.8f, 2.2f), powf(1.5f, -0.75f), 0.0f, 1.0f) }
+	};
+
+	for (size_t i = 0; i < TEST_COUNT; i++)
+	{
+		RunVec4Test<FloatPrecision::MEDIUM_HIGH>(tests[i], PowSseVec<FloatPrecision::HIGH>(tests[i].arg0, tests[i].arg1), (int)i);
+		RunVec4Test<FloatPrecision::MEDIUM>(tests[i], PowSseVec<FloatPrecision::MEDIUM>(tests[i].arg0, tests[i].arg1), (int)i);
+		RunVec4Test<FloatPrecision::LOW>(tests[i], PowSseVec<FloatPrecision::LOW>(tests[i].arg0, tests[i].arg1), (int)i);
+	}
+
+	SECTION("Exact ones")
+	{
+		Vec4 result = StoreSseVec4(PowSseVec(SetSseVec4(NAN, 1.0f, 0.0f, 5.0f), SetSseVec4(0.0f, NAN, 0.0f, 0.0f)));
+
+		CHECK(result == Vec4::One());
+	}
+
+	SECTION("Negative bases")
+	{
+		CheckSseVec4IsNaN(PowSseVec(SetSseVec4(-2.0f), SetSseVec4(2.0f)));
+	}
+}
+
+TEST_CASE("The exponential batch functions match their SseVec counterparts, including the non-multiple-of-four tail", "[SseVec][EXP][BATCH]")
+{
+	const size_t COUNT = 7;
+	float values[COUNT];
+	float others[COUNT];
+	float results[COUNT];
+	float expected[8];
+
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		values[i] = 0.25f + i * 0.5f;
+		others[i] = 1.5f - i * 0.4f;
+	}
+
+	SECTION("ExpBatch and LogBatch")
+	{
+		ExpBatch(values, results, COUNT);
+		_mm_storeu_ps(expected, ExpSseVec(_mm_loadu_ps(values)));
+		_mm_storeu_ps(expected + 4, ExpSseVec(_mm_loadu_ps(values + 3)));
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(results[i] == (i < 4 ? expected[i] : expected[i + 1]));
+		}
+
+		LogBatch(results, results, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(ApproxEqual(results[i], values[i]));
+		}
+	}
+
+	SECTION("Exp2Batch and Log2Batch")
+	{
+		Exp2Batch<FloatPrecision::MEDIUM>(values, results, COUNT);
+		_mm_storeu_ps(expected, Exp2SseVec<FloatPrecision::MEDIUM>(_mm_loadu_ps(values)));
+		_mm_storeu_ps(expected + 4, Exp2SseVec<FloatPrecision::MEDIUM>(_mm_loadu_ps(values + 3)));
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(results[i] == (i < 4 ? expected[i] : expected[i + 1]));
+		}
+
+		Log2Batch(values, results, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(ApproxEqual<FloatPrecision::MEDIUM_HIGH>(results[i], log2f(values[i])));
+		}
+	}
+
+	SECTION("PowBatch")
+	{
+		PowBatch(values, others, results, COUNT);
+
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CHECK(ApproxEqual<FloatPrecision::MEDIUM_HIGH>(results[i], powf(values[i], others[i])));
+		}
+	}
+}
+
 
 TEST_CASE("QuaternionMultiply can calculate the product of two quaternions","[SseVec][3D][Rotation]")
 {
-	const int NUM_TESTS = 6;
+	const int NUM_TESTS = 7;
 	SseVec4Context_2Args tests[NUM_TESTS] = { 
 		{ "<0 1 0 0> <-1 0 0 0>", Quaternion(0.0f, 1.0f, 0.0f, 0.0f), Quaternion(-1.0f, 0.0f, 0.0f, 0.0f), Quaternion(0.0f, 0.0f, 1.0f, 0.0f) },
+		{ "<1 0 0 0> <0 0 1 0>", Quaternion(1.0f, 0.0f, 0.0f, 0.0f), Quaternion(0.0f, 0.0f, 1.0f, 0.0f), Quaternion(0.0f, -1.0f, 0.0f, 0.0f) },
 		{ "<1 0 0 1> <0 1 0 1>", Quaternion(1.0f, 0.0f, 0.0f, 1.0f), Quaternion(0.0f, 1.0f, 0.0f, 1.0f), Quaternion(1.0f) },
 		{ "<1 0 1 0> <0 0 0 1>", Quaternion(1.0f, 0.0f, 1.0f, 0.0f), Quaternion::Identity(), Quaternion(1.0f, 0.0f, 1.0f, 0.0f) },
 		{ "<1 1 1 1> <1 1 1 1>", Quaternion::One(), Quaternion::One(), Quaternion(2.0f, 2.0f, 2.0f, -2.0f)},
@@ -1132,6 +1709,38 @@ TEST_CASE("QuaternionMultiply can calculate the product of two quaternions","[Ss
 	}
 }
 
+TEST_CASE("QuaternionRotateVec3 can rotate a 3D vector by a quaternion without building a matrix", "[SseVec][3D][Rotation]")
+{
+	const SseVec quarterTurnZ = SetSseVec4(0.0f, 0.0f, F_1_SQRT2, F_1_SQRT2);
+	const SseVec rotation = SetSseVec4(0.5f, -0.5f, 0.5f, 0.5f);
+
+	SECTION("Single vectors")
+	{
+		CheckSseVec(QuaternionRotateVec3(UNIT_0001, SetSseVec3_Debug(1.0f, 2.0f, 3.0f)), SetSseVec3_Debug(1.0f, 2.0f, 3.0f));
+		CheckSseVec(QuaternionRotateVec3(quarterTurnZ, SetSseVec4(1.0f, 0.0f, 0.0f, 0.0f)), SetSseVec4(0.0f, 1.0f, 0.0f, 0.0f));
+		CheckSseVec(QuaternionRotateVec3(rotation, SetSseVec3_Debug(1.0f, 2.0f, 3.0f)), SetSseVec3_Debug(-2.0f, -3.0f, 1.0f));
+		CheckSseVec(QuaternionRotateVec3(SetSseVec4(0.2f, -0.4f, 0.4f, 0.8f), SetSseVec4(3.0f, -4.0f, 5.0f, 0.0f)), SetSseVec4(1.88f, -4.16f, 5.4f, 0.0f));
+	}
+
+	SECTION("Batch")
+	{
+		SseVec vecs[5] = { SetSseVec3_Debug(1.0f, 2.0f, 3.0f), UNIT_1000, UNIT_0100, UNIT_0010, SetSseVec4(3.0f, -4.0f, 5.0f, 0.0f) };
+		SseVec results[5];
+
+		QuaternionRotateVec3Batch(rotation, vecs, results, 5);
+		for (size_t i = 0; i < 5; i++)
+		{
+			CheckSseVec(results[i], QuaternionRotateVec3(rotation, vecs[i]));
+		}
+
+		QuaternionRotateVec3Batch(rotation, vecs, vecs, 5);
+		for (size_t i = 0; i < 5; i++)
+		{
+			CheckSseVec(vecs[i], results[i]);
+		}
+	}
+}
+
 TEST_CASE("QuaternionFromAxisAngle can produce a quaternion SseVec from an axis-angle rotation", "[SseVec][3D][Rotation]")
 {
 	const int NUM_TESTS = 24;
@@ -1286,7 +1895,7 @@ TEST_CASE("QuaternionFromEuler can produce quaternions from euler angles", "[Sse
 		{ "<PI/2  0  PI/2>", Vec3(F_PI_2, 0.0f, F_PI_2), Quaternion(0.5f, 0.5f, 0.5f, 0.5f) },
 		{ "<PI/2  0  PI/4>", Vec3(F_PI_2, 0.0f, F_PI_4), Quaternion(0.6532814824381883f, 0.2705980500730985f, 0.2705980500730985f, 0.6532814824381883f) },
 		{ "<PI/2  PI/4  0>", Vec3(F_PI_2, F_PI_4, 0.0f), Quaternion(0.6532814824381883f, 0.2705980500730985f, -0.2705980500730985f, 0.6532814824381883f) },
-		{ "<PI/2  3PI/4  PI/4>", Vec3(F_PI_2, F_3PI_4, F_PI_4), Quaternion(0.5f, 0.7071067811865475f, -0.5f, 0.5f) }
+		{ "<PI/2  3PI/4  PI/4>", Vec3(F_PI_2, F_3PI_4, F_PI_4), Quaternion(0.0f, 0.7071067811865475f, -0.5f, 0.5f) }
 	};
 
 	for (size_t i = 0; i < NUM_TESTS; i++)
@@ -1470,6 +2079,32 @@ TEST_CASE("StoreSseVec4 stores a SseVec into a Vec4", "[SseVec][4D][MEMORY]")
 	CHECK(result == expected);
 }
 
+TEST_CASE("SseVecConst and SseVecMaskConst tables load the same bits as SetSseVec4 and SetSseVecMask", "[SseVec][4D][MEMORY]")
+{
+	SECTION("Float tables")
+	{
+		CHECK(_mm_movemask_ps(_mm_cmpeq_ps(UNIT_0001, SetSseVec4(0.0f, 0.0f, 0.0f, 1.0f))) == 0xF);
+		CHECK(_mm_movemask_ps(_mm_cmpeq_ps(F_PI_1111, SetSseVec4(F_PI))) == 0xF);
+		CHECK(_mm_movemask_ps(_mm_cmpeq_ps(EPSILON_1111, SetSseVec4(Epsilon()))) == 0xF);
+		CHECK(_mm_movemask_ps(_mm_cmpeq_ps(SseVecConstSplat(-2.5f), SetSseVec4(-2.5f))) == 0xF);
+	}
+
+	SECTION("Mask tables")
+	{
+		SseVec expected = SetSseVecMask(0x0, 0xFFFFFFFF, 0x0, 0xFFFFFFFF);
+		CHECK(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_castps_si128(MASK_0101), _mm_castps_si128(expected))) == 0xFFFF);
+
+		expected = Set1SseVecMask(0x80000000);
+		CHECK(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_castps_si128(SseVecMaskConstSplat(0x80000000)), _mm_castps_si128(expected))) == 0xFFFF);
+	}
+
+	SECTION("Templated masks keep their per-component bits")
+	{
+		CheckSseVec4(Vec4Negate<true, false, true, false>(SetSseVec4(1.0f, 2.0f, 3.0f, 4.0f)), Vec4(-1.0f, 2.0f, -3.0f, 4.0f));
+		CheckSseVec4(Vec4Abs<false, true, true, true>(SetSseVec4(-1.0f, -2.0f, 3.0f, -4.0f)), Vec4(-1.0f, 2.0f, 3.0f, 4.0f));
+	}
+}
+
 TEST_CASE("LoadSseVec2 loads a Vec2 into a SseVec", "[SseVec][2D][MEMORY]")
 {
 	// Using standard intrinsics load function rather than custom, swizzled function.  
@@ -1519,6 +2154,61 @@ TEST_CASE("LoadSseVec4 stores a Vec4 into a SseVec", "[SseVec][4D][MEMORY]")
 	CHECK(result == expected);
 }
 
+TEST_CASE("LoadSseVec3P and StoreSseVec3P move packed Vec3Ps in and out of SseVecs", "[SseVec][3D][MEMORY]")
+{
+	// 7 vectors: one LoadSseVec3PQuad/StoreSseVec3PQuad block and a 3 vector tail
+	const size_t COUNT = 7;
+	Vec3P packed[COUNT];
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		packed[i] = Vec3P(1.0f + i, -2.0f * i, 0.5f + 0.25f * i);
+	}
+
+	CHECK(sizeof(packed) == COUNT * 12);
+
+	SECTION("Single vectors")
+	{
+		CheckSseVec(LoadSseVec3P(packed[2]), SetSseVec4(3.0f, -4.0f, 1.0f, 1.0f));
+
+		Vec3P stored = StoreSseVec3P(SetSseVec4(2.0f, 3.0f, 4.0f, 5.0f));
+		RunVec3Test(stored, Vec3(2.0f, 3.0f, 4.0f));
+		CHECK(Vec3P(Vec3(2.0f, 3.0f, 4.0f)) == stored);
+	}
+
+	SECTION("Batches")
+	{
+		SseVec loaded[COUNT];
+		LoadSseVec3PBatch(packed, loaded, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CheckSseVec(loaded[i], LoadSseVec3P(packed[i]));
+		}
+
+		// The stores must not write past the last element
+		Vec3P stored[COUNT + 1];
+		stored[COUNT] = Vec3P(-1.0f, -1.0f, -1.0f);
+		StoreSseVec3PBatch(loaded, stored, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			RunVec3Test(stored[i], packed[i]);
+		}
+		RunVec3Test(stored[COUNT], Vec3(-1.0f));
+	}
+
+	SECTION("QuaternionRotateVec3PBatch rotates in place")
+	{
+		const SseVec quat = SetSseVec4(0.2f, -0.4f, 0.4f, 0.8f);
+		Vec3P rotated[COUNT];
+		std::copy(packed, packed + COUNT, rotated);
+
+		QuaternionRotateVec3PBatch(quat, rotated, rotated, COUNT);
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			CheckSseVec(LoadSseVec3P(rotated[i]), QuaternionRotateVec3(quat, LoadSseVec3P(packed[i])));
+		}
+	}
+}
+
 TEST_CASE("VecBlend blends two SseVecs together", "[SsVec][4D]")
 {
 	SECTION("All Left")
@@ -1536,4 +2226,101 @@ TEST_CASE("VecBlend blends two SseVecs together", "[SsVec][4D]")
 		Vec4 expected = Vec4(1.0f, 0.0f, 0.0f, 2.0f);
 		CHECK(result == expected);
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("VecCmp functions produce lane masks that VecMoveMask, VecAnyTrue and VecAllTrue can query", "[SseVec][4D]")
+{
+	const SseVec v0 = SetSseVec4(1.0f, 2.0f, 3.0f, 4.0f);
+	const SseVec v1 = SetSseVec4(1.0f, 0.0f, 5.0f, 4.0f);
+
+	SECTION("Comparisons")
+	{
+		CHECK(VecMoveMask(VecCmpEQ(v0, v1)) == 0x9);
+		CHECK(VecMoveMask(VecCmpNEQ(v0, v1)) == 0x6);
+		CHECK(VecMoveMask(VecCmpLT(v0, v1)) == 0x4);
+		CHECK(VecMoveMask(VecCmpLE(v0, v1)) == 0xD);
+		CHECK(VecMoveMask(VecCmpGT(v0, v1)) == 0x2);
+		CHECK(VecMoveMask(VecCmpGE(v0, v1)) == 0xB);
+	}
+
+	SECTION("NaN compares unequal")
+	{
+		SseVec nan = SetSseVec4(NAN);
+
+		CHECK(VecMoveMask(VecCmpEQ(nan, nan)) == 0x0);
+		CHECK(VecMoveMask(VecCmpNEQ(nan, nan)) == 0xF);
+	}
+
+	SECTION("Any and all")
+	{
+		CHECK(VecAnyTrue(VecCmpLT(v0, v1)));
+		CHECK_FALSE(VecAllTrue(VecCmpLT(v0, v1)));
+		CHECK(VecAllTrue(VecCmpEQ(v0, v0)));
+		CHECK_FALSE(VecAnyTrue(VecCmpNEQ(v0, v0)));
+
+		CHECK(VecAnyTrue(SetSseVec4(1.0f, 1.0f, 1.0f, -1.0f)));
+		CHECK_FALSE(Vec3AnyTrue(SetSseVec4(1.0f, 1.0f, 1.0f, -1.0f)));
+		CHECK(Vec3AllTrue(SetSseVec4(-1.0f, -1.0f, -1.0f, 1.0f)));
+		CHECK_FALSE(VecAllTrue(SetSseVec4(-1.0f, -1.0f, -1.0f, 1.0f)));
+	}
+}
+
+TEST_CASE("VecHSum, VecHMin and VecHMax reduce an SseVec into every lane", "[SseVec][4D]")
+{
+	const SseVec vec = SetSseVec4(3.0f, -2.0f, 7.5f, 0.5f);
+
+	CheckSseVec(VecHSum(vec), SetSseVec4(9.0f));
+	CheckSseVec(VecHMin(vec), SetSseVec4(-2.0f));
+	CheckSseVec(VecHMax(vec), SetSseVec4(7.5f));
+
+	CheckSseVec(VecHSum(SetVecZero()), SetVecZero());
+	CheckSseVec(VecHMin(SetSseVec4(1.0f, 2.0f, 3.0f, -Infinity())), SetSseVec4(-Infinity()));
+	CheckSseVec(VecHMax(SetSseVec4(-1.0f, -2.0f, -3.0f, -4.0f)), SetSseVec4(-1.0f));
+}
+
+TEST_CASE("SseVecApproxEqual and HasNaNOrInf check all lanes at once", "[SseVec][4D]")
+{
+	const SseVec vec = SetSseVec4(1.0f, -2.0f, 3.0f, 4.0f);
+
+	SECTION("Approximate equality")
+	{
+		CHECK(SseVecApproxEqual(vec, vec));
+		CHECK(SseVecApproxEqual(vec, SetSseVec4(1.0f, -2.0f, 3.0f, 4.0000002f)));
+		CHECK_FALSE(SseVecApproxEqual(vec, SetSseVec4(1.0f, -2.0f, 3.0f, 4.01f)));
+		CHECK(SseVecApproxEqual<FloatPrecision::LOW>(vec, SetSseVec4(1.0f, -2.0f, 3.0f, 4.01f)));
+		CHECK_FALSE(SseVecApproxEqual(SetSseVec4(NAN), SetSseVec4(NAN)));
+
+		CHECK(SseVec3ApproxEqual(vec, SetSseVec4(1.0f, -2.0f, 3.0f, 0.0f)));
+		CHECK_FALSE(SseVec3ApproxEqual(vec, SetSseVec4(1.0f, 2.0f, 3.0f, 4.0f)));
+	}
+
+	SECTION("NaN and infinity")
+	{
+		CHECK_FALSE(HasNaNOrInf(vec));
+		CHECK_FALSE(HasNaNOrInf(SetSseVec4(FloatMax(), -FloatMax(), 1.0e-40f, 0.0f)));
+		CHECK(HasNaNOrInf(SetSseVec4(1.0f, NAN, 3.0f, 4.0f)));
+		CHECK(HasNaNOrInf(SetSseVec4(1.0f, 2.0f, -Infinity(), 4.0f)));
+		CHECK(VecMoveMask(VecNaNOrInfMask(SetSseVec4(Infinity(), 0.0f, NAN, 1.0f))) == 0x5);
+
+		CHECK_FALSE(Vec3HasNaNOrInf(SetSseVec4(1.0f, 2.0f, 3.0f, NAN)));
+		CHECK(Vec3HasNaNOrInf(SetSseVec4(1.0f, 2.0f, Infinity(), 0.0f)));
+	}
+
+	SECTION("Batch")
+	{
+		SseVec vecs[11];
+		for (size_t i = 0; i < 11; i++)
+		{
+			vecs[i] = SetSseVec4((float)i);
+		}
+
+		CHECK(FindNaNOrInf(vecs, 11) == 11);
+		CHECK(FindNaNOrInf(vecs, 0) == 0);
+
+		vecs[9] = SetSseVec4(0.0f, 0.0f, 0.0f, NAN);
+		CHECK(FindNaNOrInf(vecs, 11) == 9);
+
+		vecs[6] = SetSseVec4(-Infinity());
+		CHECK(FindNaNOrInf(vecs, 11) == 6);
+		CHECK(FindNaNOrInf(vecs, 6) == 6);
+	}
+}
@@ -0,0 +1,186 @@
+#include "ssevecd_tests.h"
+
+using namespace gofxmath;
+using namespace std;
+
+TEST_CASE("SseVecD can be set, loaded, stored, and converted to and from SseVec", "[SseVecD]")
+{
+	SECTION("Set and store")
+	{
+		RunSseVecDTest(SetSseVecD4(1.0, 2.0, 3.0, 4.0), 1.0, 2.0, 3.0, 4.0);
+		RunSseVecDTest(SetSseVecD3(1.0, 2.0, 3.0), 1.0, 2.0, 3.0, 1.0);
+		RunSseVecDTest(SetSseVecD2(1.0, 2.0), 1.0, 2.0, 0.0, 1.0);
+		RunSseVecDTest(SetVecDZero(), 0.0, 0.0, 0.0, 0.0);
+	}
+
+	SECTION("Load")
+	{
+		const double vals[] = { 123456789.125, -2.5, 3.75, 0.0 };
+		SseVecD vec = LoadSseVecD4(vals);
+		RunSseVecDTest(vec, vals[0], vals[1], vals[2], vals[3]);
+		CHECK(SseVecDGetX(vec) == vals[0]);
+	}
+
+	SECTION("Conversion")
+	{
+		RunSseVecDTest(ToSseVecD(SetSseVec4(1.5f, -2.0f, 3.25f, 4.0f)), 1.5, -2.0, 3.25, 4.0);
+
+		array<float, 4> res;
+		_mm_storeu_ps(res.data(), ToSseVec(SetSseVecD4(1.5, -2.0, 3.25, 4.0)));
+		CHECK(res[0] == 1.5f);
+		CHECK(res[1] == -2.0f);
+		CHECK(res[2] == 3.25f);
+		CHECK(res[3] == 4.0f);
+	}
+}
+
+TEST_CASE("VecSwizzle, VecShuffle, and VecBlend can rearrange SseVecD components", "[SseVecD]")
+{
+	const SseVecD V0 = SetSseVecD4(0.0, 1.0, 2.0, 3.0);
+	const SseVecD V1 = SetSseVecD4(4.0, 5.0, 6.0, 7.0);
+
+	RunSseVecDTest(VecSwizzle<W, Z, Y, X>(V0), 3.0, 2.0, 1.0, 0.0);
+	RunSseVecDTest(VecSwizzle<VecCoord::Z, X, W, Y>(V0), 2.0, 0.0, 3.0, 1.0);
+	RunSseVecDTest(VecSplat<VecCoord::Y>(V0), 1.0, 1.0, 1.0, 1.0);
+	RunSseVecDTest(VecShuffle<W, X, Z, Y>(V0, V1), 3.0, 0.0, 6.0, 5.0);
+	RunSseVecDTest(VecBlend<LEFT, RIGHT, RIGHT, LEFT>(V0, V1), 0.0, 5.0, 6.0, 3.0);
+}
+
+TEST_CASE("SseVecD arithmetic functions match their SseVec counterparts", "[SseVecD]")
+{
+	const SseVecD V0 = SetSseVecD4(1.0, 2.0, 3.0, 4.0);
+	const SseVecD V1 = SetSseVecD4(5.0, -6.0, 7.0, 8.0);
+
+	RunSseVecDTest(VecAdd(V0, V1), 6.0, -4.0, 10.0, 12.0);
+	RunSseVecDTest(VecSub(V0, V1), -4.0, 8.0, -4.0, -4.0);
+	RunSseVecDTest(VecMul(V0, V1), 5.0, -12.0, 21.0, 32.0);
+	RunSseVecDTest(VecDiv(V0, V1), 0.2, -1.0 / 3.0, 3.0 / 7.0, 0.5);
+	RunSseVecDTest(VecAddSub(V0, V1), -4.0, -4.0, -4.0, 12.0);
+	RunSseVecDTest(VecSqrt(SetSseVecD4(4.0, 9.0, 2.0, 0.0)), 2.0, 3.0, sqrt(2.0), 0.0);
+	RunSseVecDTest(VecFloor(SetSseVecD4(1.5, -1.5, 2.0, -0.25)), 1.0, -2.0, 2.0, -1.0);
+	RunSseVecDTest(VecCeil(SetSseVecD4(1.5, -1.5, 2.0, -0.25)), 2.0, -1.0, 2.0, -0.0);
+	RunSseVecDTest(VecRound(SetSseVecD4(1.25, -1.75, 2.5, -0.25)), 1.0, -2.0, 2.0, -0.0);
+	RunSseVecDTest(Vec3Negate(V0), -1.0, -2.0, -3.0, 4.0);
+	RunSseVecDTest(Vec4Abs(V1), 5.0, 6.0, 7.0, 8.0);
+
+	RunSseVecDTest(Vec2Dot(V0, V1), -7.0, -7.0, -7.0, -7.0);
+	RunSseVecDTest(Vec3Dot(V0, V1), 14.0, 14.0, 14.0, 14.0);
+	RunSseVecDTest(Vec4Dot(V0, V1), 46.0, 46.0, 46.0, 46.0);
+
+	RunSseVecDTest(Vec3Cross(SetSseVecD3(1.0, 0.0, 0.0), SetSseVecD3(0.0, 1.0, 0.0)), 0.0, 0.0, 1.0, 1.0);
+	RunSseVecDTest(Vec3Cross(V0, V1), 32.0, 8.0, -16.0, 1.0);
+
+	RunSseVecDTest(Vec3Normalize(SetSseVecD3(3.0, 0.0, 4.0)), 0.6, 0.0, 0.8, 1.0);
+	RunSseVecDTest(Vec3Normalize(SetSseVecD3(0.0, 0.0, 0.0)), 0.0, 0.0, 0.0, 1.0);
+	RunSseVecDTest(Vec4Normalize(SetSseVecD4(1.0, 1.0, 1.0, 1.0)), 0.5, 0.5, 0.5, 0.5);
+}
+
+TEST_CASE("SseMat44D matrix functions produce the proper double-precision results", "[SseMat44D][SseVecD]")
+{
+	const SseMat44D M0(
+		2.0, 0.0, 0.0, 0.0,
+		0.0, 3.0, 0.0, 0.0,
+		1.0, 0.0, 4.0, 0.0,
+		5.0, 6.0, 7.0, 1.0);
+
+	SECTION("MatrixMultiply")
+	{
+		RunSseMat44DTest(MatrixMultiply(M0, SseMat44D::Identity()), M0);
+		RunSseMat44DTest(MatrixMultiply(SseMat44D::Identity(), M0), M0);
+
+		const SseMat44D EXPECTED(
+			4.0, 0.0, 0.0, 0.0,
+			0.0, 9.0, 0.0, 0.0,
+			6.0, 0.0, 16.0, 0.0,
+			22.0, 24.0, 35.0, 1.0);
+		RunSseMat44DTest(MatrixMultiply(M0, M0), EXPECTED);
+	}
+
+	SECTION("MatrixInverse")
+	{
+		SseMat44D inverse = MatrixInverse(M0);
+		SseMat44D expected = SseMat44D::Identity();
+		expected.matrixTypeVal = MatrixType::MISC;
+
+		RunSseMat44DTest(MatrixMultiply(M0, inverse), expected);
+		RunSseMat44DTest(MatrixMultiply(inverse, M0), expected);
+
+		CHECK(MatrixInverse(SseMat44D()).matrixTypeVal == MatrixType::INVALID);
+	}
+
+	SECTION("MatrixTranspose")
+	{
+		const SseMat44D EXPECTED(
+			2.0, 0.0, 1.0, 5.0,
+			0.0, 3.0, 0.0, 6.0,
+			0.0, 0.0, 4.0, 7.0,
+			0.0, 0.0, 0.0, 1.0);
+		RunSseMat44DTest(MatrixTranspose(M0), EXPECTED);
+	}
+
+	SECTION("MatrixDeterminant")
+	{
+		RunSseVecDTest(MatrixDeterminant(M0), 24.0, 24.0, 24.0, 24.0);
+		RunSseVecDTest(MatrixDeterminant(SseMat44D::Identity()), 1.0, 1.0, 1.0, 1.0);
+
+		const SseMat44D M1(
+			1.0, 2.0, 3.0, 4.0,
+			5.0, 6.0, 7.0, 8.0,
+			2.0, 6.0, 4.0, 8.0,
+			3.0, 1.0, 1.0, 2.0);
+		RunSseVecDTest(MatrixDeterminant(M1), 72.0, 72.0, 72.0, 72.0);
+	}
+
+	SECTION("TransformVec3")
+	{
+		RunSseVecDTest(TransformVec3(M0, SetSseVecD3(1.0, 1.0, 1.0)), 8.0, 9.0, 11.0, 1.0);
+		RunSseVecDTest(TransformVec3(TranslationMatrixFromVec3(SetSseVecD3(1e9, -1e9, 0.5)), SetSseVecD3(0.25, 0.25, 0.25)), 1e9 + 0.25, -1e9 + 0.25, 0.75, 1.0);
+		RunSseVecDTest(TransformVec3(ScaleMatrixFromVec3(SetSseVecD3(2.0, 3.0, 4.0)), SetSseVecD3(1.0, 1.0, 1.0)), 2.0, 3.0, 4.0, 1.0);
+	}
+}
+
+TEST_CASE("RebaseToCameraRelative keeps full precision for objects far from the world origin", "[SseMat44D][SseMat44]")
+{
+	const double FAR_AWAY = 50000000.0;
+	const SseVecD CAMERA_POS = SetSseVecD3(FAR_AWAY, 0.0, -FAR_AWAY);
+
+	SECTION("Double-precision world matrices")
+	{
+		SseMat44D worldMats[2] = {
+			TranslationMatrixFromVec3(SetSseVecD3(FAR_AWAY + 0.125, 1.0, -FAR_AWAY - 0.0625)),
+			MatrixMultiply(TranslationMatrixFromVec3(SetSseVecD3(FAR_AWAY - 3.5, 2.0, -FAR_AWAY)), ScaleMatrixFromVec3(SetSseVecD3(2.0, 2.0, 2.0)))
+		};
+		SseMat44 result[2];
+
+		RebaseToCameraRelative(worldMats, CAMERA_POS, result, 2);
+
+		RunSseVecDTest(ToSseVecD(result[0].col3), 0.125, 1.0, -0.0625, 1.0, 0.0);
+		RunSseVecDTest(ToSseVecD(result[1].col0), 2.0, 0.0, 0.0, 0.0, 0.0);
+		RunSseVecDTest(ToSseVecD(result[1].col3), -3.5, 2.0, 0.0, 1.0, 0.0);
+		CHECK(result[1].matrixTypeVal == worldMats[1].matrixTypeVal);
+	}
+
+	SECTION("Identity world matrices gain the camera-relative translation")
+	{
+		SseMat44D worldMats[1] = { SseMat44D::Identity() };
+		SseMat44 result[1];
+
+		RebaseToCameraRelative(worldMats, SetSseVecD3(10.0, 0.0, 0.0), result, 1);
+
+		RunSseVecDTest(ToSseVecD(result[0].col3), -10.0, 0.0, 0.0, 1.0, 0.0);
+		CHECK(result[0].matrixTypeVal == MatrixType::TRANSLATION);
+		RunSseVecDTest(ToSseVecD(TransformVec3(result[0], SetSseVec3(0.0f, 0.0f, 0.0f))), -10.0, 0.0, 0.0, 1.0, 0.0);
+	}
+
+	SECTION("Single-precision local matrices with double-precision positions")
+	{
+		SseMat44 localMats[1] = { ScaleMatrixFromVec3(SetSseVec3(3.0f, 3.0f, 3.0f)) };
+		SseVecD positions[1] = { SetSseVecD3(FAR_AWAY + 0.001, -0.5, -FAR_AWAY + 10.0) };
+		SseMat44 result[1];
+
+		RebaseToCameraRelative(localMats, positions, CAMERA_POS, result, 1);
+
+		RunSseVecDTest(ToSseVecD(result[0].col0), 3.0, 0.0, 0.0, 0.0, 0.0);
+		RunSseVecDTest(ToSseVecD(result[0].col3), 0.001, -0.5, 10.0, 1.0, 1e-7);
+	}
+}
@@ -0,0 +1,76 @@
+#include "sseveci_tests.h"
+
+using namespace gofxmath;
+using namespace std;
+
+TEST_CASE("SseVecI can be set, loaded, stored, and swizzled", "[SseVecI]")
+{
+	const int32_t VALS[] = { 1, -2, 3, -4 };
+
+	RunSseVecITest(SetSseVecI4(1, -2, 3, -4), 1, -2, 3, -4);
+	RunSseVecITest(SetSseVecI4(7), 7, 7, 7, 7);
+	RunSseVecITest(SetVecIZero(), 0, 0, 0, 0);
+	RunSseVecITest(LoadSseVecI4(VALS), 1, -2, 3, -4);
+	RunSseVecITest(VecSwizzle<W, Z, Y, X>(LoadSseVecI4(VALS)), -4, 3, -2, 1);
+	RunSseVecITest(VecSplat<VecCoord::Z>(LoadSseVecI4(VALS)), 3, 3, 3, 3);
+}
+
+TEST_CASE("SseVecI arithmetic, shift, compare, min, and max functions", "[SseVecI]")
+{
+	const SseVecI V0 = SetSseVecI4(1, -2, 300, -4);
+	const SseVecI V1 = SetSseVecI4(5, 6, -7, -4);
+
+	RunSseVecITest(VecAdd(V0, V1), 6, 4, 293, -8);
+	RunSseVecITest(VecSub(V0, V1), -4, -8, 307, 0);
+	RunSseVecITest(VecMul(V0, V1), 5, -12, -2100, 16);
+	RunSseVecITest(VecMin(V0, V1), 1, -2, -7, -4);
+	RunSseVecITest(VecMax(V0, V1), 5, 6, 300, -4);
+
+	RunSseVecITest(VecShiftLeft<2>(V0), 4, -8, 1200, -16);
+	RunSseVecITest(VecShiftRight<1>(V0), 0, -1, 150, -2);
+	RunSseVecITest(VecShiftRightLogical<28>(V0), 0, 15, 0, 15);
+
+	RunSseVecITest(VecCmpEQ(V0, V1), 0, 0, 0, -1);
+	RunSseVecITest(VecCmpGT(V0, V1), 0, 0, -1, 0);
+	RunSseVecITest(VecCmpLT(V0, V1), -1, -1, 0, 0);
+
+	RunSseVecITest(VecAnd(V0, SetSseVecI4(0xFF)), 1, 0xFE, 300 & 0xFF, 0xFC);
+}
+
+TEST_CASE("SseVecI float conversions match VecFloor, VecCeil, and VecRound", "[SseVecI][SseVec]")
+{
+	const SseVec V = SetSseVec4(1.5f, -1.5f, 2.75f, -0.25f);
+
+	RunSseVecITest(ToSseVecI(V), 1, -1, 2, 0);
+	RunSseVecITest(VecFloorToInt(V), 1, -2, 2, -1);
+	RunSseVecITest(VecCeilToInt(V), 2, -1, 3, 0);
+	RunSseVecITest(VecRoundToInt(V), 2, -2, 3, 0);
+
+	SECTION("Conversions agree with the float rounding functions")
+	{
+		CHECK(_mm_movemask_ps(_mm_cmpeq_ps(ToSseVec(VecFloorToInt(V)), VecFloor(V))) == 0xF);
+		CHECK(_mm_movemask_ps(_mm_cmpeq_ps(ToSseVec(VecCeilToInt(V)), VecCeil(V))) == 0xF);
+		CHECK(_mm_movemask_ps(_mm_cmpeq_ps(ToSseVec(VecRoundToInt(V)), VecRound(V))) == 0xF);
+	}
+
+	SECTION("Comparison masks can be used with SseVec bitwise functions")
+	{
+		SseVec masked = VecAnd(V, AsSseVec(VecCmpGT(ToSseVecI(V), SetVecIZero())));
+		array<float, 4> res;
+		_mm_storeu_ps(res.data(), masked);
+		CHECK(res[0] == 1.5f);
+		CHECK(res[1] == 0.0f);
+		CHECK(res[2] == 2.75f);
+		CHECK(res[3] == 0.0f);
+	}
+}
+
+TEST_CASE("GridCellFromPosition and Vec3GridHash can compute grid cells and their hashes", "[SseVecI][SseVec]")
+{
+	const SseVec INV_CELL_SIZE = SetSseVec4(0.5f);
+
+	RunSseVecITest(GridCellFromPosition(SetSseVec4(3.0f, -0.5f, 10.0f, 1.0f), INV_CELL_SIZE), 1, -1, 5, 0);
+
+	const int32_t EXPECTED_HASH = (1 * 73856093) ^ (-1 * 19349663) ^ (5 * 83492791);
+	RunSseVecITest(Vec3GridHash(SetSseVecI4(1, -1, 5, 123)), EXPECTED_HASH, EXPECTED_HASH, EXPECTED_HASH, EXPECTED_HASH);
+}
@@ -0,0 +1,107 @@
+#include "vec_expr_tests.h"
+
+using namespace gofxmath;
+using namespace std;
+
+TEST_CASE("Vector expressions match the equivalent chain of SISD calls", "[VecExpr][3D][4D]")
+{
+	const Vec3 a(1.5f, -2.0f, 3.25f);
+	const Vec3 b(-0.5f, 4.0f, 2.0f);
+	const Vec3 c(3.0f, 1.0f, -1.5f);
+	const float s = 2.5f;
+
+	SECTION("Scaled sum with a cross product")
+	{
+		Vec3 result = a * s + Cross(b, c);
+		RunVec3Test(result, Vec3Add(Vec3MulScalar(a, s), Vec3Cross(b, c)));
+	}
+
+	SECTION("Subtraction, negation and scalar division")
+	{
+		Vec3 result = -(a - b) / s;
+		RunVec3Test(result, Vec3DivScalar(Vec3Negate(Vec3Sub(a, b)), s));
+	}
+
+	SECTION("Scalar dot product expressions")
+	{
+		float dot = Dot(a + b, c);
+		CHECK(ApproxEqual_Debug(dot, Vec3Dot(Vec3Add(a, b), c)));
+
+		Vec3 result = c * Dot(a, b) - a;
+		RunVec3Test(result, Vec3Sub(Vec3MulScalar(c, Vec3Dot(a, b)), a));
+	}
+
+	SECTION("4D expressions")
+	{
+		const Vec4 u(1.0f, 2.0f, 3.0f, 4.0f);
+		const Vec4 v(-4.0f, 0.5f, 2.0f, -1.0f);
+
+		Vec4 result = Evaluate(2.0f * u - v * v);
+		RunVec4Test(result, Vec4Sub(Vec4MulScalar(u, 2.0f), Vec4(16.0f, 0.25f, 4.0f, 1.0f)));
+		CHECK(ApproxEqual_Debug(static_cast<float>(Dot(u, v)), Vec4Dot(u, v)));
+	}
+
+	SECTION("Raw SseVecs take part through the typed wrappers")
+	{
+		Vec3 result = AsVec3Expr(LoadSseVec3(a)) * b;
+		RunVec3Test(result, Vec3(a.x * b.x, a.y * b.y, a.z * b.z));
+	}
+}
+
+TEST_CASE("Matrix expressions match TransformVec3 and MatrixMultiply", "[VecExpr][Mat44]")
+{
+	const Mat44 rotation = RotationMatrixFromEuler(Vec3(0.3f, -1.1f, 0.7f));
+	const Mat44 translation = TranslationMatrixFromVec3(Vec3(4.0f, -2.0f, 1.0f));
+	const Vec3 p(1.0f, 2.0f, -3.0f);
+	const Vec3 offset(0.25f, 0.5f, 0.75f);
+
+	SECTION("Mat44 * Vec3 transforms a point")
+	{
+		Vec3 result = rotation * (p + offset);
+		RunVec3Test(result, TransformVec3(rotation, Vec3Add(p, offset)));
+	}
+
+	SECTION("Mat44 * Mat44 composes right-to-left")
+	{
+		Mat44 combined = translation * rotation;
+		RunMat44Test(combined, MatrixMultiply(rotation, translation));
+
+		Vec3 result = combined * p;
+		RunVec3Test(result, TransformVec3(translation, TransformVec3(rotation, p)));
+	}
+
+	SECTION("Mat44 * Vec4 multiplies all four components")
+	{
+		const Vec4 v(1.0f, -2.0f, 0.5f, 0.0f);
+		Vec4 result = translation * v;
+		RunVec4Test(result, v);
+	}
+}
+
+TEST_CASE("EvaluateBatch evaluates an expression over arrays in one pass", "[VecExpr][BATCH]")
+{
+	const size_t COUNT = 7;
+	Vec3 positions[COUNT];
+	Vec3 velocities[COUNT];
+	float times[COUNT];
+	Vec3 results[COUNT];
+	float dots[COUNT];
+
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		positions[i] = Vec3(i * 1.0f, i * -0.5f, 2.0f);
+		velocities[i] = Vec3(0.25f, i * 0.75f, -1.0f);
+		times[i] = 0.1f * (i + 1);
+	}
+
+	const Mat44 transform = MatrixMultiply(RotationMatrixFromEuler(Vec3(0.1f, 0.2f, 0.3f)), TranslationMatrixFromVec3(Vec3(1.0f, 2.0f, 3.0f)));
+
+	EvaluateBatch(transform * (AsVec3Array(positions) + AsVec3Array(velocities) * AsScalarArray(times)), results, COUNT);
+	EvaluateBatch(Dot(AsVec3Array(positions), AsVec3Array(velocities)), dots, COUNT);
+
+	for (size_t i = 0; i < COUNT; i++)
+	{
+		RunVec3Test(results[i], TransformVec3(transform, Vec3Add(positions[i], Vec3MulScalar(velocities[i], times[i]))));
+		CHECK(ApproxEqual_Debug(dots[i], Vec3Dot(positions[i], velocities[i])));
+	}
+}
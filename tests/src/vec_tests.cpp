@@ -1446,6 +1446,14 @@ TEST_CASE("QuaternionMultiply can multiply two quaternions and yield the normali
 	RunVec4Test(result, expected);
 }
 
+TEST_CASE("QuaternionRotateVec3 can rotate a Vec3 by a quaternion", "[Quaternion][Vec3]")
+{
+	RunVec3Test(QuaternionRotateVec3(Quaternion::Identity(), Vec3(1.0f, 2.0f, 3.0f)), Vec3(1.0f, 2.0f, 3.0f));
+	RunVec3Test(QuaternionRotateVec3(Quaternion(0.0f, 0.0f, F_1_SQRT2, F_1_SQRT2), Vec3(1.0f, 0.0f, 0.0f)), Vec3(0.0f, 1.0f, 0.0f));
+	RunVec3Test(QuaternionRotateVec3(Quaternion(0.5f, -0.5f, 0.5f, 0.5f), Vec3(1.0f, 2.0f, 3.0f)), Vec3(-2.0f, -3.0f, 1.0f));
+	RunVec3Test(QuaternionRotateVec3(Quaternion(0.2f, -0.4f, 0.4f, 0.8f), Vec3(3.0f, -4.0f, 5.0f)), Vec3(1.88f, -4.16f, 5.4f));
+}
+
 TEST_CASE("QuaternionLerp can linearly interpolate between two quaternions", "[Quaternion]")
 {
 	Quaternion q0 = (Quaternion)Vec4::E0();